@@ -0,0 +1,58 @@
+#ifndef __802_KERNELS_H__
+#define __802_KERNELS_H__
+
+#include "802-codes.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * The most layers, and edges of a check node, in any of the 802.11n codes
+ */
+#define KERNEL_MAX_MB 12
+#define KERNEL_MAX_DEGREE 22
+
+/**
+ * Row-layered min-sum over one layer of a code, with z, the block columns,
+ * their shifts and the degree built in.  The posteriors are N flat floats,
+ * and the messages of the layer are a block of z for each of its block
+ * columns, in order, so that message k of check node i is r[k * z + i].
+ * The same arithmetic as checkMS() in ldpcDecoder.c.
+ * @param {float *} post the N posteriors, updated in place
+ * @param {float *} r the messages of the layer, updated in place
+ */
+typedef void (*LayerKernel)(float *post, float *r);
+
+/**
+ * The generated kernels of one code, from src/802-kernels.c
+ */
+typedef struct {
+	Code *code;
+	int nrEdges;                       // messages in all
+	int offsets[KERNEL_MAX_MB];        // first message of each layer
+	LayerKernel layers[KERNEL_MAX_MB]; // by layer of Hb
+	LayerKernel avx2[KERNEL_MAX_MB];   // the same, 8 check nodes at a time, on x86
+	LayerKernel avx512[KERNEL_MAX_MB]; // and 16 at a time
+} LdpcKernel;
+
+/**
+ * Find the generated kernels of a code
+ * @param {Code *} code one of the codes of 802-codes.h
+ * @return {LdpcKernel *} its kernels, or null if there are none
+ */
+LdpcKernel *ldpcKernelFind(Code *code);
+
+/**
+ * Pick the form of the kernels of a code to run, the widest that
+ * isaLevel() allows.  They all give the same results, bit for bit
+ * @param {LdpcKernel *} kernel the kernels of a code
+ * @return {LayerKernel *} the kernels by layer of Hb
+ */
+LayerKernel *ldpcKernelLayers(LdpcKernel *kernel);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /*__802_KERNELS_H__*/
@@ -0,0 +1,98 @@
+#ifndef __802_PPDU_H__
+#define __802_PPDU_H__
+
+#include <stdint.h>
+
+#include "802-codes.h"
+#include "ldpcEncoder.h"
+#include "scrambler.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * LDPC encoding parameters for one PPDU, as computed by the procedure
+ * in 802.11n 20.3.11.7.5
+ */
+typedef struct {
+	int length;   // PSDU length in bytes
+	int nCbps;    // coded bits per OFDM symbol
+	int rateNum;  // code rate numerator.  ex: 3
+	int rateDen;  // code rate denominator.  ex: 4
+	int mStbc;    // 2 if STBC is used, else 1
+	int nPld;     // data bits: SERVICE + PSDU
+	int nAvbits;  // available bits in the OFDM symbols
+	int nCw;      // number of codewords
+	int lLdpc;    // codeword length: 648, 1296 or 1944
+	int nShrt;    // shortened bits, over all codewords
+	int nPunc;    // punctured bits, over all codewords
+	int nRep;     // repeated bits, over all codewords
+	int nSym;     // number of OFDM symbols
+	Code *code;   // the code for rate and lLdpc
+} PpduParams;
+
+/**
+ * Encoder for whole PPDUs.  Keeps an LdpcEncoder for each code it has seen.
+ */
+typedef struct {
+	LdpcEncoder *encoders[12];
+	int nrThreads;
+	Scrambler *scrambler;
+	uint8_t *data;   // scrambled SERVICE + PSDU for ppduEncodePsdu()
+	int dataLen;
+} PpduEncoder;
+
+/**
+ * Compute the LDPC encoding parameters for a PSDU
+ * @param {PpduParams *} p the parameters to fill in
+ * @param {int} length the PSDU length in bytes
+ * @param {int} nCbps the number of coded bits per OFDM symbol
+ * @param {int} rateNum the code rate numerator: 1, 2, 3 or 5
+ * @param {int} rateDen the code rate denominator: 2, 3, 4 or 6
+ * @param {int} mStbc 2 if STBC is used, else 1
+ * @return {int} 1 if successful, else 0
+ */
+int ppduParamsInit(PpduParams *p, int length, int nCbps, int rateNum, int rateDen, int mStbc);
+
+/**
+ * Create a new PPDU encoder
+ * @param {int} nrThreads the most threads to use, <= 0 for one per processor
+ * @return {PpduEncoder *} a new encoder if successful, else null
+ */
+PpduEncoder *ppduEncoderCreate(int nrThreads);
+
+/**
+ * Clean up a PPDU encoder
+ * @param {PpduEncoder *} penc the encoder to destroy
+ */
+void ppduEncoderDestroy(PpduEncoder *penc);
+
+/**
+ * Encode the data bits of a PPDU into p->nAvbits coded bits, with
+ * shortening, puncturing and repetition spread evenly over the codewords
+ * @param {PpduEncoder *} penc the PPDU encoder
+ * @param {PpduParams *} p parameters from ppduParamsInit()
+ * @param {uint8_t *} bytes the p->nPld scrambled data bits, packed big-endian
+ * @param {uint8_t *} out output for p->nAvbits bits, one per byte
+ * @return {int} 1 if successful, else 0
+ */
+int ppduEncode(PpduEncoder *penc, PpduParams *p, uint8_t *bytes, uint8_t *out);
+
+/**
+ * Prepend the SERVICE field to a PSDU, scramble it, and encode it
+ * into p->nAvbits coded bits
+ * @param {PpduEncoder *} penc the PPDU encoder
+ * @param {PpduParams *} p parameters from ppduParamsInit()
+ * @param {uint8_t *} psdu the p->length bytes of the PSDU
+ * @param {int} seed the initial scrambler state, 1 to 127
+ * @param {uint8_t *} out output for p->nAvbits bits, one per byte
+ * @return {int} 1 if successful, else 0
+ */
+int ppduEncodePsdu(PpduEncoder *penc, PpduParams *p, uint8_t *psdu, int seed, uint8_t *out);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /*__802_PPDU_H__*/
@@ -22,6 +22,10 @@ typedef struct {
 	int **T;
 	int Hlen;
 	int **H;
+	// for each column of H, the rows that it touches.  For a message
+	// column these are the rows of A, then C
+	int Slen;
+	int **S;
 } Table;
 
 
@@ -32,6 +36,8 @@ void tableDestroy(Table *);
 
 int **qcToSparse(int *qc, int qcWidth, int xoff, int yoff, int rangeWidth, int rangeHeight, int z);
 
+int **qcToSparseColumns(int *qc, int qcWidth, int xoff, int yoff, int width, int height, int z);
+
 
 #ifdef __cplusplus
 }
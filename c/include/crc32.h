@@ -8,13 +8,41 @@ extern "C" {
 
 
 /**
- * Calculate the crc32 checksum for an array of bytes
+ * Calculate the crc32 checksum for an array of bytes.  Runs of 64 bytes
+ * or more are folded by carry-less multiply where isaHasClmul(), else
+ * the bytes are taken sixteen at a time by slicing tables
  * @param {ubyte *} bytes array of bytes
  * @param {int} len number of bytes in array
  * @return {uint32_t} the crc
  */
 extern uint32_t Crc32ofBytes(uint8_t* bytes, int len);
 
+/**
+ * The forms behind Crc32ofBytes(), each giving the same crc.  Table takes
+ * a byte at a time, Slice8 and Slice16 eight and sixteen, and Clmul folds
+ * with PCLMULQDQ, falling back to Slice16 where that is not allowed
+ * @param {ubyte *} bytes array of bytes
+ * @param {int} len number of bytes in array
+ * @return {uint32_t} the crc
+ */
+extern uint32_t Crc32ofBytesTable(uint8_t* bytes, int len);
+extern uint32_t Crc32ofBytesSlice8(uint8_t* bytes, int len);
+extern uint32_t Crc32ofBytesSlice16(uint8_t* bytes, int len);
+extern uint32_t Crc32ofBytesClmul(uint8_t* bytes, int len);
+
+extern const uint32_t crcTable[];
+
+/**
+ * Add one byte to a running crc32, for callers that make their own pass
+ * over the data.  Start with 0xffffffff, and XOR with 0xffffffff at the end
+ * @param {uint32_t} crc the running crc
+ * @param {uint8_t} b the next byte
+ * @return {uint32_t} the updated crc
+ */
+static inline uint32_t Crc32Step(uint32_t crc, uint8_t b) {
+	return crcTable[(uint8_t)crc ^ b] ^ (crc >> 8);
+}
+
   
 #ifdef __cplusplus  
 }  
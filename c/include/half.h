@@ -0,0 +1,124 @@
+#ifndef __HALF_H__
+#define __HALF_H__
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * 16-bit float storage for decoder messages.  The arithmetic stays in
+ * 32-bit floats, and only what is kept between uses is rounded to 16
+ * bits, which halves the memory that the messages take and move.
+ *
+ * FP16 is IEEE half precision: 11 bits of precision, up to 65504.
+ * BF16 is the top half of a float: 8 bits of precision, with the range
+ * of a float.  Both round to nearest, ties to even.
+ *
+ * The scalar and vector forms give bit-exact results.  The FP16 vector
+ * form uses F16C, which handles subnormals and NaNs as the scalar form
+ * does.  The BF16 vector form uses AVX-512 BF16, which flushes
+ * subnormals to zero, so the scalar form does too.  Each is used where
+ * isaLevel() allows, see isa.h.
+ */
+
+/**
+ * Round a float to FP16
+ * @param {float} f the value
+ * @return {uint16_t} its FP16 bits
+ */
+uint16_t halfFromFloat(float f);
+
+/**
+ * Widen FP16 to a float, which is exact
+ * @param {uint16_t} h the FP16 bits
+ * @return {float} the value
+ */
+float halfToFloat(uint16_t h);
+
+/**
+ * Round a float to BF16
+ * @param {float} f the value
+ * @return {uint16_t} its BF16 bits
+ */
+uint16_t bf16FromFloat(float f);
+
+/**
+ * Widen BF16 to a float, which is exact
+ * @param {uint16_t} h the BF16 bits
+ * @return {float} the value
+ */
+float bf16ToFloat(uint16_t h);
+
+/**
+ * Round n floats to FP16
+ * @param {uint16_t *} out the n FP16 values
+ * @param {float *} in the n floats
+ * @param {int} n the number of values
+ */
+void halfPack(uint16_t *out, float *in, int n);
+
+/**
+ * halfPack() one value at a time
+ */
+void halfPackScalar(uint16_t *out, float *in, int n);
+
+/**
+ * halfPack() eight values at a time with F16C, where isaLevel() allows.
+ * Elsewhere the same as halfPackScalar()
+ */
+void halfPackVector(uint16_t *out, float *in, int n);
+
+/**
+ * Widen n FP16 values to floats
+ * @param {float *} out the n floats
+ * @param {uint16_t *} in the n FP16 values
+ * @param {int} n the number of values
+ */
+void halfUnpack(float *out, uint16_t *in, int n);
+
+/**
+ * halfUnpack() one value at a time
+ */
+void halfUnpackScalar(float *out, uint16_t *in, int n);
+
+/**
+ * halfUnpack() eight values at a time with F16C, where isaLevel() allows.
+ * Elsewhere the same as halfUnpackScalar()
+ */
+void halfUnpackVector(float *out, uint16_t *in, int n);
+
+/**
+ * Round n floats to BF16
+ * @param {uint16_t *} out the n BF16 values
+ * @param {float *} in the n floats
+ * @param {int} n the number of values
+ */
+void bf16Pack(uint16_t *out, float *in, int n);
+
+/**
+ * bf16Pack() one value at a time
+ */
+void bf16PackScalar(uint16_t *out, float *in, int n);
+
+/**
+ * bf16Pack() sixteen values at a time with AVX-512 BF16, where
+ * isaHasBf16().  Elsewhere the same as bf16PackScalar()
+ */
+void bf16PackVector(uint16_t *out, float *in, int n);
+
+/**
+ * Widen n BF16 values to floats.  This is a shift, which the compiler
+ * vectorizes as it is
+ * @param {float *} out the n floats
+ * @param {uint16_t *} in the n BF16 values
+ * @param {int} n the number of values
+ */
+void bf16Unpack(float *out, uint16_t *in, int n);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /*__HALF_H__*/
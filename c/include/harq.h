@@ -0,0 +1,74 @@
+#ifndef __HARQ_H__
+#define __HARQ_H__
+
+#include <stdint.h>
+
+#include "802-codes.h"
+#include "ldpcDecoder.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * Soft buffer for one HARQ process.  Each transmission of a codeword is
+ * added into the buffer, and the sum is decoded.  Sending the same bits
+ * again is chase combining.  Sending bits that were punctured before is
+ * incremental redundancy.  After a failed decode the check node messages
+ * are kept, so that the next decode can start from them.
+ */
+typedef struct {
+	Code *code;
+	float *llr;         // sum of the received values of each of the N bits
+	float *messages;    // check node messages of the last failed decode
+	int nrEdges;        // size of messages
+	int hasMessages;
+	int transmissions;  // transmissions combined since the last reset
+} HarqBuffer;
+
+/**
+ * Create a new HARQ buffer
+ * @param {Code *} code the code of the codewords to combine
+ * @return {HarqBuffer *} a new buffer if successful, else null
+ */
+HarqBuffer *harqCreate(Code *code);
+
+/**
+ * Clean up a HARQ buffer
+ * @param {HarqBuffer *} h the buffer to destroy
+ */
+void harqDestroy(HarqBuffer *h);
+
+/**
+ * Empty the buffer, for a new codeword on this process
+ * @param {HarqBuffer *} h the buffer
+ */
+void harqReset(HarqBuffer *h);
+
+/**
+ * Add a transmission into the buffer
+ * @param {HarqBuffer *} h the buffer
+ * @param {float *} received the bits that were sent this time, -1 to 1, in order
+ * @param {int} nrReceived the number of received values
+ * @param {uint8_t *} erased N flags, 1 for a bit not sent this time, or
+ * null if all N were sent
+ * @return {int} 1 if successful, 0 if nrReceived does not match the mask
+ */
+int harqCombine(HarqBuffer *h, float *received, int nrReceived, uint8_t *erased);
+
+/**
+ * Decode what has been combined so far, by min-sum
+ * @param {HarqBuffer *} h the buffer
+ * @param {LdpcDecoder *} dec a decoder for the same code
+ * @param {int} maxIter the maximum number of iterations before failing
+ * @param {int} warmStart 1 to carry on from the messages of the last
+ * failed decode, if there is one, else 0
+ * @return decoded array of N bits if successful, else null
+ */
+uint8_t *harqDecode(HarqBuffer *h, LdpcDecoder *dec, int maxIter, int warmStart);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /*__HARQ_H__*/
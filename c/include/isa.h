@@ -0,0 +1,80 @@
+#ifndef __ISA_H__
+#define __ISA_H__
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * x86 builds carry vector forms of the hot kernels for several ISA
+ * levels, each built with a target attribute, so that one binary runs
+ * the best that each host has.  Elsewhere there is only the generic form.
+ */
+#if defined(__x86_64__) || defined(__i386__)
+#define ISA_X86 1
+#endif
+
+/**
+ * ISA levels, each with all that comes before it
+ */
+typedef enum {
+	ISA_GENERIC = 0, // plain C
+	ISA_SSE42,       // SSE4.2 and POPCNT
+	ISA_AVX2,        // AVX2, BMI2, FMA and F16C
+	ISA_AVX512,      // AVX-512 F, BW and VL
+	ISA_NR_LEVELS
+} IsaLevel;
+
+/**
+ * Find the best level that this CPU has
+ * @return {IsaLevel} the level
+ */
+IsaLevel isaDetect(void);
+
+/**
+ * Get the level that the kernels use.  This is decided on the first call:
+ * the level of the CPU, or of the LDPC802_ISA environment variable if that
+ * is lower.  It may be generic, sse4.2, avx2 or avx512.
+ * @return {IsaLevel} the level
+ */
+IsaLevel isaLevel(void);
+
+/**
+ * Set the level that the kernels use, for tests and benchmarks.  It is
+ * not safe to call while other threads run kernels.
+ * @param {IsaLevel} level the level wanted
+ * @return {IsaLevel} the level set, which is no higher than isaDetect()
+ */
+IsaLevel isaSelect(IsaLevel level);
+
+/**
+ * 1 if the kernels may use AVX-512 BF16, which not all AVX-512 hosts have
+ * @return {int} 1 if so, else 0
+ */
+int isaHasBf16(void);
+
+/**
+ * 1 if the kernels may use PCLMULQDQ, which not all SSE4.2 hosts have
+ * @return {int} 1 if so, else 0
+ */
+int isaHasClmul(void);
+
+/**
+ * Get the name of a level, as LDPC802_ISA takes it
+ * @param {IsaLevel} level the level
+ * @return {const char *} its name
+ */
+const char *isaName(IsaLevel level);
+
+/**
+ * Look up a level by name
+ * @param {const char *} name the name of a level, as from isaName()
+ * @return {int} the level, or -1 if there is none by that name
+ */
+int isaParse(const char *name);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /*__ISA_H__*/
@@ -0,0 +1,57 @@
+#ifndef __LAYERS_H__
+#define __LAYERS_H__
+
+#include "802-codes.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * The most QC block rows and columns of any code
+ */
+#define LAYERS_MAX_MB 12
+#define LAYERS_MAX_NB 24
+
+/**
+ * The order in which a row-layered decoder takes the layers, one QC block
+ * row each, and the block columns within each layer.  When two layers in a
+ * row touch the same block column, the second must wait for the first to
+ * write back that column's posterior.  A pipelined decoder stalls on each
+ * such column, so the order is chosen to have as few as it can.  The last
+ * layer is followed by the first of the next iteration, so that pair
+ * counts too.
+ */
+typedef struct {
+	int nrLayers;                   // mb
+	int order[LAYERS_MAX_MB];       // the layers, in the order to run them
+	int nrColumns[LAYERS_MAX_MB];   // block columns that each layer touches
+	// for each layer, the block columns it touches, in the order to take
+	// them: those the next layer needs first, those the last layer wrote last
+	int columns[LAYERS_MAX_MB][LAYERS_MAX_NB];
+	int stalls;                     // block columns shared by layers in a row
+} LayerSchedule;
+
+/**
+ * Count the block columns that two layers both touch
+ * @param {Code *} code the code
+ * @param {int} a a block row
+ * @param {int} b another block row
+ * @return {int} the number of shared block columns
+ */
+int layerOverlap(Code *code, int a, int b);
+
+/**
+ * Work out a layer schedule for a code
+ * @param {LayerSchedule *} s output for the schedule
+ * @param {Code *} code the code
+ * @param {int} optimize 1 for the order with the fewest stalls, found by
+ * dynamic programming over the subsets of layers, or 0 for the natural order
+ */
+void layerScheduleInit(LayerSchedule *s, Code *code, int optimize);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /*__LAYERS_H__*/
@@ -1,12 +1,141 @@
 #ifndef __LDPC802_H__
 #define __LDPC802_H__
 
+#include <stdint.h>
+
+#include "802-codes.h"
+#include "ldpcEncoder.h"
+#include "ldpcDecoder.h"
+#include "scrambler.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * Streaming codec to add LDPC forward error correction to a byte stream.
+ * The stream is cut into chunks of up to chunkBytes.  Each chunk, with its
+ * CRC32, is sent as one shortened codeword: the chunk and CRC bytes, then
+ * the parity bits, padded to a whole byte.  All buffers are made at create
+ * time, so pushing data allocates nothing.
+ */
 typedef struct {
-	int width;
+	Code *code;
+	LdpcEncoder *encoder;
+	LdpcDecoder *decoder;
+	Scrambler *txScrambler; // null unless whitening is on
+	Scrambler *rxScrambler;
+	int withCrc;
+	int maxIter;
+	int chunkBytes;    // payload bytes in a full frame
+	int parityBytes;   // parity bits of a frame, rounded up to bytes
+	int frameBytes;    // bytes of a full frame
+	// transmit side
+	uint8_t *txChunk;  // payload waiting for a full chunk
+	int txLen;
+	// receive side
+	float *rxFrame;    // soft bits waiting for a full frame
+	int rxLen;
+	uint8_t *rxBytes;  // a decoded chunk and CRC
+	// counters
+	int frames;        // frames received
+	int decodeErrors;  // frames that failed to decode
+	int crcErrors;     // frames that decoded with a bad CRC
 } LdpcCodec;
 
+/**
+ * Create a new codec
+ * @param {Code *} code the code to use for each frame
+ * @param {int} withCrc 1 to seal each chunk with a CRC32, else 0
+ * @return {LdpcCodec *} a new codec if successful, else null
+ */
+LdpcCodec *ldpcCodecCreate(Code *code, int withCrc);
 
+/**
+ * Clean up a codec
+ * @param {LdpcCodec *} codec the codec to destroy
+ */
+void ldpcCodecDestroy(LdpcCodec *codec);
 
-#endif /*__LDPC802_H__*/
+/**
+ * Turn on whitening of the payload with the 802.11 scrambler on both
+ * the transmit and receive sides.  Both ends must use the same seed.
+ * @param {LdpcCodec *} codec the codec
+ * @param {int} seed the scrambler seed, 1 to 127, or 0 to turn it off
+ * @return {int} 1 if successful, else 0
+ */
+int ldpcCodecSetScrambler(LdpcCodec *codec, int seed);
+
+/**
+ * Get the size of the frame that carries a chunk
+ * @param {LdpcCodec *} codec the codec
+ * @param {int} nrBytes the size of the chunk, 1 to chunkBytes
+ * @return {int} the size of the frame in bytes
+ */
+int ldpcCodecFrameBytes(LdpcCodec *codec, int nrBytes);
+
+/**
+ * Get the most output that ldpcCodecEncode() will give for an input
+ * @param {LdpcCodec *} codec the codec
+ * @param {int} len the number of bytes to push
+ * @return {int} the most bytes that will be written
+ */
+int ldpcCodecEncodeSize(LdpcCodec *codec, int len);
 
+/**
+ * Push bytes into the transmit side.  Each time a chunk fills up,
+ * its frame is written to out.
+ * @param {LdpcCodec *} codec the codec
+ * @param {uint8_t *} bytes the bytes to send
+ * @param {int} len the number of bytes
+ * @param {uint8_t *} out output for the frames
+ * @param {int} outLen the size of out.  See ldpcCodecEncodeSize()
+ * @return {int} the number of bytes written to out, or -1 if out is too small
+ */
+int ldpcCodecEncode(LdpcCodec *codec, uint8_t *bytes, int len, uint8_t *out, int outLen);
 
+/**
+ * Send whatever is left in the transmit side as a short frame
+ * @param {LdpcCodec *} codec the codec
+ * @param {uint8_t *} out output for the frame
+ * @param {int} outLen the size of out, at least frameBytes
+ * @return {int} the number of bytes written to out, or -1 if out is too small
+ */
+int ldpcCodecEncodeFlush(LdpcCodec *codec, uint8_t *out, int outLen);
+
+/**
+ * Get the most output that ldpcCodecDecode() will give for an input
+ * @param {LdpcCodec *} codec the codec
+ * @param {int} len the number of soft bits to push
+ * @return {int} the most bytes that will be written
+ */
+int ldpcCodecDecodeSize(LdpcCodec *codec, int len);
+
+/**
+ * Push received soft bits into the receive side, one per bit of the frames,
+ * -1 to 1 as for the decoder.  Each time a frame fills up it is decoded and
+ * checked, and its payload is written to out.  Frames that fail are dropped,
+ * and counted in decodeErrors or crcErrors.
+ * @param {LdpcCodec *} codec the codec
+ * @param {float *} samples the soft bits
+ * @param {int} len the number of soft bits
+ * @param {uint8_t *} out output for the payload
+ * @param {int} outLen the size of out.  See ldpcCodecDecodeSize()
+ * @return {int} the number of bytes written to out, or -1 if out is too small
+ */
+int ldpcCodecDecode(LdpcCodec *codec, float *samples, int len, uint8_t *out, int outLen);
+
+/**
+ * Decode whatever is left in the receive side as a short frame
+ * @param {LdpcCodec *} codec the codec
+ * @param {uint8_t *} out output for the payload
+ * @param {int} outLen the size of out, at least chunkBytes
+ * @return {int} the number of bytes written to out, or -1 if out is too small
+ */
+int ldpcCodecDecodeFlush(LdpcCodec *codec, uint8_t *out, int outLen);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /*__LDPC802_H__*/
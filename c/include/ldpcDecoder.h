@@ -4,6 +4,9 @@
 #include <stdint.h>
 
 #include "802-tables.h"
+#include "osd.h"
+#include "layers.h"
+#include "802-kernels.h"
 
 
 #ifdef __cplusplus  
@@ -13,39 +16,190 @@ extern "C" {
 struct QRNodeDef {
 	float q;
 	float r;
+	float rNext; // the r it would take next, for the residual schedule
+	float t;     // tanh(q/2), for the residual schedule
+	int pinned; // 1 if its variable is a known shortened bit
+	struct VariableNodeDef *vnode; // the variable node of this edge
 	struct QRNodeDef *next;
+	struct QRNodeDef *nextActive; // next that is not pinned
 };
 typedef struct QRNodeDef QRNode;
 
 struct CheckNodeDef {
 	QRNode *qrNodes;
+	QRNode *active; // qrNodes that are not pinned
+	float residual; // the most that an r would change if updated now
+	int heapPos;    // place in the residual heap
 	struct CheckNodeDef *next;
 };
 typedef struct CheckNodeDef CheckNode;
 
+/**
+ * The min-sum messages of a check node, compressed: every r is +-min1, or
+ * +-min2 on the edge of the smallest q, with the sign of the product of
+ * the others.  Edges are counted in the column order of the layer,
+ * leaving out pinned ones
+ */
+typedef struct {
+	float min1;
+	float min2;
+	int minPos;     // edge of the smallest q
+	uint32_t signs; // bit k set if the q of edge k is negative
+} CompressedCheck;
+
 struct LinkDef {
 	QRNode *qr;
+	int check; // index of the check node that owns qr
+	CheckNode *checkNode; // the check node that owns qr
 	struct LinkDef *next;
 };
 typedef struct LinkDef Link;
 
 struct VariableNodeDef {
+	int index;
 	float ci;
+	float post; // posterior, for the row-layered schedule
 	Link *links;
 	Link *linkHead;
 	struct VariableNodeDef *next;
+	struct VariableNodeDef *nextActive; // next that is not pinned
 };
 typedef struct VariableNodeDef VariableNode;
 
+/**
+ * How the last decode call ended
+ */
+typedef enum {
+	LDPC_OK = 0,     // decoded to a codeword
+	LDPC_MAX_ITER,   // used up all of its iterations
+	LDPC_STALLED,    // gave up early, with no progress for stallLimit iterations
+	LDPC_BAD_CRC,    // converged to a codeword whose CRC is wrong
+	LDPC_BAD_OPTIONS // not run, as the options set do not go together.  See
+	                 // the fields of LdpcDecoder for which need which
+} LdpcStatus;
+
+/**
+ * The order in which message passing updates the graph
+ */
+typedef enum {
+	LDPC_SCHEDULE_FLOODING = 0, // every check node, then every variable node
+	LDPC_SCHEDULE_COLUMN,       // each QC block column of variable nodes in turn,
+	                            // with their check messages made fresh first
+	LDPC_SCHEDULE_RESIDUAL,     // the check node whose messages would change the
+	                            // most first.  An iteration is M check updates.
+	                            // Sum-product only: min-sum is refused with
+	                            // LDPC_BAD_OPTIONS, as greedy min-sum fails more
+	                            // words than flooding past the waterfall.  It
+	                            // takes fewer check updates than flooding, but
+	                            // each works out the residuals of the checks of
+	                            // its variables again, so a decode takes 2.5 to 4
+	                            // times the time, see misc/residualsim.c
+	LDPC_SCHEDULE_ROW           // each QC block row of check nodes in turn, in the
+	                            // order of dec->layers, with the posteriors made
+	                            // fresh after each
+} LdpcSchedule;
+
+/**
+ * How the check node messages are stored between uses under the row
+ * schedule.  The arithmetic is 32-bit float for all of them
+ */
+typedef enum {
+	LDPC_MESSAGES_FP32 = 0, // 32-bit floats
+	LDPC_MESSAGES_FP16,     // IEEE half precision, see half.h
+	LDPC_MESSAGES_BF16      // bfloat16, see half.h
+} LdpcMessageFormat;
+
+/**
+ * Which stage of ldpcDecode() ended the last call
+ */
+typedef enum {
+	LDPC_STAGE_HARD = 0, // the hard decisions of the input passed
+	LDPC_STAGE_BF,       // bit flipping fixed it
+	LDPC_STAGE_MS,       // min-sum fixed it
+	LDPC_STAGE_OSD,      // ordered statistics fixed what min-sum could not
+	LDPC_STAGE_FAILED,   // nothing did
+	LDPC_NR_STAGES
+} LdpcStage;
+
 //max M is 972
 //max N is 1944
 typedef struct {
 	Code *code;
 	Table *table;
+	LdpcSchedule schedule; // LDPC_SCHEDULE_FLOODING by default
+	int selfCorrect;       // 1 for self-corrected min-sum under the flooding and
+	                       // column schedules.  Under the row schedule, or for
+	                       // sum-product, it is refused with LDPC_BAD_OPTIONS.
+	                       // 0 by default
+	LayerSchedule layers;  // layer order for the row schedule, see ldpcDecoderSetLayers()
+	int compressed;        // 1 for min-sum under the row schedule to keep only min1,
+	                       // min2, the argmin and the signs of each check node, in
+	                       // place of an r per edge, and to run on flat posteriors
+	                       // rather than the graph.  A warm-started decode keeps an
+	                       // r per edge instead.  Under any other schedule, or for
+	                       // sum-product, it is refused with LDPC_BAD_OPTIONS.
+	                       // 0 by default
+	LdpcMessageFormat messageFormat; // storage of the r per edge under the row
+	                       // schedule, when not compressed.  16-bit formats halve
+	                       // what the messages take, and are rounded to on each
+	                       // store.  They run on flat posteriors rather than the
+	                       // graph, so the messages are all that is kept per edge.
+	                       // A warm-started decode keeps FP32 instead.  Under any
+	                       // other schedule, a 16-bit format is refused with
+	                       // LDPC_BAD_OPTIONS.  LDPC_MESSAGES_FP32 by default
+	int specialized;       // 1, the default, for min-sum under the row schedule to
+	                       // run the generated kernels of the code, see 802-kernels.h,
+	                       // where it can: full FP32 messages, no shortened bits and
+	                       // no warm start.  The results are the same, bit for bit
+	LdpcKernel *kernel;    // the generated kernels of the code, or null
+	float *kernelR;        // the messages of the kernels, kernel->nrEdges of them
+	int messageStore;      // where the last decode kept its messages, for
+	                       // ldpcDecoderSaveMessages()
+	int stallLimit;        // give up after this many iterations with no new low
+	                       // in unsatisfied checks.  0, the default, for never
+	int bfMaxFlips;        // bit flips that ldpcDecode() tries before min-sum, 0 for none
+	int bfFallback;        // 1, the default, to go on to min-sum if bit flipping fails
+	LdpcOsd *osd;          // if set, ldpcDecode() tries it on words min-sum fails.
+	                       // The caller owns it.  Null by default
 	CheckNode *checkNodes;
 	VariableNode *variableNodes;
+	VariableNode *activeVariables; // variable nodes that are not pinned
+	uint16_t *halfMessages; // 16-bit r of every edge, in the order of
+	                       // ldpcDecoderSaveMessages(), see messageFormat
+	CompressedCheck *compressedChecks; // by check node index, see compressed
+	int pinStart;          // range of pinned variables
+	int pinEnd;
 	uint8_t syndrome[1944];
 	uint8_t outBytes[243]; // 1944/8
+	uint8_t parity[972];   // parity of each check over the hard decisions
+	CheckNode *checks[972]; // check nodes by index
+	CheckNode *heap[972];  // check nodes by residual, largest first
+	float expanded[1944];  // a punctured word expanded to N values
+	float kernelPost[1944]; // the posteriors of the kernels, of compressed min-sum
+	                       // and of 16-bit messages
+	float flipMetric[1944]; // bit flipping inversion function of each bit
+	// CRC-aided termination, see ldpcDecoderSetCrc()
+	int crcStart;          // first bit covered by the CRC
+	int crcPos;            // first bit of the CRC, or 0 for none
+	uint32_t crcTerms[1944]; // what each covered bit adds to the CRC
+	uint32_t crcZero;      // CRC of the covered bits if all are 0
+	uint32_t crcCalc;      // CRC of the covered hard decisions
+	uint32_t crcGiven;     // CRC as given by the hard decisions
+	// soft output, set only during ldpcDecodeSoftSP() and ldpcDecodeSoftMS()
+	float *appOut;
+	float *extOut;
+	// check messages to start the next decode from, see ldpcDecoderWarmStart()
+	float *warmStart;
+	// counters for the last decode call
+	int iterations;        // message passing iterations used
+	int updates;           // check node updates, by the residual schedule
+	int fastPath;          // 1 if the input passed the check as it came
+	int unsatisfied;       // checks failing on the current hard decisions
+	LdpcStatus status;
+	LdpcStage stage;       // which stage of ldpcDecode() ended it
+	int flips;             // bits flipped by bit flipping
+	// totals over all calls of ldpcDecode()
+	int stageCounts[LDPC_NR_STAGES];
 } LdpcDecoder;
 
 
@@ -62,6 +216,82 @@ LdpcDecoder *ldpcDecoderCreate(Code *code);
  */
 void ldpcDecoderDestroy(LdpcDecoder *dec);
 
+/**
+ * Set the order of the layers for the row-layered schedule, and of the
+ * edges of each check node to match the column order of its layer.
+ * Create sets the optimized order.
+ * @param {LdpcDecoder *} dec the decoder context
+ * @param {int} optimize 1 for the order with the fewest read-after-write
+ * stalls between layers, or 0 for the natural order.  See layers.h
+ */
+void ldpcDecoderSetLayers(LdpcDecoder *dec, int optimize);
+
+/**
+ * Turn on CRC-aided termination.  The message holds a CRC32 of nrBytes
+ * bytes, sent bigendian right after them, as LdpcCodec sends it.  The
+ * CRC is kept up to date as hard decisions flip, and the decode stops as
+ * soon as the CRC passes, even if some parity checks still fail.  A word
+ * that passes all checks but not the CRC ends with LDPC_BAD_CRC.
+ * @param {LdpcDecoder *} dec the decoder context
+ * @param {int} pos the index of the first bit of the CRC
+ * @param {int} nrBytes the number of bytes before pos covered by the CRC,
+ * or 0 to turn it off
+ * @return {int} 1 if successful, else 0
+ */
+int ldpcDecoderSetCrc(LdpcDecoder *dec, int pos, int nrBytes);
+
+/**
+ * Copy out the check node messages, r(ji), of the last decode, so that a
+ * later decode can carry on from them.  There is one per edge of H, in the
+ * order of the rows of H, and by column within a row.  The order does not
+ * depend on the layer order, so ldpcDecoderSetLayers() may be called between
+ * the save and the warm start.  They are the same whether the decode kept
+ * them per edge, compressed, in 16 bits or in the generated kernels.
+ * @param {LdpcDecoder *} dec the decoder context
+ * @param {float *} r output for the messages, one per edge
+ */
+void ldpcDecoderSaveMessages(LdpcDecoder *dec, float *r);
+
+/**
+ * Start the next decode from saved check node messages instead of from
+ * zero.  This is used by the next decode only, and then forgotten.
+ * The messages must stay in place until then.
+ * @param {LdpcDecoder *} dec the decoder context
+ * @param {float *} r messages from ldpcDecoderSaveMessages(), or null
+ */
+void ldpcDecoderWarmStart(LdpcDecoder *dec, float *r);
+
+/**
+ * Decode by gradient descent bit flipping.  This works on the hard
+ * decisions alone, flipping one bit at a time, the one that most improves
+ * its agreement with the channel and its checks.  It is far cheaper than
+ * message passing, and at mid to high SNR fixes the few errors there are.
+ * @param {LdpcDecoder *} dec the decoder context
+ * @param {float *} inBits message array of data from -1 -> 1
+ * @param {int} nrBits the number of values in the array
+ * @param {int} maxFlips the most bits to flip before failing
+ * @return decoded array of bits if successful, else null
+ */
+uint8_t *ldpcDecodeBF(LdpcDecoder *dec, float *inBits, int nrBits, int maxFlips);
+
+/**
+ * Decode by the cheapest stage that works: the hard decisions as they come,
+ * then bit flipping for up to bfMaxFlips flips, then, if bfFallback is set,
+ * min-sum, then, if osd is set, ordered statistics on the soft output of
+ * min-sum.  With a CRC set, a stage that ends on a codeword whose CRC is
+ * wrong goes on to the next, and the ordered statistics result must pass it.
+ * Without one, it is accepted even when osd->timedOut says that the search
+ * was cut short, so check that too if a partial search will not do.
+ * The stage that ended it is left in dec->stage, and counted in
+ * dec->stageCounts.
+ * @param {LdpcDecoder *} dec the decoder context
+ * @param {float *} inBits message array of data from -1 -> 1
+ * @param {int} nrBits the number of values in the array
+ * @param {int} maxIter the maximum number of min-sum iterations before failing
+ * @return decoded array of bits if successful, else null
+ */
+uint8_t *ldpcDecode(LdpcDecoder *dec, float *inBits, int nrBits, int maxIter);
+
 /**
  * Decode codeword bits to message bits by sum-product algorithm
  * @param {LdpcDecoder *} dec the decoder context
@@ -73,7 +303,8 @@ void ldpcDecoderDestroy(LdpcDecoder *dec);
 uint8_t *ldpcDecodeSP(LdpcDecoder *dec, float *inBits, int nrBits, int maxIter);
 
 /**
- * Decode codeword bits to message bits by min-sum algorithm
+ * Decode codeword bits to message bits by min-sum algorithm, or by
+ * self-corrected min-sum if dec->selfCorrect is set
  * @param {LdpcDecoder *} dec the decoder context
  * @param {float *} inBits message array of data from -1 -> 1
  * @param {int} nrBits the number of values in the array
@@ -82,6 +313,97 @@ uint8_t *ldpcDecodeSP(LdpcDecoder *dec, float *inBits, int nrBits, int maxIter);
  */
 uint8_t *ldpcDecodeMS(LdpcDecoder *dec, float *inBits, int nrBits, int maxIter);
 
+/**
+ * Decode by sum-product, and give the soft output as well as the hard bits.
+ * The LLRs are written for all N bits whether or not the decode succeeds,
+ * as for iterative demapping.  They are in the decoder's LLR domain, which
+ * for sum-product is twice the input, with a positive value for a 0.
+ * @param {LdpcDecoder *} dec the decoder context
+ * @param {float *} inBits message array of data from -1 -> 1
+ * @param {int} nrBits the number of values in the array
+ * @param {int} maxIter the maximum number of iterations before failing
+ * @param {float *} app output for the N posterior LLRs, ci + sum(r), or null
+ * @param {float *} ext output for the N extrinsic LLRs, sum(r), or null
+ * @return decoded array of bits if successful, else null
+ */
+uint8_t *ldpcDecodeSoftSP(LdpcDecoder *dec, float *inBits, int nrBits, int maxIter,
+	float *app, float *ext);
+
+/**
+ * Decode by min-sum, and give the soft output as well as the hard bits.
+ * As for ldpcDecodeSoftSP(), but the LLR domain is the same as the input.
+ * @param {LdpcDecoder *} dec the decoder context
+ * @param {float *} inBits message array of data from -1 -> 1
+ * @param {int} nrBits the number of values in the array
+ * @param {int} maxIter the maximum number of iterations before failing
+ * @param {float *} app output for the N posterior LLRs, ci + sum(r), or null
+ * @param {float *} ext output for the N extrinsic LLRs, sum(r), or null
+ * @return decoded array of bits if successful, else null
+ */
+uint8_t *ldpcDecodeSoftMS(LdpcDecoder *dec, float *inBits, int nrBits, int maxIter,
+	float *app, float *ext);
+
+/**
+ * Expand a punctured or erased word to N values.  Bits that were not
+ * received are given 0, which says nothing about them, rather than a
+ * value that would claim they are known.
+ * @param {LdpcDecoder *} dec the decoder context
+ * @param {float *} received the bits that were received, -1 to 1, in order
+ * @param {int} nrReceived the number of received values
+ * @param {uint8_t *} erased N flags, 1 for a bit that was not received
+ * @return {float *} the expanded word, owned by dec, or null if nrReceived
+ * does not match the mask
+ */
+float *ldpcDecoderExpand(LdpcDecoder *dec, float *received, int nrReceived, uint8_t *erased);
+
+/**
+ * Decode a punctured word by sum-product.  See ldpcDecoderExpand()
+ * @param {LdpcDecoder *} dec the decoder context
+ * @param {float *} received the bits that were received, -1 to 1, in order
+ * @param {int} nrReceived the number of received values
+ * @param {uint8_t *} erased N flags, 1 for a bit that was not received
+ * @param {int} maxIter the maximum number of iterations before failing
+ * @return decoded array of N bits if successful, else null
+ */
+uint8_t *ldpcDecodePuncturedSP(LdpcDecoder *dec, float *received, int nrReceived,
+	uint8_t *erased, int maxIter);
+
+/**
+ * Decode a punctured word by min-sum.  See ldpcDecoderExpand()
+ * @param {LdpcDecoder *} dec the decoder context
+ * @param {float *} received the bits that were received, -1 to 1, in order
+ * @param {int} nrReceived the number of received values
+ * @param {uint8_t *} erased N flags, 1 for a bit that was not received
+ * @param {int} maxIter the maximum number of iterations before failing
+ * @return decoded array of N bits if successful, else null
+ */
+uint8_t *ldpcDecodePuncturedMS(LdpcDecoder *dec, float *received, int nrReceived,
+	uint8_t *erased, int maxIter);
+
+/**
+ * Decode a shortened word by sum-product.  The last nrShortened message
+ * bits are known zeros, and are not sent.  They are pinned, and their
+ * edges are left out of the message passing.
+ * @param {LdpcDecoder *} dec the decoder context
+ * @param {float *} received the N - nrShortened bits sent, -1 to 1: the
+ * message bits that were not shortened, then the parity bits
+ * @param {int} nrShortened the number of shortened bits
+ * @param {int} maxIter the maximum number of iterations before failing
+ * @return decoded array of N bits, with the shortened bits, if successful,
+ * else null
+ */
+uint8_t *ldpcDecodeShortenedSP(LdpcDecoder *dec, float *received, int nrShortened, int maxIter);
+
+/**
+ * Decode a shortened word by min-sum.  See ldpcDecodeShortenedSP()
+ * @param {LdpcDecoder *} dec the decoder context
+ * @param {float *} received the N - nrShortened bits sent, -1 to 1
+ * @param {int} nrShortened the number of shortened bits
+ * @param {int} maxIter the maximum number of iterations before failing
+ * @return decoded array of N bits if successful, else null
+ */
+uint8_t *ldpcDecodeShortenedMS(LdpcDecoder *dec, float *received, int nrShortened, int maxIter);
+
 /**
  * Decode codeword bits into bytes. Assumes that codeword length is a multiple of 8
  * @param {LdpcDecoder} dec the decoder context
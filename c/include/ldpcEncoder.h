@@ -1,6 +1,8 @@
 #ifndef __LDPCENCODER_H__
 #define __LDPCENCODER_H__
 
+#include <stdint.h>
+
 #include "802-tables.h"
 
 #define MAX_BITS 1944
@@ -9,6 +11,7 @@ typedef struct {
 	int msgLen;
 	Code *code;
 	Table *table;
+	int ownsTable; // 0 for a clone sharing another encoder's table
 	// TODO: get the max sizes for these
 	uint8_t Ast[MAX_BITS];
 	uint8_t Cst[MAX_BITS];
@@ -32,6 +35,14 @@ extern "C" {
  */
 LdpcEncoder *ldpcEncoderCreate(Code *code);
 
+/**
+ * Create a new encoder context with its own scratch buffers, sharing the
+ * read-only tables of another.  Destroy the clone before the original.
+ * @param {LdpcEncoder *} enc the encoder to clone
+ * @return {LdpcEncoder *} a new encoder if successful, else null
+ */
+LdpcEncoder *ldpcEncoderClone(LdpcEncoder *enc);
+
 /**
  *
  */
@@ -49,10 +60,37 @@ uint8_t *ldpcEncode(LdpcEncoder *enc, uint8_t *s, int len);
  */
 uint8_t *ldpcEncodeBytes(LdpcEncoder *enc, uint8_t *bytes, int nrBytes);
 
+/**
+ * Encode a message array of bytes with its CRC32 appended, bigendian, in
+ * a single pass over the bytes.  The same as appending Crc32ofBytes() to
+ * the message and calling ldpcEncodeBytes(), but without the extra passes.
+ * @param {LdpcEncoder *} enc the encoder context
+ * @param {uint8_t *} bytes the message bytes, without the CRC
+ * @param {int} nrBytes the number of message bytes
+ * @param {uint8_t *} crcBytes output for the 4 CRC bytes, or null
+ * @return {array} array of encoded bits, size N
+ */
+uint8_t *ldpcEncodeBytesCrc(LdpcEncoder *enc, uint8_t *bytes, int nrBytes, uint8_t *crcBytes);
+
+/**
+ * Encode a buffer of messages, spreading the codewords across a number of
+ * threads.  Each thread gets its own clone of enc.  Messages shorter than
+ * code->messageBits are padded with zeros.
+ * @param {LdpcEncoder *} enc the encoder context
+ * @param {uint8_t *} bytes nrWords messages of nrBytes each, end to end
+ * @param {int} nrBytes the size of each message in bytes
+ * @param {int} nrWords the number of messages
+ * @param {uint8_t *} out output for nrWords packed codewords of N/8 bytes each
+ * @param {int} nrThreads the number of threads, <= 0 for one per processor
+ * @return {int} 1 if successful, else 0
+ */
+int ldpcEncodeBatch(LdpcEncoder *enc, uint8_t *bytes, int nrBytes, int nrWords,
+	uint8_t *out, int nrThreads);
+
 #ifdef __cplusplus  
 }  
 #endif  
 
 
 
-#endif
\ No newline at end of file
+#endif
\ No newline at end of file
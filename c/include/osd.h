@@ -0,0 +1,97 @@
+#ifndef __OSD_H__
+#define __OSD_H__
+
+#include <stdint.h>
+
+#include "802-codes.h"
+#include "802-tables.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * A bit and its reliability, for sorting
+ */
+typedef struct {
+	float rel;
+	int index;
+} OsdBit;
+
+/**
+ * Ordered statistics decoder (OSD), for another try at a word that
+ * message passing gave up on.  The bits are sorted by the size of their
+ * LLRs, H is reduced so that its pivots fall on the least reliable bits,
+ * and the rest, the most reliable basis, is taken as right.  Test patterns
+ * of up to order bits of the basis are flipped, the pivots solved for each,
+ * and the codeword nearest the LLRs is kept.
+ *
+ * A context owns all of its work space, and shares only the code, so each
+ * thread can run its own.  It is far slower than message passing, so it
+ * has a cap on test patterns and on thread CPU time, and suits a low
+ * priority thread fed with the soft output of failed decodes.
+ */
+typedef struct {
+	Code *code;
+	int order;          // the most basis bits flipped in a test pattern, 0 to 2
+	int maxCandidates;  // the most test patterns to try, 0 for no cap
+	int budgetUs;       // the most thread CPU time to use, in microseconds, 0 for no cap
+	float *llr;         // N values that the caller may fill, as the soft output of a decode
+	// results of the last call
+	int candidates;     // test patterns tried
+	int timedOut;       // 1 if the time budget ran out, even if there is a result
+	float discrepancy;  // sum of |llr| where the result differs from the hard decisions
+	// work space
+	Table *table;
+	int rowWords;       // 64-bit words in a row of H
+	int colWords;       // 64-bit words in a column of H
+	uint64_t *rows;     // H, reduced in place
+	uint64_t **rowPtr;  // the rows in their reduced order
+	int *pivots;        // the column of the pivot of each reduced row
+	int rank;
+	int *basis;         // the columns that are not pivots, least reliable first
+	int nrBasis;
+	uint64_t *cols;     // for each basis column, the reduced rows it touches
+	uint64_t *base;     // the pivots of the hard decisions that do not match
+	uint64_t *diff;
+	float *rel;         // |llr| of each bit
+	uint8_t *hard;
+	OsdBit *sorted;     // the bits, least reliable first
+	uint8_t *out;
+} LdpcOsd;
+
+/**
+ * Create a new ordered statistics decoder
+ * @param {Code *} code the code to decode
+ * @return {LdpcOsd *} a new decoder if successful, else null
+ */
+LdpcOsd *ldpcOsdCreate(Code *code);
+
+/**
+ * Clean up an ordered statistics decoder
+ * @param {LdpcOsd *} osd the decoder to destroy
+ */
+void ldpcOsdDestroy(LdpcOsd *osd);
+
+/**
+ * Find the codeword nearest to the soft values within the test patterns
+ * allowed.  The result always passes every check, so a CRC is needed to
+ * tell whether it is the word that was sent.
+ * If the budget runs out while reducing H, there is no result.  If it runs
+ * out during the test patterns, the best codeword of those tried so far is
+ * returned, with osd->timedOut set, so callers that want only a full search
+ * must check osd->timedOut as well as the result.
+ * @param {LdpcOsd *} osd the decoder context
+ * @param {float *} llr N soft values, negative for a 1, as from the soft
+ * output of the decoder.  May be osd->llr
+ * @param {int} nrBits the number of values, which must be N
+ * @return {uint8_t *} the codeword bits, or null if nrBits is wrong or the
+ * budget ran out before the test patterns
+ */
+uint8_t *ldpcOsdDecode(LdpcOsd *osd, float *llr, int nrBits);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /*__OSD_H__*/
@@ -0,0 +1,54 @@
+#ifndef __SCMS_H__
+#define __SCMS_H__
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * The most edges of a variable node in any of the 802.11n codes
+ */
+#define SCMS_MAX_DEGREE 12
+
+/**
+ * Self-corrected min-sum (SCMS) update of the messages out of one variable
+ * node.  Each new message is the posterior less the message that came in
+ * on its own edge.  A message whose sign differs from the one sent last
+ * time is erased to 0, as the node is not sure of it.  This stops the
+ * oscillation that plain min-sum has on some words.
+ *
+ * scmsUpdate() takes the best form that isaLevel() allows, see isa.h.
+ * The scalar and vector forms give bit-exact results.  The posterior is
+ * summed in the same order by both, and the rest is one subtraction and a
+ * select per edge.
+ * @param {float} ci the channel value of the node
+ * @param {float *} r the n messages into the node
+ * @param {float *} q in: the n messages out of the node last time.
+ * out: the new ones
+ * @param {int} n the number of edges, up to SCMS_MAX_DEGREE
+ * @return {float} the posterior of the node
+ */
+float scmsUpdate(float ci, float *r, float *q, int n);
+
+/**
+ * scmsUpdate() one edge at a time
+ */
+float scmsUpdateScalar(float ci, float *r, float *q, int n);
+
+/**
+ * scmsUpdate() four edges at a time with SSE2, where there is SSE2.
+ * Elsewhere the same as scmsUpdateScalar()
+ */
+float scmsUpdateVector(float ci, float *r, float *q, int n);
+
+/**
+ * scmsUpdate() eight edges at a time with AVX2, where isaLevel() allows.
+ * Elsewhere the same as scmsUpdateVector()
+ */
+float scmsUpdateAvx2(float ci, float *r, float *q, int n);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /*__SCMS_H__*/
@@ -0,0 +1,73 @@
+#ifndef __SCRAMBLER_H__
+#define __SCRAMBLER_H__
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * The 802.11 data scrambler, x^7 + x^4 + 1.  The 127-bit sequence is
+ * kept as 127 bytes (8 periods), so that whole bytes and words can be
+ * scrambled at a time.
+ */
+typedef struct {
+	int seed;   // initial state, 1 to 127
+	int pos;    // current byte position within the 127-byte period
+	uint8_t txMask[127 + 8]; // sequence as bigendian bytes, with 8 bytes of wrap
+	uint8_t rxMask[127 + 8]; // txMask with the bits of each byte reversed
+} Scrambler;
+
+/**
+ * Create a new scrambler
+ * @param {int} seed the initial state of the shift register, 1 to 127
+ * @return {Scrambler *} a new scrambler if successful, else null
+ */
+Scrambler *scramblerCreate(int seed);
+
+/**
+ * Clean up a scrambler
+ * @param {Scrambler *} s the scrambler to destroy
+ */
+void scramblerDestroy(Scrambler *s);
+
+/**
+ * Start the sequence over from the seed, as at the start of a PPDU
+ * @param {Scrambler *} s the scrambler
+ */
+void scramblerReset(Scrambler *s);
+
+/**
+ * Move the sequence along without scrambling anything, as when
+ * received bytes are lost
+ * @param {Scrambler *} s the scrambler
+ * @param {int} len the number of bytes to skip
+ */
+void scramblerSkip(Scrambler *s, int len);
+
+/**
+ * Scramble bytes for transmission.  802.11 sends each byte LSB first, so
+ * the output bytes are bit-reversed, then XORed with the sequence.  The
+ * result is in the bigendian bit order the encoder expects.
+ * @param {Scrambler *} s the scrambler
+ * @param {uint8_t *} out output buffer for len bytes.  May be the same as in
+ * @param {uint8_t *} in the bytes to scramble
+ * @param {int} len the number of bytes
+ */
+void scramblerScramble(Scrambler *s, uint8_t *out, uint8_t *in, int len);
+
+/**
+ * Undo scramblerScramble() on received bytes
+ * @param {Scrambler *} s the scrambler
+ * @param {uint8_t *} out output buffer for len bytes.  May be the same as in
+ * @param {uint8_t *} in the bytes to descramble
+ * @param {int} len the number of bytes
+ */
+void scramblerDescramble(Scrambler *s, uint8_t *out, uint8_t *in, int len);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /*__SCRAMBLER_H__*/
@@ -0,0 +1,87 @@
+#ifndef __SYNDROME_H__
+#define __SYNDROME_H__
+
+#include <stdint.h>
+
+#include "802-codes.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * The most QC block columns of any code
+ */
+#define SYNDROME_MAX_NB 24
+
+/**
+ * One QC block column of hard decisions, bit k for column k of the block.
+ * The largest z is 81, so one 128-bit word holds a block.
+ */
+typedef unsigned __int128 QcWord;
+
+/**
+ * Pack an array of hard bits into one word per block column
+ * @param {QcWord *} words output for code->nb words
+ * @param {Code *} code the code
+ * @param {uint8_t *} bits array of N bits, each a 1 or 0
+ */
+void syndromePack(QcWord *words, Code *code, uint8_t *bits);
+
+/**
+ * Slice soft values to hard bits, and pack them.  Negative is a 1.
+ * By the widest vectors that isaLevel() allows, see isa.h
+ * @param {QcWord *} words output for code->nb words
+ * @param {Code *} code the code
+ * @param {float *} soft array of N soft values
+ * @param {uint8_t *} bits output for the N hard bits, or null
+ */
+void syndromePackSoft(QcWord *words, Code *code, float *soft, uint8_t *bits);
+
+/**
+ * Check a packed word against H, a whole block row at a time.
+ * Stops at the first block row that fails.
+ * @param {Code *} code the code
+ * @param {QcWord *} words the packed word, from syndromePack()
+ * @return {int} 1 if the syndrome is all zero, else 0
+ */
+int syndromeCheck(Code *code, QcWord *words);
+
+/**
+ * Count the unsatisfied checks of a packed word
+ * @param {Code *} code the code
+ * @param {QcWord *} words the packed word, from syndromePack()
+ * @return {int} the number of rows of H that fail, 0 to M
+ */
+int syndromeCount(Code *code, QcWord *words);
+
+/**
+ * Get the parity of every check of a packed word
+ * @param {Code *} code the code
+ * @param {QcWord *} words the packed word, from syndromePack()
+ * @param {uint8_t *} parity output for M parities, 1 for a failing check
+ * @return {int} the number of rows of H that fail, 0 to M
+ */
+int syndromeRows(Code *code, QcWord *words, uint8_t *parity);
+
+/**
+ * Pack an array of hard bits and check it
+ * @param {Code *} code the code
+ * @param {uint8_t *} bits array of N bits
+ * @return {int} 1 if the syndrome is all zero, else 0
+ */
+int syndromeCheckBits(Code *code, uint8_t *bits);
+
+/**
+ * Pack an array of hard bits and count its unsatisfied checks
+ * @param {Code *} code the code
+ * @param {uint8_t *} bits array of N bits
+ * @return {int} the number of rows of H that fail, 0 to M
+ */
+int syndromeCountBits(Code *code, uint8_t *bits);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /*__SYNDROME_H__*/
@@ -28,21 +28,70 @@ void substituteSparse(uint8_t y[], int *sparseArr[],  int slen, uint8_t *arr);
 
 /**
  * Convert an array of bytes to an array of bits. Bigendian.
- * The output array is 8x the size of the input, each element a 1 or 0
+ * The output array is 8x the size of the input, each element a 1 or 0.
+ * With BMI2, where isaLevel() allows, a byte goes at a time
  * @param {uint8_t *} bits output buffer for bits
  * @param {uint8_t *} bytes array of bytes
  * @param {int} len number of bytes
  */
 void bytesToBitsBE(uint8_t *bits, uint8_t *bytes, int len);
 
+/**
+ * Convert a range of bits within an array of bytes to an array of bits.
+ * Bigendian.  The range need not start or end on a byte boundary.
+ * @param {uint8_t *} bits output buffer for nrBits bits
+ * @param {uint8_t *} bytes array of bytes
+ * @param {int} bitOffset index of the first bit to take
+ * @param {int} nrBits number of bits to take
+ */
+void extractBitsBE(uint8_t *bits, uint8_t *bytes, int bitOffset, int nrBits);
+
 /** 
- * Assumes bits length is multiple of 8
+ * Convert an array of bits to an array of bytes.  Bigendian.
+ * If len is not a multiple of 8, the last bits go in the top of the last byte.
+ * With BMI2, where isaLevel() allows, eight bits go at a time
  * @param {uint8_t *} output buffer for bytes
- * @param {uint8_t *} bits array of bits
+ * @param {uint8_t *} bits array of bits, each a 1 or 0
  * @param {int} len number of bits
  */
 void bitsToBytesBE(uint8_t *bytes, uint8_t *bits, int len);
 
+/**
+ * Exclusive-or two byte arrays, as for adding GF(2) vectors held a bit
+ * to a byte.  The output may be one of the inputs.
+ * @param {uint8_t *} out output for len bytes
+ * @param {uint8_t *} a first array
+ * @param {uint8_t *} b second array
+ * @param {int} len number of bytes
+ */
+void xorBytes(uint8_t *out, uint8_t *a, uint8_t *b, int len);
+
+/**
+ * Add a rotated block into another, as for one cell of a quasi-cyclic
+ * matrix: out[r] ^= in[(r + shift) % z]
+ * @param {uint8_t *} out output block of z bytes
+ * @param {uint8_t *} in input block of z bytes
+ * @param {int} shift the rotation of the cell, 0 to z - 1
+ * @param {int} z the size of a qc cell
+ */
+void xorRotate(uint8_t *out, uint8_t *in, int shift, int z);
+
+/**
+ * Multiply a subblock of a quasi-cyclic matrix with a binary array, a cell
+ * at a time, without expanding it into sparse rows
+ * @param {uint8_t *} out output for height * z bytes
+ * @param {int *} qc the source quasi-cyclic matrices in a single array
+ * @param {int} qcWidth the width of a qc row of the qc table
+ * @param {int} xoff the x-offset of the subblock in the qc table
+ * @param {int} yoff the y-offset of the subblock in the qc table
+ * @param {int} width the width of the subblock in the qc table
+ * @param {int} height the height of the subblock in the qc table
+ * @param {int} z the size of a qc cell
+ * @param {uint8_t *} arr column vector of width * z bytes
+ */
+void multiplyQc(uint8_t *out, int *qc, int qcWidth, int xoff, int yoff,
+		int width, int height, int z, uint8_t *arr);
+
 /**
  * Calculate the "phi" function over the range 0-7
  * @param x the input value
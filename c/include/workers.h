@@ -0,0 +1,39 @@
+#ifndef __WORKERS_H__
+#define __WORKERS_H__
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * A job slice to be run on one worker thread
+ * @param {void *} ctx the caller's context, shared by all workers
+ * @param {int} worker the index of this worker, 0 to nrWorkers-1
+ * @param {int} start the first job of this slice
+ * @param {int} end one past the last job of this slice
+ */
+typedef void (*WorkerFunc)(void *ctx, int worker, int start, int end);
+
+/**
+ * Get the number of workers to use when the caller does not say
+ * @return {int} the number of online processors, at least 1
+ */
+int workersCount(void);
+
+/**
+ * Split the jobs 0 to nrJobs-1 into nrWorkers contiguous slices, and run
+ * each slice on its own thread.  The calling thread runs the first slice
+ * itself, and returns when all of the slices are done.  If a thread cannot
+ * be started, its slice is run on the calling thread instead.
+ * @param {WorkerFunc} func the function to run for each slice
+ * @param {void *} ctx context passed to each call of func
+ * @param {int} nrJobs the number of jobs
+ * @param {int} nrWorkers the number of slices.  Must be 1 to nrJobs
+ */
+void workersRun(WorkerFunc func, void *ctx, int nrJobs, int nrWorkers);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /*__WORKERS_H__*/
@@ -0,0 +1,402 @@
+/**
+ * Generate src/802-kernels.c, a row-layered min-sum kernel for each layer
+ * of each code, with z, the block columns, their shifts and the degree of
+ * the layer as constants.  The edge loop of each check node unrolls fully,
+ * and each edge's place in the posteriors is a constant base and a wrap.
+ * Each layer also gets AVX2 and AVX-512 forms, which take 8 or 16 check
+ * nodes at once.  The check nodes of a layer share no variables, so lane
+ * l of edge k reads the posterior one on from lane l - 1, which is a plain
+ * load, or a gather where the shift wraps within the vector.
+ *
+ *     make kernels
+ */
+#include <stdio.h>
+
+#include "802-codes.h"
+#include "802-kernels.h"
+
+static const char *preamble =
+	"/**\n"
+	" * Row-layered min-sum kernels, one per layer of each code.\n"
+	" * Generated by misc/kernelgen.c.  Do not edit, run make kernels.\n"
+	" */\n"
+	"#include <stdint.h>\n"
+	"#include <math.h>\n"
+	"\n"
+	"#include \"802-kernels.h\"\n"
+	"#include \"isa.h\"\n"
+	"\n"
+	"#ifdef ISA_X86\n"
+	"#include <immintrin.h>\n"
+	"#endif\n"
+	"\n"
+	"\n"
+	"/**\n"
+	" * Min-sum update of one check node of n edges, where n is a constant,\n"
+	" * so that both loops unroll.  Its message on edge k is r[k * z]\n"
+	" */\n"
+	"static inline __attribute__((always_inline)) void minSum(float **v, float *r, const int n,\n"
+	"\t\tconst int z) {\n"
+	"\tfloat q[KERNEL_MAX_DEGREE];\n"
+	"\tfloat min1 = 1000.0f;\n"
+	"\tfloat min2 = 1000.0f;\n"
+	"\tint minPos = -1;\n"
+	"\tuint32_t signs = 0;\n"
+	"#pragma GCC unroll 22\n"
+	"\tfor (int k = 0; k < n; k++) {\n"
+	"\t\tq[k] = *v[k] - r[k * z];\n"
+	"\t\tfloat c = q[k] < -20.0f ? -20.0f : q[k] > 20.0f ? 20.0f : q[k];\n"
+	"\t\tfloat mag = fabsf(c);\n"
+	"\t\tsigns |= (uint32_t)(c < 0.0f) << k;\n"
+	"\t\tif (mag < min1) {\n"
+	"\t\t\tmin2 = min1;\n"
+	"\t\t\tmin1 = mag;\n"
+	"\t\t\tminPos = k;\n"
+	"\t\t} else if (mag < min2) {\n"
+	"\t\t\tmin2 = mag;\n"
+	"\t\t}\n"
+	"\t}\n"
+	"\tuint32_t parity = __builtin_parity(signs);\n"
+	"#pragma GCC unroll 22\n"
+	"\tfor (int k = 0; k < n; k++) {\n"
+	"\t\tfloat mag = k == minPos ? min2 : min1;\n"
+	"\t\tr[k * z] = ((parity ^ (signs >> k)) & 1) ? -mag : mag;\n"
+	"\t\t*v[k] = q[k] + r[k * z];\n"
+	"\t}\n"
+	"}\n"
+	"\n"
+	"#ifdef ISA_X86\n"
+	"/**\n"
+	" * minSum() over all z check nodes of a layer, 8 at a time.  Edge k of\n"
+	" * check node i is on posterior base[k] + (i + shift[k]) % z.  The same\n"
+	" * arithmetic, in the same order, lane by lane\n"
+	" */\n"
+	"static inline __attribute__((always_inline, target(\"avx2\"))) void minSumAvx2(float *post,\n"
+	"\t\tfloat *r, const int z, const int n, const int *base, const int *shift) {\n"
+	"\tconst __m256i lane = _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7);\n"
+	"\tconst __m256 signBit = _mm256_set1_ps(-0.0f);\n"
+	"\t__m256 q[KERNEL_MAX_DEGREE];\n"
+	"\t__m256i idx[KERNEL_MAX_DEGREE];\n"
+	"\tfor (int i = 0; i < z; i += 8) {\n"
+	"\t\tint lanes = z - i < 8 ? z - i : 8;\n"
+	"\t\t__m256i valid = _mm256_cmpgt_epi32(_mm256_set1_epi32(lanes), lane);\n"
+	"\t\t__m256 min1 = _mm256_set1_ps(1000.0f);\n"
+	"\t\t__m256 min2 = _mm256_set1_ps(1000.0f);\n"
+	"\t\t__m256i minPos = _mm256_set1_epi32(-1);\n"
+	"\t\t__m256i signs = _mm256_setzero_si256();\n"
+	"#pragma GCC unroll 22\n"
+	"\t\tfor (int k = 0; k < n; k++) {\n"
+	"\t\t\tint col = i + shift[k] < z ? i + shift[k] : i + shift[k] - z;\n"
+	"\t\t\t__m256 v;\n"
+	"\t\t\tif (lanes == 8 && col + 8 <= z) {\n"
+	"\t\t\t\tidx[k] = _mm256_set1_epi32(-1);\n"
+	"\t\t\t\tv = _mm256_loadu_ps(post + base[k] + col);\n"
+	"\t\t\t} else {\n"
+	"\t\t\t\t__m256i c = _mm256_add_epi32(_mm256_set1_epi32(col), lane);\n"
+	"\t\t\t\tc = _mm256_sub_epi32(c, _mm256_and_si256(_mm256_set1_epi32(z),\n"
+	"\t\t\t\t\t_mm256_cmpgt_epi32(c, _mm256_set1_epi32(z - 1))));\n"
+	"\t\t\t\tidx[k] = _mm256_add_epi32(c, _mm256_set1_epi32(base[k]));\n"
+	"\t\t\t\tv = _mm256_mask_i32gather_ps(_mm256_setzero_ps(), post, idx[k],\n"
+	"\t\t\t\t\t_mm256_castsi256_ps(valid), 4);\n"
+	"\t\t\t}\n"
+	"\t\t\t__m256 rk = _mm256_maskload_ps(r + k * z + i, valid);\n"
+	"\t\t\tq[k] = _mm256_sub_ps(v, rk);\n"
+	"\t\t\t__m256 c = _mm256_min_ps(_mm256_max_ps(q[k], _mm256_set1_ps(-20.0f)),\n"
+	"\t\t\t\t_mm256_set1_ps(20.0f));\n"
+	"\t\t\t__m256 mag = _mm256_andnot_ps(signBit, c);\n"
+	"\t\t\t__m256 neg = _mm256_cmp_ps(c, _mm256_setzero_ps(), _CMP_LT_OQ);\n"
+	"\t\t\tsigns = _mm256_or_si256(signs,\n"
+	"\t\t\t\t_mm256_slli_epi32(_mm256_srli_epi32(_mm256_castps_si256(neg), 31), k));\n"
+	"\t\t\t__m256 lt1 = _mm256_cmp_ps(mag, min1, _CMP_LT_OQ);\n"
+	"\t\t\t__m256 lt2 = _mm256_cmp_ps(mag, min2, _CMP_LT_OQ);\n"
+	"\t\t\tmin2 = _mm256_blendv_ps(_mm256_blendv_ps(min2, mag, lt2), min1, lt1);\n"
+	"\t\t\tmin1 = _mm256_blendv_ps(min1, mag, lt1);\n"
+	"\t\t\tminPos = _mm256_castps_si256(_mm256_blendv_ps(_mm256_castsi256_ps(minPos),\n"
+	"\t\t\t\t_mm256_castsi256_ps(_mm256_set1_epi32(k)), lt1));\n"
+	"\t\t}\n"
+	"\t\t__m256i parity = _mm256_xor_si256(signs, _mm256_srli_epi32(signs, 16));\n"
+	"\t\tparity = _mm256_xor_si256(parity, _mm256_srli_epi32(parity, 8));\n"
+	"\t\tparity = _mm256_xor_si256(parity, _mm256_srli_epi32(parity, 4));\n"
+	"\t\tparity = _mm256_xor_si256(parity, _mm256_srli_epi32(parity, 2));\n"
+	"\t\tparity = _mm256_xor_si256(parity, _mm256_srli_epi32(parity, 1));\n"
+	"#pragma GCC unroll 22\n"
+	"\t\tfor (int k = 0; k < n; k++) {\n"
+	"\t\t\t__m256 isMin = _mm256_castsi256_ps(_mm256_cmpeq_epi32(minPos, _mm256_set1_epi32(k)));\n"
+	"\t\t\t__m256 mag = _mm256_blendv_ps(min1, min2, isMin);\n"
+	"\t\t\t__m256i neg = _mm256_slli_epi32(_mm256_xor_si256(parity, _mm256_srli_epi32(signs, k)), 31);\n"
+	"\t\t\t__m256 rk = _mm256_xor_ps(mag, _mm256_castsi256_ps(neg));\n"
+	"\t\t\t__m256 v = _mm256_add_ps(q[k], rk);\n"
+	"\t\t\t_mm256_maskstore_ps(r + k * z + i, valid, rk);\n"
+	"\t\t\tint col = i + shift[k] < z ? i + shift[k] : i + shift[k] - z;\n"
+	"\t\t\tif (lanes == 8 && col + 8 <= z) {\n"
+	"\t\t\t\t_mm256_storeu_ps(post + base[k] + col, v);\n"
+	"\t\t\t} else {\n"
+	"\t\t\t\t// no scatter before AVX-512\n"
+	"\t\t\t\tfloat out[8];\n"
+	"\t\t\t\tint at[8];\n"
+	"\t\t\t\t_mm256_storeu_ps(out, v);\n"
+	"\t\t\t\t_mm256_storeu_si256((__m256i *)at, idx[k]);\n"
+	"\t\t\t\tfor (int l = 0; l < lanes; l++) {\n"
+	"\t\t\t\t\tpost[at[l]] = out[l];\n"
+	"\t\t\t\t}\n"
+	"\t\t\t}\n"
+	"\t\t}\n"
+	"\t}\n"
+	"}\n"
+	"\n"
+	"/**\n"
+	" * As minSumAvx2(), 16 at a time, with masks for the last few and\n"
+	" * scatters where the shift wraps\n"
+	" */\n"
+	"static inline __attribute__((always_inline, target(\"avx512f\"))) void minSumAvx512(float *post,\n"
+	"\t\tfloat *r, const int z, const int n, const int *base, const int *shift) {\n"
+	"\tconst __m512i lane = _mm512_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7,\n"
+	"\t\t8, 9, 10, 11, 12, 13, 14, 15);\n"
+	"\tconst __m512i signBit = _mm512_set1_epi32((int)0x80000000);\n"
+	"\t__m512 q[KERNEL_MAX_DEGREE];\n"
+	"\tfor (int i = 0; i < z; i += 16) {\n"
+	"\t\tint lanes = z - i < 16 ? z - i : 16;\n"
+	"\t\t__mmask16 valid = (__mmask16)((1u << lanes) - 1);\n"
+	"\t\t__m512 min1 = _mm512_set1_ps(1000.0f);\n"
+	"\t\t__m512 min2 = _mm512_set1_ps(1000.0f);\n"
+	"\t\t__m512i minPos = _mm512_set1_epi32(-1);\n"
+	"\t\t__m512i signs = _mm512_setzero_si512();\n"
+	"#pragma GCC unroll 22\n"
+	"\t\tfor (int k = 0; k < n; k++) {\n"
+	"\t\t\tint col = i + shift[k] < z ? i + shift[k] : i + shift[k] - z;\n"
+	"\t\t\t__m512 v;\n"
+	"\t\t\tif (col + lanes <= z) {\n"
+	"\t\t\t\tv = _mm512_maskz_loadu_ps(valid, post + base[k] + col);\n"
+	"\t\t\t} else {\n"
+	"\t\t\t\t__m512i c = _mm512_add_epi32(_mm512_set1_epi32(col), lane);\n"
+	"\t\t\t\tc = _mm512_mask_sub_epi32(c, _mm512_cmpge_epi32_mask(c, _mm512_set1_epi32(z)),\n"
+	"\t\t\t\t\tc, _mm512_set1_epi32(z));\n"
+	"\t\t\t\tc = _mm512_add_epi32(c, _mm512_set1_epi32(base[k]));\n"
+	"\t\t\t\tv = _mm512_mask_i32gather_ps(_mm512_setzero_ps(), valid, c, post, 4);\n"
+	"\t\t\t}\n"
+	"\t\t\t__m512 rk = _mm512_maskz_loadu_ps(valid, r + k * z + i);\n"
+	"\t\t\tq[k] = _mm512_sub_ps(v, rk);\n"
+	"\t\t\t__m512 c = _mm512_min_ps(_mm512_max_ps(q[k], _mm512_set1_ps(-20.0f)),\n"
+	"\t\t\t\t_mm512_set1_ps(20.0f));\n"
+	"\t\t\t__m512 mag = _mm512_castsi512_ps(_mm512_andnot_si512(signBit, _mm512_castps_si512(c)));\n"
+	"\t\t\t__mmask16 neg = _mm512_cmp_ps_mask(c, _mm512_setzero_ps(), _CMP_LT_OQ);\n"
+	"\t\t\tsigns = _mm512_mask_or_epi32(signs, neg, signs, _mm512_set1_epi32(1 << k));\n"
+	"\t\t\t__mmask16 lt1 = _mm512_cmp_ps_mask(mag, min1, _CMP_LT_OQ);\n"
+	"\t\t\t__mmask16 lt2 = _mm512_cmp_ps_mask(mag, min2, _CMP_LT_OQ);\n"
+	"\t\t\tmin2 = _mm512_mask_blend_ps(lt1, _mm512_mask_blend_ps(lt2, min2, mag), min1);\n"
+	"\t\t\tmin1 = _mm512_mask_blend_ps(lt1, min1, mag);\n"
+	"\t\t\tminPos = _mm512_mask_mov_epi32(minPos, lt1, _mm512_set1_epi32(k));\n"
+	"\t\t}\n"
+	"\t\t__m512i parity = _mm512_xor_si512(signs, _mm512_srli_epi32(signs, 16));\n"
+	"\t\tparity = _mm512_xor_si512(parity, _mm512_srli_epi32(parity, 8));\n"
+	"\t\tparity = _mm512_xor_si512(parity, _mm512_srli_epi32(parity, 4));\n"
+	"\t\tparity = _mm512_xor_si512(parity, _mm512_srli_epi32(parity, 2));\n"
+	"\t\tparity = _mm512_xor_si512(parity, _mm512_srli_epi32(parity, 1));\n"
+	"#pragma GCC unroll 22\n"
+	"\t\tfor (int k = 0; k < n; k++) {\n"
+	"\t\t\t__mmask16 isMin = _mm512_cmpeq_epi32_mask(minPos, _mm512_set1_epi32(k));\n"
+	"\t\t\t__m512 mag = _mm512_mask_blend_ps(isMin, min1, min2);\n"
+	"\t\t\t__m512i neg = _mm512_slli_epi32(_mm512_xor_si512(parity, _mm512_srli_epi32(signs, k)), 31);\n"
+	"\t\t\t__m512 rk = _mm512_castsi512_ps(_mm512_xor_si512(_mm512_castps_si512(mag), neg));\n"
+	"\t\t\t__m512 v = _mm512_add_ps(q[k], rk);\n"
+	"\t\t\t_mm512_mask_storeu_ps(r + k * z + i, valid, rk);\n"
+	"\t\t\tint col = i + shift[k] < z ? i + shift[k] : i + shift[k] - z;\n"
+	"\t\t\tif (col + lanes <= z) {\n"
+	"\t\t\t\t_mm512_mask_storeu_ps(post + base[k] + col, valid, v);\n"
+	"\t\t\t} else {\n"
+	"\t\t\t\t__m512i c = _mm512_add_epi32(_mm512_set1_epi32(col), lane);\n"
+	"\t\t\t\tc = _mm512_mask_sub_epi32(c, _mm512_cmpge_epi32_mask(c, _mm512_set1_epi32(z)),\n"
+	"\t\t\t\t\tc, _mm512_set1_epi32(z));\n"
+	"\t\t\t\tc = _mm512_add_epi32(c, _mm512_set1_epi32(base[k]));\n"
+	"\t\t\t\t_mm512_mask_i32scatter_ps(post, valid, c, v, 4);\n"
+	"\t\t\t}\n"
+	"\t\t}\n"
+	"\t}\n"
+	"}\n"
+	"#endif\n"
+	"\n";
+
+typedef struct {
+	const char *name;
+	Code *code;
+} NamedCode;
+
+static NamedCode codes[] = {
+	{ "c12_648", &c12_648 },
+	{ "c12_1296", &c12_1296 },
+	{ "c12_1944", &c12_1944 },
+	{ "c23_648", &c23_648 },
+	{ "c23_1296", &c23_1296 },
+	{ "c23_1944", &c23_1944 },
+	{ "c34_648", &c34_648 },
+	{ "c34_1296", &c34_1296 },
+	{ "c34_1944", &c34_1944 },
+	{ "c56_648", &c56_648 },
+	{ "c56_1296", &c56_1296 },
+	{ "c56_1944", &c56_1944 }
+};
+
+#define NR_CODES (int)(sizeof(codes) / sizeof(codes[0]))
+
+static int layerDegree(Code *code, int layer) {
+	int degree = 0;
+	for (int j = 0; j < code->nb; j++) {
+		degree += code->Hb[layer * code->nb + j] >= 0;
+	}
+	return degree;
+}
+
+/**
+ * Print the kernel of one layer.  Check node i of the layer has an edge on
+ * column j * z + (i + shift) % z of each block column j that it touches
+ */
+static void printLayer(NamedCode *nc, int layer) {
+	Code *code = nc->code;
+	int z = code->z;
+	int degree = layerDegree(code, layer);
+	printf("static void %s_%d(float *post, float *r) {\n", nc->name, layer);
+	printf("\tfloat *v[%d];\n", degree);
+	printf("\tfor (int i = 0; i < %d; i++) {\n", z);
+	int k = 0;
+	for (int j = 0; j < code->nb; j++) {
+		int shift = code->Hb[layer * code->nb + j];
+		if (shift < 0) {
+			continue;
+		}
+		if (shift == 0) {
+			printf("\t\tv[%d] = post + %d + i;\n", k, j * z);
+		} else {
+			printf("\t\tv[%d] = post + %d + (i < %d ? i + %d : i - %d);\n",
+				k, j * z, z - shift, shift, z - shift);
+		}
+		k++;
+	}
+	printf("\t\tminSum(v, r + i, %d, %d);\n", degree, z);
+	printf("\t}\n");
+	printf("}\n\n");
+}
+
+/**
+ * Print the AVX2 and AVX-512 forms of the kernel of one layer
+ */
+static void printLayerVector(NamedCode *nc, int layer) {
+	Code *code = nc->code;
+	int z = code->z;
+	int degree = layerDegree(code, layer);
+	const char *forms[] = { "Avx2", "Avx512" };
+	const char *targets[] = { "avx2", "avx512f" };
+	const char *suffixes[] = { "avx2", "avx512" };
+	for (int f = 0; f < 2; f++) {
+		printf("__attribute__((target(\"%s\")))\n", targets[f]);
+		printf("static void %s_%d_%s(float *post, float *r) {\n", nc->name, layer, suffixes[f]);
+		printf("\tstatic const int base[%d] = {", degree);
+		int k = 0;
+		for (int j = 0; j < code->nb; j++) {
+			if (code->Hb[layer * code->nb + j] >= 0) {
+				printf("%s%d", k++ ? ", " : " ", j * z);
+			}
+		}
+		printf(" };\n");
+		printf("\tstatic const int shift[%d] = {", degree);
+		k = 0;
+		for (int j = 0; j < code->nb; j++) {
+			int shift = code->Hb[layer * code->nb + j];
+			if (shift >= 0) {
+				printf("%s%d", k++ ? ", " : " ", shift % z);
+			}
+		}
+		printf(" };\n");
+		printf("\tminSum%s(post, r, %d, %d, base, shift);\n", forms[f], z, degree);
+		printf("}\n\n");
+	}
+}
+
+static void printCode(NamedCode *nc) {
+	Code *code = nc->code;
+	printf("/* ############################################################\n");
+	printf("### %s\n", nc->name);
+	printf("############################################################ */\n\n");
+	for (int layer = 0; layer < code->mb; layer++) {
+		printLayer(nc, layer);
+	}
+	printf("#ifdef ISA_X86\n");
+	for (int layer = 0; layer < code->mb; layer++) {
+		printLayerVector(nc, layer);
+	}
+	printf("#endif\n\n");
+}
+
+/**
+ * Print the kernels of a code, as a list of function names
+ */
+static void printNames(NamedCode *nc, const char *suffix) {
+	printf("\t\t{");
+	for (int layer = 0; layer < nc->code->mb; layer++) {
+		printf("%s", layer ? "," : "");
+		printf("%s%s_%d%s", layer % 4 ? " " : "\n\t\t\t", nc->name, layer, suffix);
+	}
+	printf("\n\t\t}");
+}
+
+static void printTable(void) {
+	printf("static LdpcKernel kernels[] = {\n");
+	for (int c = 0; c < NR_CODES; c++) {
+		Code *code = codes[c].code;
+		int offset = 0;
+		printf("\t{\n");
+		printf("\t\t&%s,\n", codes[c].name);
+		int nrEdges = 0;
+		for (int layer = 0; layer < code->mb; layer++) {
+			nrEdges += layerDegree(code, layer) * code->z;
+		}
+		printf("\t\t%d, // nrEdges\n", nrEdges);
+		printf("\t\t{");
+		for (int layer = 0; layer < code->mb; layer++) {
+			printf("%s%d", layer ? ", " : " ", offset);
+			offset += layerDegree(code, layer) * code->z;
+		}
+		printf(" },\n");
+		printNames(&codes[c], "");
+		printf(",\n#ifdef ISA_X86\n");
+		printNames(&codes[c], "_avx2");
+		printf(",\n");
+		printNames(&codes[c], "_avx512");
+		printf("\n#endif\n");
+		printf("\t}%s\n", c < NR_CODES - 1 ? "," : "");
+	}
+	printf("};\n\n");
+	printf("/**\n");
+	printf(" * Find the generated kernels of a code\n");
+	printf(" */\n");
+	printf("LdpcKernel *ldpcKernelFind(Code *code) {\n");
+	printf("\tfor (int c = 0; c < %d; c++) {\n", NR_CODES);
+	printf("\t\tif (kernels[c].code == code) {\n");
+	printf("\t\t\treturn &kernels[c];\n");
+	printf("\t\t}\n");
+	printf("\t}\n");
+	printf("\treturn (LdpcKernel *)0;\n");
+	printf("}\n\n");
+	printf("/**\n");
+	printf(" * Pick the widest form of the kernels that isaLevel() allows\n");
+	printf(" */\n");
+	printf("LayerKernel *ldpcKernelLayers(LdpcKernel *kernel) {\n");
+	printf("#ifdef ISA_X86\n");
+	printf("\tIsaLevel level = isaLevel();\n");
+	printf("\tif (level >= ISA_AVX512) {\n");
+	printf("\t\treturn kernel->avx512;\n");
+	printf("\t} else if (level >= ISA_AVX2) {\n");
+	printf("\t\treturn kernel->avx2;\n");
+	printf("\t}\n");
+	printf("#endif\n");
+	printf("\treturn kernel->layers;\n");
+	printf("}\n");
+}
+
+int main(int argc, char **argv) {
+	printf("%s\n", preamble);
+	for (int c = 0; c < NR_CODES; c++) {
+		printCode(&codes[c]);
+	}
+	printTable();
+	return 0;
+}
@@ -0,0 +1,46 @@
+/**
+ * Print the layer schedule of each code for a row-layered decoder: the
+ * layer order with the fewest read-after-write stalls between layers,
+ * the stalls against the natural order, and the block column order
+ * within each layer.
+ *
+ *     make tools && obj/layerorder
+ */
+#include <stdio.h>
+
+#include "802-codes.h"
+#include "layers.h"
+
+static void printCode(const char *name, Code *code) {
+	LayerSchedule natural;
+	LayerSchedule best;
+	layerScheduleInit(&natural, code, 0);
+	layerScheduleInit(&best, code, 1);
+	printf("%s  mb=%d nb=%d  stalls: natural %d, optimized %d\n", name,
+		code->mb, code->nb, natural.stalls, best.stalls);
+	for (int k = 0; k < best.nrLayers; k++) {
+		int layer = best.order[k];
+		int next = best.order[(k + 1) % best.nrLayers];
+		printf("    layer %2d (shares %d with next):", layer, layerOverlap(code, layer, next));
+		for (int j = 0; j < best.nrColumns[layer]; j++) {
+			printf(" %d", best.columns[layer][j]);
+		}
+		printf("\n");
+	}
+}
+
+int main(int argc, char **argv) {
+	printCode("c12_648", &c12_648);
+	printCode("c12_1296", &c12_1296);
+	printCode("c12_1944", &c12_1944);
+	printCode("c23_648", &c23_648);
+	printCode("c23_1296", &c23_1296);
+	printCode("c23_1944", &c23_1944);
+	printCode("c34_648", &c34_648);
+	printCode("c34_1296", &c34_1296);
+	printCode("c34_1944", &c34_1944);
+	printCode("c56_648", &c56_648);
+	printCode("c56_1296", &c56_1296);
+	printCode("c56_1944", &c56_1944);
+	return 0;
+}
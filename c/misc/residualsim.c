@@ -0,0 +1,117 @@
+/**
+ * Simulate BPSK over AWGN to compare the residual schedule with flooding,
+ * in check node updates, in frame errors and in time.  For each Eb/N0, the
+ * same noisy frames are decoded by each.  The residual schedule is for
+ * sum-product only, so min-sum is run by flooding alone, for reference.
+ *
+ *     make sim && obj/residualsim [frames]
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <math.h>
+#include <time.h>
+
+#include "ldpcEncoder.h"
+#include "ldpcDecoder.h"
+
+#define MAX_ITER 50
+
+static uint32_t seed = 12345;
+
+static float urand(void) {
+	seed = seed * 1664525 + 1013904223;
+	return ((seed >> 8) + 0.5f) / 16777216.0f;
+}
+
+/**
+ * Box-Muller
+ */
+static float grand(void) {
+	float u1 = urand();
+	float u2 = urand();
+	return sqrtf(-2.0f * logf(u1)) * cosf(6.2831853f * u2);
+}
+
+static double now(void) {
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+int main(int argc, char **argv) {
+	int nrFrames = argc > 1 ? atoi(argv[1]) : 2000;
+	Code *code = &c12_1296;
+	int N = code->N;
+	int M = N - code->messageBits;
+	int K = code->messageBits;
+	float rate = (float) K / N;
+	float ebn0s[] = { 1.0f, 1.5f, 2.0f, 2.5f };
+	LdpcSchedule schedules[] = { LDPC_SCHEDULE_FLOODING, LDPC_SCHEDULE_RESIDUAL };
+	const char *names[] = { "flood", "resid" };
+	const char *algos[] = { "MS", "SP" };
+
+	LdpcEncoder *enc = ldpcEncoderCreate(code);
+	LdpcDecoder *dec = ldpcDecoderCreate(code);
+	uint8_t *msg = (uint8_t *) malloc(K * sizeof(uint8_t));
+	float *frames = (float *) malloc((size_t) nrFrames * N * sizeof(float));
+	uint8_t *words = (uint8_t *) malloc((size_t) nrFrames * N * sizeof(uint8_t));
+
+	printf("code N=%d rate=%.2f, %d frames, maxIter %d\n", N, rate, nrFrames, MAX_ITER);
+	printf("Eb/N0  algo  schedule  FER      avg updates  avg updates ok  time(ms)\n");
+	for (int e = 0; e < (int)(sizeof(ebn0s) / sizeof(float)); e++) {
+		float ebn0 = powf(10.0f, ebn0s[e] / 10.0f);
+		float sigma = sqrtf(1.0f / (2.0f * rate * ebn0));
+		for (int f = 0; f < nrFrames; f++) {
+			for (int i = 0; i < K; i++) {
+				msg[i] = urand() < 0.5f;
+			}
+			uint8_t *x = ldpcEncode(enc, msg, K);
+			float *frame = frames + (size_t) f * N;
+			for (int i = 0; i < N; i++) {
+				words[(size_t) f * N + i] = x[i];
+				frame[i] = (x[i] ? -1.0f : 1.0f) + sigma * grand();
+			}
+		}
+		for (int a = 0; a < 2; a++) {
+			for (int s = 0; s < 2; s++) {
+				if (!a && schedules[s] == LDPC_SCHEDULE_RESIDUAL) {
+					continue;
+				}
+				dec->schedule = schedules[s];
+				int errors = 0;
+				long updates = 0;
+				long okUpdates = 0;
+				double start = now();
+				for (int f = 0; f < nrFrames; f++) {
+					float *frame = frames + (size_t) f * N;
+					uint8_t *res = a ? ldpcDecodeSP(dec, frame, N, MAX_ITER) :
+						ldpcDecodeMS(dec, frame, N, MAX_ITER);
+					// flooding updates every check node each iteration
+					long count = dec->schedule == LDPC_SCHEDULE_RESIDUAL ?
+						dec->updates : (long) dec->iterations * M;
+					updates += count;
+					int ok = res != 0;
+					for (int i = 0; ok && i < K; i++) {
+						ok = res[i] == words[(size_t) f * N + i];
+					}
+					errors += !ok;
+					if (ok) {
+						okUpdates += count;
+					}
+				}
+				double ms = (now() - start) * 1000.0;
+				int good = nrFrames - errors;
+				printf("%4.1f   %-4s  %-8s  %.5f  %11.0f  %14.0f  %8.1f\n", ebn0s[e], algos[a],
+					names[s], (double) errors / nrFrames, (double) updates / nrFrames,
+					good ? (double) okUpdates / good : 0.0, ms);
+			}
+		}
+	}
+	ldpcEncoderDestroy(enc);
+	ldpcDecoderDestroy(dec);
+	free(msg);
+	free(frames);
+	free(words);
+	return 0;
+}
@@ -0,0 +1,102 @@
+/**
+ * Simulate BPSK over AWGN to see what the stall limit of the decoder
+ * saves, and what it costs in frame errors.  For each Eb/N0, the same
+ * noisy frames are decoded with each stall limit.
+ *
+ *     make sim && obj/stallsim [frames]
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <math.h>
+#include <time.h>
+
+#include "ldpcEncoder.h"
+#include "ldpcDecoder.h"
+
+#define MAX_ITER 50
+
+static uint32_t seed = 12345;
+
+static float urand(void) {
+	seed = seed * 1664525 + 1013904223;
+	return ((seed >> 8) + 0.5f) / 16777216.0f;
+}
+
+/**
+ * Box-Muller
+ */
+static float grand(void) {
+	float u1 = urand();
+	float u2 = urand();
+	return sqrtf(-2.0f * logf(u1)) * cosf(6.2831853f * u2);
+}
+
+static double now(void) {
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+int main(int argc, char **argv) {
+	int nrFrames = argc > 1 ? atoi(argv[1]) : 2000;
+	Code *code = &c12_648;
+	int N = code->N;
+	int K = code->messageBits;
+	float rate = (float) K / N;
+	float ebn0s[] = { 0.5f, 1.0f, 1.5f, 2.0f, 2.5f };
+	int limits[] = { 0, 20, 15, 10 };
+	int nrLimits = 4;
+
+	LdpcEncoder *enc = ldpcEncoderCreate(code);
+	LdpcDecoder *dec = ldpcDecoderCreate(code);
+	uint8_t *msg = (uint8_t *) malloc(K * sizeof(uint8_t));
+	float *frames = (float *) malloc((size_t) nrFrames * N * sizeof(float));
+	uint8_t *words = (uint8_t *) malloc((size_t) nrFrames * N * sizeof(uint8_t));
+
+	printf("code N=%d rate=%.2f, %d frames, maxIter %d, min-sum\n", N, rate, nrFrames, MAX_ITER);
+	printf("Eb/N0  stall    FER      avg iter  time(ms)  stalled\n");
+	for (int e = 0; e < (int)(sizeof(ebn0s) / sizeof(float)); e++) {
+		float ebn0 = powf(10.0f, ebn0s[e] / 10.0f);
+		float sigma = sqrtf(1.0f / (2.0f * rate * ebn0));
+		for (int f = 0; f < nrFrames; f++) {
+			for (int i = 0; i < K; i++) {
+				msg[i] = urand() < 0.5f;
+			}
+			uint8_t *x = ldpcEncode(enc, msg, K);
+			float *frame = frames + (size_t) f * N;
+			for (int i = 0; i < N; i++) {
+				words[(size_t) f * N + i] = x[i];
+				frame[i] = (x[i] ? -1.0f : 1.0f) + sigma * grand();
+			}
+		}
+		for (int l = 0; l < nrLimits; l++) {
+			dec->stallLimit = limits[l];
+			int errors = 0;
+			int stalled = 0;
+			long iterations = 0;
+			double start = now();
+			for (int f = 0; f < nrFrames; f++) {
+				uint8_t *res = ldpcDecodeMS(dec, frames + (size_t) f * N, N, MAX_ITER);
+				iterations += dec->iterations;
+				if (dec->status == LDPC_STALLED) {
+					stalled++;
+				}
+				int ok = res != 0;
+				for (int i = 0; ok && i < K; i++) {
+					ok = res[i] == words[(size_t) f * N + i];
+				}
+				errors += !ok;
+			}
+			double ms = (now() - start) * 1000.0;
+			printf("%4.1f   %5d   %.5f   %7.2f  %8.1f  %7d\n", ebn0s[e], limits[l],
+				(double) errors / nrFrames, (double) iterations / nrFrames, ms, stalled);
+		}
+	}
+	ldpcEncoderDestroy(enc);
+	ldpcDecoderDestroy(dec);
+	free(msg);
+	free(frames);
+	free(words);
+	return 0;
+}
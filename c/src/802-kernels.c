@@ -0,0 +1,3468 @@
+/**
+ * Row-layered min-sum kernels, one per layer of each code.
+ * Generated by misc/kernelgen.c.  Do not edit, run make kernels.
+ */
+#include <stdint.h>
+#include <math.h>
+
+#include "802-kernels.h"
+#include "isa.h"
+
+#ifdef ISA_X86
+#include <immintrin.h>
+#endif
+
+
+/**
+ * Min-sum update of one check node of n edges, where n is a constant,
+ * so that both loops unroll.  Its message on edge k is r[k * z]
+ */
+static inline __attribute__((always_inline)) void minSum(float **v, float *r, const int n,
+		const int z) {
+	float q[KERNEL_MAX_DEGREE];
+	float min1 = 1000.0f;
+	float min2 = 1000.0f;
+	int minPos = -1;
+	uint32_t signs = 0;
+#pragma GCC unroll 22
+	for (int k = 0; k < n; k++) {
+		q[k] = *v[k] - r[k * z];
+		float c = q[k] < -20.0f ? -20.0f : q[k] > 20.0f ? 20.0f : q[k];
+		float mag = fabsf(c);
+		signs |= (uint32_t)(c < 0.0f) << k;
+		if (mag < min1) {
+			min2 = min1;
+			min1 = mag;
+			minPos = k;
+		} else if (mag < min2) {
+			min2 = mag;
+		}
+	}
+	uint32_t parity = __builtin_parity(signs);
+#pragma GCC unroll 22
+	for (int k = 0; k < n; k++) {
+		float mag = k == minPos ? min2 : min1;
+		r[k * z] = ((parity ^ (signs >> k)) & 1) ? -mag : mag;
+		*v[k] = q[k] + r[k * z];
+	}
+}
+
+#ifdef ISA_X86
+/**
+ * minSum() over all z check nodes of a layer, 8 at a time.  Edge k of
+ * check node i is on posterior base[k] + (i + shift[k]) % z.  The same
+ * arithmetic, in the same order, lane by lane
+ */
+static inline __attribute__((always_inline, target("avx2"))) void minSumAvx2(float *post,
+		float *r, const int z, const int n, const int *base, const int *shift) {
+	const __m256i lane = _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7);
+	const __m256 signBit = _mm256_set1_ps(-0.0f);
+	__m256 q[KERNEL_MAX_DEGREE];
+	__m256i idx[KERNEL_MAX_DEGREE];
+	for (int i = 0; i < z; i += 8) {
+		int lanes = z - i < 8 ? z - i : 8;
+		__m256i valid = _mm256_cmpgt_epi32(_mm256_set1_epi32(lanes), lane);
+		__m256 min1 = _mm256_set1_ps(1000.0f);
+		__m256 min2 = _mm256_set1_ps(1000.0f);
+		__m256i minPos = _mm256_set1_epi32(-1);
+		__m256i signs = _mm256_setzero_si256();
+#pragma GCC unroll 22
+		for (int k = 0; k < n; k++) {
+			int col = i + shift[k] < z ? i + shift[k] : i + shift[k] - z;
+			__m256 v;
+			if (lanes == 8 && col + 8 <= z) {
+				idx[k] = _mm256_set1_epi32(-1);
+				v = _mm256_loadu_ps(post + base[k] + col);
+			} else {
+				__m256i c = _mm256_add_epi32(_mm256_set1_epi32(col), lane);
+				c = _mm256_sub_epi32(c, _mm256_and_si256(_mm256_set1_epi32(z),
+					_mm256_cmpgt_epi32(c, _mm256_set1_epi32(z - 1))));
+				idx[k] = _mm256_add_epi32(c, _mm256_set1_epi32(base[k]));
+				v = _mm256_mask_i32gather_ps(_mm256_setzero_ps(), post, idx[k],
+					_mm256_castsi256_ps(valid), 4);
+			}
+			__m256 rk = _mm256_maskload_ps(r + k * z + i, valid);
+			q[k] = _mm256_sub_ps(v, rk);
+			__m256 c = _mm256_min_ps(_mm256_max_ps(q[k], _mm256_set1_ps(-20.0f)),
+				_mm256_set1_ps(20.0f));
+			__m256 mag = _mm256_andnot_ps(signBit, c);
+			__m256 neg = _mm256_cmp_ps(c, _mm256_setzero_ps(), _CMP_LT_OQ);
+			signs = _mm256_or_si256(signs,
+				_mm256_slli_epi32(_mm256_srli_epi32(_mm256_castps_si256(neg), 31), k));
+			__m256 lt1 = _mm256_cmp_ps(mag, min1, _CMP_LT_OQ);
+			__m256 lt2 = _mm256_cmp_ps(mag, min2, _CMP_LT_OQ);
+			min2 = _mm256_blendv_ps(_mm256_blendv_ps(min2, mag, lt2), min1, lt1);
+			min1 = _mm256_blendv_ps(min1, mag, lt1);
+			minPos = _mm256_castps_si256(_mm256_blendv_ps(_mm256_castsi256_ps(minPos),
+				_mm256_castsi256_ps(_mm256_set1_epi32(k)), lt1));
+		}
+		__m256i parity = _mm256_xor_si256(signs, _mm256_srli_epi32(signs, 16));
+		parity = _mm256_xor_si256(parity, _mm256_srli_epi32(parity, 8));
+		parity = _mm256_xor_si256(parity, _mm256_srli_epi32(parity, 4));
+		parity = _mm256_xor_si256(parity, _mm256_srli_epi32(parity, 2));
+		parity = _mm256_xor_si256(parity, _mm256_srli_epi32(parity, 1));
+#pragma GCC unroll 22
+		for (int k = 0; k < n; k++) {
+			__m256 isMin = _mm256_castsi256_ps(_mm256_cmpeq_epi32(minPos, _mm256_set1_epi32(k)));
+			__m256 mag = _mm256_blendv_ps(min1, min2, isMin);
+			__m256i neg = _mm256_slli_epi32(_mm256_xor_si256(parity, _mm256_srli_epi32(signs, k)), 31);
+			__m256 rk = _mm256_xor_ps(mag, _mm256_castsi256_ps(neg));
+			__m256 v = _mm256_add_ps(q[k], rk);
+			_mm256_maskstore_ps(r + k * z + i, valid, rk);
+			int col = i + shift[k] < z ? i + shift[k] : i + shift[k] - z;
+			if (lanes == 8 && col + 8 <= z) {
+				_mm256_storeu_ps(post + base[k] + col, v);
+			} else {
+				// no scatter before AVX-512
+				float out[8];
+				int at[8];
+				_mm256_storeu_ps(out, v);
+				_mm256_storeu_si256((__m256i *)at, idx[k]);
+				for (int l = 0; l < lanes; l++) {
+					post[at[l]] = out[l];
+				}
+			}
+		}
+	}
+}
+
+/**
+ * As minSumAvx2(), 16 at a time, with masks for the last few and
+ * scatters where the shift wraps
+ */
+static inline __attribute__((always_inline, target("avx512f"))) void minSumAvx512(float *post,
+		float *r, const int z, const int n, const int *base, const int *shift) {
+	const __m512i lane = _mm512_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7,
+		8, 9, 10, 11, 12, 13, 14, 15);
+	const __m512i signBit = _mm512_set1_epi32((int)0x80000000);
+	__m512 q[KERNEL_MAX_DEGREE];
+	for (int i = 0; i < z; i += 16) {
+		int lanes = z - i < 16 ? z - i : 16;
+		__mmask16 valid = (__mmask16)((1u << lanes) - 1);
+		__m512 min1 = _mm512_set1_ps(1000.0f);
+		__m512 min2 = _mm512_set1_ps(1000.0f);
+		__m512i minPos = _mm512_set1_epi32(-1);
+		__m512i signs = _mm512_setzero_si512();
+#pragma GCC unroll 22
+		for (int k = 0; k < n; k++) {
+			int col = i + shift[k] < z ? i + shift[k] : i + shift[k] - z;
+			__m512 v;
+			if (col + lanes <= z) {
+				v = _mm512_maskz_loadu_ps(valid, post + base[k] + col);
+			} else {
+				__m512i c = _mm512_add_epi32(_mm512_set1_epi32(col), lane);
+				c = _mm512_mask_sub_epi32(c, _mm512_cmpge_epi32_mask(c, _mm512_set1_epi32(z)),
+					c, _mm512_set1_epi32(z));
+				c = _mm512_add_epi32(c, _mm512_set1_epi32(base[k]));
+				v = _mm512_mask_i32gather_ps(_mm512_setzero_ps(), valid, c, post, 4);
+			}
+			__m512 rk = _mm512_maskz_loadu_ps(valid, r + k * z + i);
+			q[k] = _mm512_sub_ps(v, rk);
+			__m512 c = _mm512_min_ps(_mm512_max_ps(q[k], _mm512_set1_ps(-20.0f)),
+				_mm512_set1_ps(20.0f));
+			__m512 mag = _mm512_castsi512_ps(_mm512_andnot_si512(signBit, _mm512_castps_si512(c)));
+			__mmask16 neg = _mm512_cmp_ps_mask(c, _mm512_setzero_ps(), _CMP_LT_OQ);
+			signs = _mm512_mask_or_epi32(signs, neg, signs, _mm512_set1_epi32(1 << k));
+			__mmask16 lt1 = _mm512_cmp_ps_mask(mag, min1, _CMP_LT_OQ);
+			__mmask16 lt2 = _mm512_cmp_ps_mask(mag, min2, _CMP_LT_OQ);
+			min2 = _mm512_mask_blend_ps(lt1, _mm512_mask_blend_ps(lt2, min2, mag), min1);
+			min1 = _mm512_mask_blend_ps(lt1, min1, mag);
+			minPos = _mm512_mask_mov_epi32(minPos, lt1, _mm512_set1_epi32(k));
+		}
+		__m512i parity = _mm512_xor_si512(signs, _mm512_srli_epi32(signs, 16));
+		parity = _mm512_xor_si512(parity, _mm512_srli_epi32(parity, 8));
+		parity = _mm512_xor_si512(parity, _mm512_srli_epi32(parity, 4));
+		parity = _mm512_xor_si512(parity, _mm512_srli_epi32(parity, 2));
+		parity = _mm512_xor_si512(parity, _mm512_srli_epi32(parity, 1));
+#pragma GCC unroll 22
+		for (int k = 0; k < n; k++) {
+			__mmask16 isMin = _mm512_cmpeq_epi32_mask(minPos, _mm512_set1_epi32(k));
+			__m512 mag = _mm512_mask_blend_ps(isMin, min1, min2);
+			__m512i neg = _mm512_slli_epi32(_mm512_xor_si512(parity, _mm512_srli_epi32(signs, k)), 31);
+			__m512 rk = _mm512_castsi512_ps(_mm512_xor_si512(_mm512_castps_si512(mag), neg));
+			__m512 v = _mm512_add_ps(q[k], rk);
+			_mm512_mask_storeu_ps(r + k * z + i, valid, rk);
+			int col = i + shift[k] < z ? i + shift[k] : i + shift[k] - z;
+			if (col + lanes <= z) {
+				_mm512_mask_storeu_ps(post + base[k] + col, valid, v);
+			} else {
+				__m512i c = _mm512_add_epi32(_mm512_set1_epi32(col), lane);
+				c = _mm512_mask_sub_epi32(c, _mm512_cmpge_epi32_mask(c, _mm512_set1_epi32(z)),
+					c, _mm512_set1_epi32(z));
+				c = _mm512_add_epi32(c, _mm512_set1_epi32(base[k]));
+				_mm512_mask_i32scatter_ps(post, valid, c, v, 4);
+			}
+		}
+	}
+}
+#endif
+
+
+/* ############################################################
+### c12_648
+############################################################ */
+
+static void c12_648_0(float *post, float *r) {
+	float *v[7];
+	for (int i = 0; i < 27; i++) {
+		v[0] = post + 0 + i;
+		v[1] = post + 108 + i;
+		v[2] = post + 135 + i;
+		v[3] = post + 216 + i;
+		v[4] = post + 297 + i;
+		v[5] = post + 324 + (i < 26 ? i + 1 : i - 26);
+		v[6] = post + 351 + i;
+		minSum(v, r + i, 7, 27);
+	}
+}
+
+static void c12_648_1(float *post, float *r) {
+	float *v[8];
+	for (int i = 0; i < 27; i++) {
+		v[0] = post + 0 + (i < 5 ? i + 22 : i - 5);
+		v[1] = post + 27 + i;
+		v[2] = post + 108 + (i < 10 ? i + 17 : i - 10);
+		v[3] = post + 162 + i;
+		v[4] = post + 189 + i;
+		v[5] = post + 216 + (i < 15 ? i + 12 : i - 15);
+		v[6] = post + 351 + i;
+		v[7] = post + 378 + i;
+		minSum(v, r + i, 8, 27);
+	}
+}
+
+static void c12_648_2(float *post, float *r) {
+	float *v[7];
+	for (int i = 0; i < 27; i++) {
+		v[0] = post + 0 + (i < 21 ? i + 6 : i - 21);
+		v[1] = post + 54 + i;
+		v[2] = post + 108 + (i < 17 ? i + 10 : i - 17);
+		v[3] = post + 216 + (i < 3 ? i + 24 : i - 3);
+		v[4] = post + 270 + i;
+		v[5] = post + 378 + i;
+		v[6] = post + 405 + i;
+		minSum(v, r + i, 7, 27);
+	}
+}
+
+static void c12_648_3(float *post, float *r) {
+	float *v[7];
+	for (int i = 0; i < 27; i++) {
+		v[0] = post + 0 + (i < 25 ? i + 2 : i - 25);
+		v[1] = post + 81 + i;
+		v[2] = post + 108 + (i < 7 ? i + 20 : i - 7);
+		v[3] = post + 216 + (i < 2 ? i + 25 : i - 2);
+		v[4] = post + 243 + i;
+		v[5] = post + 405 + i;
+		v[6] = post + 432 + i;
+		minSum(v, r + i, 7, 27);
+	}
+}
+
+static void c12_648_4(float *post, float *r) {
+	float *v[7];
+	for (int i = 0; i < 27; i++) {
+		v[0] = post + 0 + (i < 4 ? i + 23 : i - 4);
+		v[1] = post + 108 + (i < 24 ? i + 3 : i - 24);
+		v[2] = post + 216 + i;
+		v[3] = post + 270 + (i < 18 ? i + 9 : i - 18);
+		v[4] = post + 297 + (i < 16 ? i + 11 : i - 16);
+		v[5] = post + 432 + i;
+		v[6] = post + 459 + i;
+		minSum(v, r + i, 7, 27);
+	}
+}
+
+static void c12_648_5(float *post, float *r) {
+	float *v[8];
+	for (int i = 0; i < 27; i++) {
+		v[0] = post + 0 + (i < 3 ? i + 24 : i - 3);
+		v[1] = post + 54 + (i < 4 ? i + 23 : i - 4);
+		v[2] = post + 81 + (i < 26 ? i + 1 : i - 26);
+		v[3] = post + 108 + (i < 10 ? i + 17 : i - 10);
+		v[4] = post + 162 + (i < 24 ? i + 3 : i - 24);
+		v[5] = post + 216 + (i < 17 ? i + 10 : i - 17);
+		v[6] = post + 459 + i;
+		v[7] = post + 486 + i;
+		minSum(v, r + i, 8, 27);
+	}
+}
+
+static void c12_648_6(float *post, float *r) {
+	float *v[7];
+	for (int i = 0; i < 27; i++) {
+		v[0] = post + 0 + (i < 2 ? i + 25 : i - 2);
+		v[1] = post + 108 + (i < 19 ? i + 8 : i - 19);
+		v[2] = post + 216 + (i < 20 ? i + 7 : i - 20);
+		v[3] = post + 243 + (i < 9 ? i + 18 : i - 9);
+		v[4] = post + 324 + i;
+		v[5] = post + 486 + i;
+		v[6] = post + 513 + i;
+		minSum(v, r + i, 7, 27);
+	}
+}
+
+static void c12_648_7(float *post, float *r) {
+	float *v[7];
+	for (int i = 0; i < 27; i++) {
+		v[0] = post + 0 + (i < 14 ? i + 13 : i - 14);
+		v[1] = post + 27 + (i < 3 ? i + 24 : i - 3);
+		v[2] = post + 108 + i;
+		v[3] = post + 162 + (i < 19 ? i + 8 : i - 19);
+		v[4] = post + 216 + (i < 21 ? i + 6 : i - 21);
+		v[5] = post + 513 + i;
+		v[6] = post + 540 + i;
+		minSum(v, r + i, 7, 27);
+	}
+}
+
+static void c12_648_8(float *post, float *r) {
+	float *v[8];
+	for (int i = 0; i < 27; i++) {
+		v[0] = post + 0 + (i < 20 ? i + 7 : i - 20);
+		v[1] = post + 27 + (i < 7 ? i + 20 : i - 7);
+		v[2] = post + 81 + (i < 11 ? i + 16 : i - 11);
+		v[3] = post + 108 + (i < 5 ? i + 22 : i - 5);
+		v[4] = post + 135 + (i < 17 ? i + 10 : i - 17);
+		v[5] = post + 216 + (i < 4 ? i + 23 : i - 4);
+		v[6] = post + 540 + i;
+		v[7] = post + 567 + i;
+		minSum(v, r + i, 8, 27);
+	}
+}
+
+static void c12_648_9(float *post, float *r) {
+	float *v[7];
+	for (int i = 0; i < 27; i++) {
+		v[0] = post + 0 + (i < 16 ? i + 11 : i - 16);
+		v[1] = post + 108 + (i < 8 ? i + 19 : i - 8);
+		v[2] = post + 216 + (i < 14 ? i + 13 : i - 14);
+		v[3] = post + 270 + (i < 24 ? i + 3 : i - 24);
+		v[4] = post + 297 + (i < 10 ? i + 17 : i - 10);
+		v[5] = post + 567 + i;
+		v[6] = post + 594 + i;
+		minSum(v, r + i, 7, 27);
+	}
+}
+
+static void c12_648_10(float *post, float *r) {
+	float *v[8];
+	for (int i = 0; i < 27; i++) {
+		v[0] = post + 0 + (i < 2 ? i + 25 : i - 2);
+		v[1] = post + 54 + (i < 19 ? i + 8 : i - 19);
+		v[2] = post + 108 + (i < 4 ? i + 23 : i - 4);
+		v[3] = post + 135 + (i < 9 ? i + 18 : i - 9);
+		v[4] = post + 189 + (i < 13 ? i + 14 : i - 13);
+		v[5] = post + 216 + (i < 18 ? i + 9 : i - 18);
+		v[6] = post + 594 + i;
+		v[7] = post + 621 + i;
+		minSum(v, r + i, 8, 27);
+	}
+}
+
+static void c12_648_11(float *post, float *r) {
+	float *v[7];
+	for (int i = 0; i < 27; i++) {
+		v[0] = post + 0 + (i < 24 ? i + 3 : i - 24);
+		v[1] = post + 108 + (i < 11 ? i + 16 : i - 11);
+		v[2] = post + 189 + (i < 25 ? i + 2 : i - 25);
+		v[3] = post + 216 + (i < 2 ? i + 25 : i - 2);
+		v[4] = post + 243 + (i < 22 ? i + 5 : i - 22);
+		v[5] = post + 324 + (i < 26 ? i + 1 : i - 26);
+		v[6] = post + 621 + i;
+		minSum(v, r + i, 7, 27);
+	}
+}
+
+#ifdef ISA_X86
+__attribute__((target("avx2")))
+static void c12_648_0_avx2(float *post, float *r) {
+	static const int base[7] = { 0, 108, 135, 216, 297, 324, 351 };
+	static const int shift[7] = { 0, 0, 0, 0, 0, 1, 0 };
+	minSumAvx2(post, r, 27, 7, base, shift);
+}
+
+__attribute__((target("avx512f")))
+static void c12_648_0_avx512(float *post, float *r) {
+	static const int base[7] = { 0, 108, 135, 216, 297, 324, 351 };
+	static const int shift[7] = { 0, 0, 0, 0, 0, 1, 0 };
+	minSumAvx512(post, r, 27, 7, base, shift);
+}
+
+__attribute__((target("avx2")))
+static void c12_648_1_avx2(float *post, float *r) {
+	static const int base[8] = { 0, 27, 108, 162, 189, 216, 351, 378 };
+	static const int shift[8] = { 22, 0, 17, 0, 0, 12, 0, 0 };
+	minSumAvx2(post, r, 27, 8, base, shift);
+}
+
+__attribute__((target("avx512f")))
+static void c12_648_1_avx512(float *post, float *r) {
+	static const int base[8] = { 0, 27, 108, 162, 189, 216, 351, 378 };
+	static const int shift[8] = { 22, 0, 17, 0, 0, 12, 0, 0 };
+	minSumAvx512(post, r, 27, 8, base, shift);
+}
+
+__attribute__((target("avx2")))
+static void c12_648_2_avx2(float *post, float *r) {
+	static const int base[7] = { 0, 54, 108, 216, 270, 378, 405 };
+	static const int shift[7] = { 6, 0, 10, 24, 0, 0, 0 };
+	minSumAvx2(post, r, 27, 7, base, shift);
+}
+
+__attribute__((target("avx512f")))
+static void c12_648_2_avx512(float *post, float *r) {
+	static const int base[7] = { 0, 54, 108, 216, 270, 378, 405 };
+	static const int shift[7] = { 6, 0, 10, 24, 0, 0, 0 };
+	minSumAvx512(post, r, 27, 7, base, shift);
+}
+
+__attribute__((target("avx2")))
+static void c12_648_3_avx2(float *post, float *r) {
+	static const int base[7] = { 0, 81, 108, 216, 243, 405, 432 };
+	static const int shift[7] = { 2, 0, 20, 25, 0, 0, 0 };
+	minSumAvx2(post, r, 27, 7, base, shift);
+}
+
+__attribute__((target("avx512f")))
+static void c12_648_3_avx512(float *post, float *r) {
+	static const int base[7] = { 0, 81, 108, 216, 243, 405, 432 };
+	static const int shift[7] = { 2, 0, 20, 25, 0, 0, 0 };
+	minSumAvx512(post, r, 27, 7, base, shift);
+}
+
+__attribute__((target("avx2")))
+static void c12_648_4_avx2(float *post, float *r) {
+	static const int base[7] = { 0, 108, 216, 270, 297, 432, 459 };
+	static const int shift[7] = { 23, 3, 0, 9, 11, 0, 0 };
+	minSumAvx2(post, r, 27, 7, base, shift);
+}
+
+__attribute__((target("avx512f")))
+static void c12_648_4_avx512(float *post, float *r) {
+	static const int base[7] = { 0, 108, 216, 270, 297, 432, 459 };
+	static const int shift[7] = { 23, 3, 0, 9, 11, 0, 0 };
+	minSumAvx512(post, r, 27, 7, base, shift);
+}
+
+__attribute__((target("avx2")))
+static void c12_648_5_avx2(float *post, float *r) {
+	static const int base[8] = { 0, 54, 81, 108, 162, 216, 459, 486 };
+	static const int shift[8] = { 24, 23, 1, 17, 3, 10, 0, 0 };
+	minSumAvx2(post, r, 27, 8, base, shift);
+}
+
+__attribute__((target("avx512f")))
+static void c12_648_5_avx512(float *post, float *r) {
+	static const int base[8] = { 0, 54, 81, 108, 162, 216, 459, 486 };
+	static const int shift[8] = { 24, 23, 1, 17, 3, 10, 0, 0 };
+	minSumAvx512(post, r, 27, 8, base, shift);
+}
+
+__attribute__((target("avx2")))
+static void c12_648_6_avx2(float *post, float *r) {
+	static const int base[7] = { 0, 108, 216, 243, 324, 486, 513 };
+	static const int shift[7] = { 25, 8, 7, 18, 0, 0, 0 };
+	minSumAvx2(post, r, 27, 7, base, shift);
+}
+
+__attribute__((target("avx512f")))
+static void c12_648_6_avx512(float *post, float *r) {
+	static const int base[7] = { 0, 108, 216, 243, 324, 486, 513 };
+	static const int shift[7] = { 25, 8, 7, 18, 0, 0, 0 };
+	minSumAvx512(post, r, 27, 7, base, shift);
+}
+
+__attribute__((target("avx2")))
+static void c12_648_7_avx2(float *post, float *r) {
+	static const int base[7] = { 0, 27, 108, 162, 216, 513, 540 };
+	static const int shift[7] = { 13, 24, 0, 8, 6, 0, 0 };
+	minSumAvx2(post, r, 27, 7, base, shift);
+}
+
+__attribute__((target("avx512f")))
+static void c12_648_7_avx512(float *post, float *r) {
+	static const int base[7] = { 0, 27, 108, 162, 216, 513, 540 };
+	static const int shift[7] = { 13, 24, 0, 8, 6, 0, 0 };
+	minSumAvx512(post, r, 27, 7, base, shift);
+}
+
+__attribute__((target("avx2")))
+static void c12_648_8_avx2(float *post, float *r) {
+	static const int base[8] = { 0, 27, 81, 108, 135, 216, 540, 567 };
+	static const int shift[8] = { 7, 20, 16, 22, 10, 23, 0, 0 };
+	minSumAvx2(post, r, 27, 8, base, shift);
+}
+
+__attribute__((target("avx512f")))
+static void c12_648_8_avx512(float *post, float *r) {
+	static const int base[8] = { 0, 27, 81, 108, 135, 216, 540, 567 };
+	static const int shift[8] = { 7, 20, 16, 22, 10, 23, 0, 0 };
+	minSumAvx512(post, r, 27, 8, base, shift);
+}
+
+__attribute__((target("avx2")))
+static void c12_648_9_avx2(float *post, float *r) {
+	static const int base[7] = { 0, 108, 216, 270, 297, 567, 594 };
+	static const int shift[7] = { 11, 19, 13, 3, 17, 0, 0 };
+	minSumAvx2(post, r, 27, 7, base, shift);
+}
+
+__attribute__((target("avx512f")))
+static void c12_648_9_avx512(float *post, float *r) {
+	static const int base[7] = { 0, 108, 216, 270, 297, 567, 594 };
+	static const int shift[7] = { 11, 19, 13, 3, 17, 0, 0 };
+	minSumAvx512(post, r, 27, 7, base, shift);
+}
+
+__attribute__((target("avx2")))
+static void c12_648_10_avx2(float *post, float *r) {
+	static const int base[8] = { 0, 54, 108, 135, 189, 216, 594, 621 };
+	static const int shift[8] = { 25, 8, 23, 18, 14, 9, 0, 0 };
+	minSumAvx2(post, r, 27, 8, base, shift);
+}
+
+__attribute__((target("avx512f")))
+static void c12_648_10_avx512(float *post, float *r) {
+	static const int base[8] = { 0, 54, 108, 135, 189, 216, 594, 621 };
+	static const int shift[8] = { 25, 8, 23, 18, 14, 9, 0, 0 };
+	minSumAvx512(post, r, 27, 8, base, shift);
+}
+
+__attribute__((target("avx2")))
+static void c12_648_11_avx2(float *post, float *r) {
+	static const int base[7] = { 0, 108, 189, 216, 243, 324, 621 };
+	static const int shift[7] = { 3, 16, 2, 25, 5, 1, 0 };
+	minSumAvx2(post, r, 27, 7, base, shift);
+}
+
+__attribute__((target("avx512f")))
+static void c12_648_11_avx512(float *post, float *r) {
+	static const int base[7] = { 0, 108, 189, 216, 243, 324, 621 };
+	static const int shift[7] = { 3, 16, 2, 25, 5, 1, 0 };
+	minSumAvx512(post, r, 27, 7, base, shift);
+}
+
+#endif
+
+/* ############################################################
+### c12_1296
+############################################################ */
+
+static void c12_1296_0(float *post, float *r) {
+	float *v[7];
+	for (int i = 0; i < 54; i++) {
+		v[0] = post + 0 + (i < 14 ? i + 40 : i - 14);
+		v[1] = post + 216 + (i < 32 ? i + 22 : i - 32);
+		v[2] = post + 324 + (i < 5 ? i + 49 : i - 5);
+		v[3] = post + 378 + (i < 31 ? i + 23 : i - 31);
+		v[4] = post + 432 + (i < 11 ? i + 43 : i - 11);
+		v[5] = post + 648 + (i < 53 ? i + 1 : i - 53);
+		v[6] = post + 702 + i;
+		minSum(v, r + i, 7, 54);
+	}
+}
+
+static void c12_1296_1(float *post, float *r) {
+	float *v[8];
+	for (int i = 0; i < 54; i++) {
+		v[0] = post + 0 + (i < 4 ? i + 50 : i - 4);
+		v[1] = post + 54 + (i < 53 ? i + 1 : i - 53);
+		v[2] = post + 216 + (i < 6 ? i + 48 : i - 6);
+		v[3] = post + 270 + (i < 19 ? i + 35 : i - 19);
+		v[4] = post + 432 + (i < 41 ? i + 13 : i - 41);
+		v[5] = post + 540 + (i < 24 ? i + 30 : i - 24);
+		v[6] = post + 702 + i;
+		v[7] = post + 756 + i;
+		minSum(v, r + i, 8, 54);
+	}
+}
+
+static void c12_1296_2(float *post, float *r) {
+	float *v[7];
+	for (int i = 0; i < 54; i++) {
+		v[0] = post + 0 + (i < 15 ? i + 39 : i - 15);
+		v[1] = post + 54 + (i < 4 ? i + 50 : i - 4);
+		v[2] = post + 216 + (i < 50 ? i + 4 : i - 50);
+		v[3] = post + 324 + (i < 52 ? i + 2 : i - 52);
+		v[4] = post + 594 + (i < 5 ? i + 49 : i - 5);
+		v[5] = post + 756 + i;
+		v[6] = post + 810 + i;
+		minSum(v, r + i, 7, 54);
+	}
+}
+
+static void c12_1296_3(float *post, float *r) {
+	float *v[7];
+	for (int i = 0; i < 54; i++) {
+		v[0] = post + 0 + (i < 21 ? i + 33 : i - 21);
+		v[1] = post + 162 + (i < 16 ? i + 38 : i - 16);
+		v[2] = post + 216 + (i < 17 ? i + 37 : i - 17);
+		v[3] = post + 378 + (i < 50 ? i + 4 : i - 50);
+		v[4] = post + 432 + (i < 53 ? i + 1 : i - 53);
+		v[5] = post + 810 + i;
+		v[6] = post + 864 + i;
+		minSum(v, r + i, 7, 54);
+	}
+}
+
+static void c12_1296_4(float *post, float *r) {
+	float *v[7];
+	for (int i = 0; i < 54; i++) {
+		v[0] = post + 0 + (i < 9 ? i + 45 : i - 9);
+		v[1] = post + 216 + i;
+		v[2] = post + 270 + (i < 32 ? i + 22 : i - 32);
+		v[3] = post + 432 + (i < 34 ? i + 20 : i - 34);
+		v[4] = post + 486 + (i < 12 ? i + 42 : i - 12);
+		v[5] = post + 864 + i;
+		v[6] = post + 918 + i;
+		minSum(v, r + i, 7, 54);
+	}
+}
+
+static void c12_1296_5(float *post, float *r) {
+	float *v[7];
+	for (int i = 0; i < 54; i++) {
+		v[0] = post + 0 + (i < 3 ? i + 51 : i - 3);
+		v[1] = post + 162 + (i < 6 ? i + 48 : i - 6);
+		v[2] = post + 216 + (i < 19 ? i + 35 : i - 19);
+		v[3] = post + 432 + (i < 10 ? i + 44 : i - 10);
+		v[4] = post + 540 + (i < 36 ? i + 18 : i - 36);
+		v[5] = post + 918 + i;
+		v[6] = post + 972 + i;
+		minSum(v, r + i, 7, 54);
+	}
+}
+
+static void c12_1296_6(float *post, float *r) {
+	float *v[7];
+	for (int i = 0; i < 54; i++) {
+		v[0] = post + 0 + (i < 7 ? i + 47 : i - 7);
+		v[1] = post + 54 + (i < 43 ? i + 11 : i - 43);
+		v[2] = post + 270 + (i < 37 ? i + 17 : i - 37);
+		v[3] = post + 432 + (i < 3 ? i + 51 : i - 3);
+		v[4] = post + 648 + i;
+		v[5] = post + 972 + i;
+		v[6] = post + 1026 + i;
+		minSum(v, r + i, 7, 54);
+	}
+}
+
+static void c12_1296_7(float *post, float *r) {
+	float *v[8];
+	for (int i = 0; i < 54; i++) {
+		v[0] = post + 0 + (i < 49 ? i + 5 : i - 49);
+		v[1] = post + 108 + (i < 29 ? i + 25 : i - 29);
+		v[2] = post + 216 + (i < 48 ? i + 6 : i - 48);
+		v[3] = post + 324 + (i < 9 ? i + 45 : i - 9);
+		v[4] = post + 432 + (i < 41 ? i + 13 : i - 41);
+		v[5] = post + 486 + (i < 14 ? i + 40 : i - 14);
+		v[6] = post + 1026 + i;
+		v[7] = post + 1080 + i;
+		minSum(v, r + i, 8, 54);
+	}
+}
+
+static void c12_1296_8(float *post, float *r) {
+	float *v[7];
+	for (int i = 0; i < 54; i++) {
+		v[0] = post + 0 + (i < 21 ? i + 33 : i - 21);
+		v[1] = post + 162 + (i < 20 ? i + 34 : i - 20);
+		v[2] = post + 216 + (i < 30 ? i + 24 : i - 30);
+		v[3] = post + 432 + (i < 31 ? i + 23 : i - 31);
+		v[4] = post + 594 + (i < 8 ? i + 46 : i - 8);
+		v[5] = post + 1080 + i;
+		v[6] = post + 1134 + i;
+		minSum(v, r + i, 7, 54);
+	}
+}
+
+static void c12_1296_9(float *post, float *r) {
+	float *v[7];
+	for (int i = 0; i < 54; i++) {
+		v[0] = post + 0 + (i < 53 ? i + 1 : i - 53);
+		v[1] = post + 108 + (i < 27 ? i + 27 : i - 27);
+		v[2] = post + 216 + (i < 53 ? i + 1 : i - 53);
+		v[3] = post + 432 + (i < 16 ? i + 38 : i - 16);
+		v[4] = post + 540 + (i < 10 ? i + 44 : i - 10);
+		v[5] = post + 1134 + i;
+		v[6] = post + 1188 + i;
+		minSum(v, r + i, 7, 54);
+	}
+}
+
+static void c12_1296_10(float *post, float *r) {
+	float *v[7];
+	for (int i = 0; i < 54; i++) {
+		v[0] = post + 54 + (i < 36 ? i + 18 : i - 36);
+		v[1] = post + 216 + (i < 31 ? i + 23 : i - 31);
+		v[2] = post + 378 + (i < 46 ? i + 8 : i - 46);
+		v[3] = post + 432 + i;
+		v[4] = post + 486 + (i < 19 ? i + 35 : i - 19);
+		v[5] = post + 1188 + i;
+		v[6] = post + 1242 + i;
+		minSum(v, r + i, 7, 54);
+	}
+}
+
+static void c12_1296_11(float *post, float *r) {
+	float *v[7];
+	for (int i = 0; i < 54; i++) {
+		v[0] = post + 0 + (i < 5 ? i + 49 : i - 5);
+		v[1] = post + 108 + (i < 37 ? i + 17 : i - 37);
+		v[2] = post + 216 + (i < 24 ? i + 30 : i - 24);
+		v[3] = post + 432 + (i < 20 ? i + 34 : i - 20);
+		v[4] = post + 594 + (i < 35 ? i + 19 : i - 35);
+		v[5] = post + 648 + (i < 53 ? i + 1 : i - 53);
+		v[6] = post + 1242 + i;
+		minSum(v, r + i, 7, 54);
+	}
+}
+
+#ifdef ISA_X86
+__attribute__((target("avx2")))
+static void c12_1296_0_avx2(float *post, float *r) {
+	static const int base[7] = { 0, 216, 324, 378, 432, 648, 702 };
+	static const int shift[7] = { 40, 22, 49, 23, 43, 1, 0 };
+	minSumAvx2(post, r, 54, 7, base, shift);
+}
+
+__attribute__((target("avx512f")))
+static void c12_1296_0_avx512(float *post, float *r) {
+	static const int base[7] = { 0, 216, 324, 378, 432, 648, 702 };
+	static const int shift[7] = { 40, 22, 49, 23, 43, 1, 0 };
+	minSumAvx512(post, r, 54, 7, base, shift);
+}
+
+__attribute__((target("avx2")))
+static void c12_1296_1_avx2(float *post, float *r) {
+	static const int base[8] = { 0, 54, 216, 270, 432, 540, 702, 756 };
+	static const int shift[8] = { 50, 1, 48, 35, 13, 30, 0, 0 };
+	minSumAvx2(post, r, 54, 8, base, shift);
+}
+
+__attribute__((target("avx512f")))
+static void c12_1296_1_avx512(float *post, float *r) {
+	static const int base[8] = { 0, 54, 216, 270, 432, 540, 702, 756 };
+	static const int shift[8] = { 50, 1, 48, 35, 13, 30, 0, 0 };
+	minSumAvx512(post, r, 54, 8, base, shift);
+}
+
+__attribute__((target("avx2")))
+static void c12_1296_2_avx2(float *post, float *r) {
+	static const int base[7] = { 0, 54, 216, 324, 594, 756, 810 };
+	static const int shift[7] = { 39, 50, 4, 2, 49, 0, 0 };
+	minSumAvx2(post, r, 54, 7, base, shift);
+}
+
+__attribute__((target("avx512f")))
+static void c12_1296_2_avx512(float *post, float *r) {
+	static const int base[7] = { 0, 54, 216, 324, 594, 756, 810 };
+	static const int shift[7] = { 39, 50, 4, 2, 49, 0, 0 };
+	minSumAvx512(post, r, 54, 7, base, shift);
+}
+
+__attribute__((target("avx2")))
+static void c12_1296_3_avx2(float *post, float *r) {
+	static const int base[7] = { 0, 162, 216, 378, 432, 810, 864 };
+	static const int shift[7] = { 33, 38, 37, 4, 1, 0, 0 };
+	minSumAvx2(post, r, 54, 7, base, shift);
+}
+
+__attribute__((target("avx512f")))
+static void c12_1296_3_avx512(float *post, float *r) {
+	static const int base[7] = { 0, 162, 216, 378, 432, 810, 864 };
+	static const int shift[7] = { 33, 38, 37, 4, 1, 0, 0 };
+	minSumAvx512(post, r, 54, 7, base, shift);
+}
+
+__attribute__((target("avx2")))
+static void c12_1296_4_avx2(float *post, float *r) {
+	static const int base[7] = { 0, 216, 270, 432, 486, 864, 918 };
+	static const int shift[7] = { 45, 0, 22, 20, 42, 0, 0 };
+	minSumAvx2(post, r, 54, 7, base, shift);
+}
+
+__attribute__((target("avx512f")))
+static void c12_1296_4_avx512(float *post, float *r) {
+	static const int base[7] = { 0, 216, 270, 432, 486, 864, 918 };
+	static const int shift[7] = { 45, 0, 22, 20, 42, 0, 0 };
+	minSumAvx512(post, r, 54, 7, base, shift);
+}
+
+__attribute__((target("avx2")))
+static void c12_1296_5_avx2(float *post, float *r) {
+	static const int base[7] = { 0, 162, 216, 432, 540, 918, 972 };
+	static const int shift[7] = { 51, 48, 35, 44, 18, 0, 0 };
+	minSumAvx2(post, r, 54, 7, base, shift);
+}
+
+__attribute__((target("avx512f")))
+static void c12_1296_5_avx512(float *post, float *r) {
+	static const int base[7] = { 0, 162, 216, 432, 540, 918, 972 };
+	static const int shift[7] = { 51, 48, 35, 44, 18, 0, 0 };
+	minSumAvx512(post, r, 54, 7, base, shift);
+}
+
+__attribute__((target("avx2")))
+static void c12_1296_6_avx2(float *post, float *r) {
+	static const int base[7] = { 0, 54, 270, 432, 648, 972, 1026 };
+	static const int shift[7] = { 47, 11, 17, 51, 0, 0, 0 };
+	minSumAvx2(post, r, 54, 7, base, shift);
+}
+
+__attribute__((target("avx512f")))
+static void c12_1296_6_avx512(float *post, float *r) {
+	static const int base[7] = { 0, 54, 270, 432, 648, 972, 1026 };
+	static const int shift[7] = { 47, 11, 17, 51, 0, 0, 0 };
+	minSumAvx512(post, r, 54, 7, base, shift);
+}
+
+__attribute__((target("avx2")))
+static void c12_1296_7_avx2(float *post, float *r) {
+	static const int base[8] = { 0, 108, 216, 324, 432, 486, 1026, 1080 };
+	static const int shift[8] = { 5, 25, 6, 45, 13, 40, 0, 0 };
+	minSumAvx2(post, r, 54, 8, base, shift);
+}
+
+__attribute__((target("avx512f")))
+static void c12_1296_7_avx512(float *post, float *r) {
+	static const int base[8] = { 0, 108, 216, 324, 432, 486, 1026, 1080 };
+	static const int shift[8] = { 5, 25, 6, 45, 13, 40, 0, 0 };
+	minSumAvx512(post, r, 54, 8, base, shift);
+}
+
+__attribute__((target("avx2")))
+static void c12_1296_8_avx2(float *post, float *r) {
+	static const int base[7] = { 0, 162, 216, 432, 594, 1080, 1134 };
+	static const int shift[7] = { 33, 34, 24, 23, 46, 0, 0 };
+	minSumAvx2(post, r, 54, 7, base, shift);
+}
+
+__attribute__((target("avx512f")))
+static void c12_1296_8_avx512(float *post, float *r) {
+	static const int base[7] = { 0, 162, 216, 432, 594, 1080, 1134 };
+	static const int shift[7] = { 33, 34, 24, 23, 46, 0, 0 };
+	minSumAvx512(post, r, 54, 7, base, shift);
+}
+
+__attribute__((target("avx2")))
+static void c12_1296_9_avx2(float *post, float *r) {
+	static const int base[7] = { 0, 108, 216, 432, 540, 1134, 1188 };
+	static const int shift[7] = { 1, 27, 1, 38, 44, 0, 0 };
+	minSumAvx2(post, r, 54, 7, base, shift);
+}
+
+__attribute__((target("avx512f")))
+static void c12_1296_9_avx512(float *post, float *r) {
+	static const int base[7] = { 0, 108, 216, 432, 540, 1134, 1188 };
+	static const int shift[7] = { 1, 27, 1, 38, 44, 0, 0 };
+	minSumAvx512(post, r, 54, 7, base, shift);
+}
+
+__attribute__((target("avx2")))
+static void c12_1296_10_avx2(float *post, float *r) {
+	static const int base[7] = { 54, 216, 378, 432, 486, 1188, 1242 };
+	static const int shift[7] = { 18, 23, 8, 0, 35, 0, 0 };
+	minSumAvx2(post, r, 54, 7, base, shift);
+}
+
+__attribute__((target("avx512f")))
+static void c12_1296_10_avx512(float *post, float *r) {
+	static const int base[7] = { 54, 216, 378, 432, 486, 1188, 1242 };
+	static const int shift[7] = { 18, 23, 8, 0, 35, 0, 0 };
+	minSumAvx512(post, r, 54, 7, base, shift);
+}
+
+__attribute__((target("avx2")))
+static void c12_1296_11_avx2(float *post, float *r) {
+	static const int base[7] = { 0, 108, 216, 432, 594, 648, 1242 };
+	static const int shift[7] = { 49, 17, 30, 34, 19, 1, 0 };
+	minSumAvx2(post, r, 54, 7, base, shift);
+}
+
+__attribute__((target("avx512f")))
+static void c12_1296_11_avx512(float *post, float *r) {
+	static const int base[7] = { 0, 108, 216, 432, 594, 648, 1242 };
+	static const int shift[7] = { 49, 17, 30, 34, 19, 1, 0 };
+	minSumAvx512(post, r, 54, 7, base, shift);
+}
+
+#endif
+
+/* ############################################################
+### c12_1944
+############################################################ */
+
+static void c12_1944_0(float *post, float *r) {
+	float *v[7];
+	for (int i = 0; i < 81; i++) {
+		v[0] = post + 0 + (i < 24 ? i + 57 : i - 24);
+		v[1] = post + 324 + (i < 31 ? i + 50 : i - 31);
+		v[2] = post + 486 + (i < 70 ? i + 11 : i - 70);
+		v[3] = post + 648 + (i < 31 ? i + 50 : i - 31);
+		v[4] = post + 810 + (i < 2 ? i + 79 : i - 2);
+		v[5] = post + 972 + (i < 80 ? i + 1 : i - 80);
+		v[6] = post + 1053 + i;
+		minSum(v, r + i, 7, 81);
+	}
+}
+
+static void c12_1944_1(float *post, float *r) {
+	float *v[7];
+	for (int i = 0; i < 81; i++) {
+		v[0] = post + 0 + (i < 78 ? i + 3 : i - 78);
+		v[1] = post + 162 + (i < 53 ? i + 28 : i - 53);
+		v[2] = post + 324 + i;
+		v[3] = post + 648 + (i < 26 ? i + 55 : i - 26);
+		v[4] = post + 729 + (i < 74 ? i + 7 : i - 74);
+		v[5] = post + 1053 + i;
+		v[6] = post + 1134 + i;
+		minSum(v, r + i, 7, 81);
+	}
+}
+
+static void c12_1944_2(float *post, float *r) {
+	float *v[7];
+	for (int i = 0; i < 81; i++) {
+		v[0] = post + 0 + (i < 51 ? i + 30 : i - 51);
+		v[1] = post + 324 + (i < 57 ? i + 24 : i - 57);
+		v[2] = post + 405 + (i < 44 ? i + 37 : i - 44);
+		v[3] = post + 648 + (i < 25 ? i + 56 : i - 25);
+		v[4] = post + 729 + (i < 67 ? i + 14 : i - 67);
+		v[5] = post + 1134 + i;
+		v[6] = post + 1215 + i;
+		minSum(v, r + i, 7, 81);
+	}
+}
+
+static void c12_1944_3(float *post, float *r) {
+	float *v[7];
+	for (int i = 0; i < 81; i++) {
+		v[0] = post + 0 + (i < 19 ? i + 62 : i - 19);
+		v[1] = post + 81 + (i < 28 ? i + 53 : i - 28);
+		v[2] = post + 324 + (i < 28 ? i + 53 : i - 28);
+		v[3] = post + 567 + (i < 78 ? i + 3 : i - 78);
+		v[4] = post + 648 + (i < 46 ? i + 35 : i - 46);
+		v[5] = post + 1215 + i;
+		v[6] = post + 1296 + i;
+		minSum(v, r + i, 7, 81);
+	}
+}
+
+static void c12_1944_4(float *post, float *r) {
+	float *v[7];
+	for (int i = 0; i < 81; i++) {
+		v[0] = post + 0 + (i < 41 ? i + 40 : i - 41);
+		v[1] = post + 243 + (i < 61 ? i + 20 : i - 61);
+		v[2] = post + 324 + (i < 15 ? i + 66 : i - 15);
+		v[3] = post + 567 + (i < 59 ? i + 22 : i - 59);
+		v[4] = post + 648 + (i < 53 ? i + 28 : i - 53);
+		v[5] = post + 1296 + i;
+		v[6] = post + 1377 + i;
+		minSum(v, r + i, 7, 81);
+	}
+}
+
+static void c12_1944_5(float *post, float *r) {
+	float *v[7];
+	for (int i = 0; i < 81; i++) {
+		v[0] = post + 0 + i;
+		v[1] = post + 324 + (i < 73 ? i + 8 : i - 73);
+		v[2] = post + 486 + (i < 39 ? i + 42 : i - 39);
+		v[3] = post + 648 + (i < 31 ? i + 50 : i - 31);
+		v[4] = post + 891 + (i < 73 ? i + 8 : i - 73);
+		v[5] = post + 1377 + i;
+		v[6] = post + 1458 + i;
+		minSum(v, r + i, 7, 81);
+	}
+}
+
+static void c12_1944_6(float *post, float *r) {
+	float *v[8];
+	for (int i = 0; i < 81; i++) {
+		v[0] = post + 0 + (i < 12 ? i + 69 : i - 12);
+		v[1] = post + 81 + (i < 2 ? i + 79 : i - 2);
+		v[2] = post + 162 + (i < 2 ? i + 79 : i - 2);
+		v[3] = post + 486 + (i < 25 ? i + 56 : i - 25);
+		v[4] = post + 648 + (i < 29 ? i + 52 : i - 29);
+		v[5] = post + 972 + i;
+		v[6] = post + 1458 + i;
+		v[7] = post + 1539 + i;
+		minSum(v, r + i, 8, 81);
+	}
+}
+
+static void c12_1944_7(float *post, float *r) {
+	float *v[7];
+	for (int i = 0; i < 81; i++) {
+		v[0] = post + 0 + (i < 16 ? i + 65 : i - 16);
+		v[1] = post + 324 + (i < 43 ? i + 38 : i - 43);
+		v[2] = post + 405 + (i < 24 ? i + 57 : i - 24);
+		v[3] = post + 648 + (i < 9 ? i + 72 : i - 9);
+		v[4] = post + 810 + (i < 54 ? i + 27 : i - 54);
+		v[5] = post + 1539 + i;
+		v[6] = post + 1620 + i;
+		minSum(v, r + i, 7, 81);
+	}
+}
+
+static void c12_1944_8(float *post, float *r) {
+	float *v[7];
+	for (int i = 0; i < 81; i++) {
+		v[0] = post + 0 + (i < 17 ? i + 64 : i - 17);
+		v[1] = post + 324 + (i < 67 ? i + 14 : i - 67);
+		v[2] = post + 405 + (i < 29 ? i + 52 : i - 29);
+		v[3] = post + 648 + (i < 51 ? i + 30 : i - 51);
+		v[4] = post + 891 + (i < 49 ? i + 32 : i - 49);
+		v[5] = post + 1620 + i;
+		v[6] = post + 1701 + i;
+		minSum(v, r + i, 7, 81);
+	}
+}
+
+static void c12_1944_9(float *post, float *r) {
+	float *v[7];
+	for (int i = 0; i < 81; i++) {
+		v[0] = post + 81 + (i < 36 ? i + 45 : i - 36);
+		v[1] = post + 243 + (i < 11 ? i + 70 : i - 11);
+		v[2] = post + 324 + i;
+		v[3] = post + 648 + (i < 4 ? i + 77 : i - 4);
+		v[4] = post + 729 + (i < 72 ? i + 9 : i - 72);
+		v[5] = post + 1701 + i;
+		v[6] = post + 1782 + i;
+		minSum(v, r + i, 7, 81);
+	}
+}
+
+static void c12_1944_10(float *post, float *r) {
+	float *v[7];
+	for (int i = 0; i < 81; i++) {
+		v[0] = post + 0 + (i < 79 ? i + 2 : i - 79);
+		v[1] = post + 81 + (i < 25 ? i + 56 : i - 25);
+		v[2] = post + 243 + (i < 24 ? i + 57 : i - 24);
+		v[3] = post + 324 + (i < 46 ? i + 35 : i - 46);
+		v[4] = post + 810 + (i < 69 ? i + 12 : i - 69);
+		v[5] = post + 1782 + i;
+		v[6] = post + 1863 + i;
+		minSum(v, r + i, 7, 81);
+	}
+}
+
+static void c12_1944_11(float *post, float *r) {
+	float *v[8];
+	for (int i = 0; i < 81; i++) {
+		v[0] = post + 0 + (i < 57 ? i + 24 : i - 57);
+		v[1] = post + 162 + (i < 20 ? i + 61 : i - 20);
+		v[2] = post + 324 + (i < 21 ? i + 60 : i - 21);
+		v[3] = post + 567 + (i < 54 ? i + 27 : i - 54);
+		v[4] = post + 648 + (i < 30 ? i + 51 : i - 30);
+		v[5] = post + 891 + (i < 65 ? i + 16 : i - 65);
+		v[6] = post + 972 + (i < 80 ? i + 1 : i - 80);
+		v[7] = post + 1863 + i;
+		minSum(v, r + i, 8, 81);
+	}
+}
+
+#ifdef ISA_X86
+__attribute__((target("avx2")))
+static void c12_1944_0_avx2(float *post, float *r) {
+	static const int base[7] = { 0, 324, 486, 648, 810, 972, 1053 };
+	static const int shift[7] = { 57, 50, 11, 50, 79, 1, 0 };
+	minSumAvx2(post, r, 81, 7, base, shift);
+}
+
+__attribute__((target("avx512f")))
+static void c12_1944_0_avx512(float *post, float *r) {
+	static const int base[7] = { 0, 324, 486, 648, 810, 972, 1053 };
+	static const int shift[7] = { 57, 50, 11, 50, 79, 1, 0 };
+	minSumAvx512(post, r, 81, 7, base, shift);
+}
+
+__attribute__((target("avx2")))
+static void c12_1944_1_avx2(float *post, float *r) {
+	static const int base[7] = { 0, 162, 324, 648, 729, 1053, 1134 };
+	static const int shift[7] = { 3, 28, 0, 55, 7, 0, 0 };
+	minSumAvx2(post, r, 81, 7, base, shift);
+}
+
+__attribute__((target("avx512f")))
+static void c12_1944_1_avx512(float *post, float *r) {
+	static const int base[7] = { 0, 162, 324, 648, 729, 1053, 1134 };
+	static const int shift[7] = { 3, 28, 0, 55, 7, 0, 0 };
+	minSumAvx512(post, r, 81, 7, base, shift);
+}
+
+__attribute__((target("avx2")))
+static void c12_1944_2_avx2(float *post, float *r) {
+	static const int base[7] = { 0, 324, 405, 648, 729, 1134, 1215 };
+	static const int shift[7] = { 30, 24, 37, 56, 14, 0, 0 };
+	minSumAvx2(post, r, 81, 7, base, shift);
+}
+
+__attribute__((target("avx512f")))
+static void c12_1944_2_avx512(float *post, float *r) {
+	static const int base[7] = { 0, 324, 405, 648, 729, 1134, 1215 };
+	static const int shift[7] = { 30, 24, 37, 56, 14, 0, 0 };
+	minSumAvx512(post, r, 81, 7, base, shift);
+}
+
+__attribute__((target("avx2")))
+static void c12_1944_3_avx2(float *post, float *r) {
+	static const int base[7] = { 0, 81, 324, 567, 648, 1215, 1296 };
+	static const int shift[7] = { 62, 53, 53, 3, 35, 0, 0 };
+	minSumAvx2(post, r, 81, 7, base, shift);
+}
+
+__attribute__((target("avx512f")))
+static void c12_1944_3_avx512(float *post, float *r) {
+	static const int base[7] = { 0, 81, 324, 567, 648, 1215, 1296 };
+	static const int shift[7] = { 62, 53, 53, 3, 35, 0, 0 };
+	minSumAvx512(post, r, 81, 7, base, shift);
+}
+
+__attribute__((target("avx2")))
+static void c12_1944_4_avx2(float *post, float *r) {
+	static const int base[7] = { 0, 243, 324, 567, 648, 1296, 1377 };
+	static const int shift[7] = { 40, 20, 66, 22, 28, 0, 0 };
+	minSumAvx2(post, r, 81, 7, base, shift);
+}
+
+__attribute__((target("avx512f")))
+static void c12_1944_4_avx512(float *post, float *r) {
+	static const int base[7] = { 0, 243, 324, 567, 648, 1296, 1377 };
+	static const int shift[7] = { 40, 20, 66, 22, 28, 0, 0 };
+	minSumAvx512(post, r, 81, 7, base, shift);
+}
+
+__attribute__((target("avx2")))
+static void c12_1944_5_avx2(float *post, float *r) {
+	static const int base[7] = { 0, 324, 486, 648, 891, 1377, 1458 };
+	static const int shift[7] = { 0, 8, 42, 50, 8, 0, 0 };
+	minSumAvx2(post, r, 81, 7, base, shift);
+}
+
+__attribute__((target("avx512f")))
+static void c12_1944_5_avx512(float *post, float *r) {
+	static const int base[7] = { 0, 324, 486, 648, 891, 1377, 1458 };
+	static const int shift[7] = { 0, 8, 42, 50, 8, 0, 0 };
+	minSumAvx512(post, r, 81, 7, base, shift);
+}
+
+__attribute__((target("avx2")))
+static void c12_1944_6_avx2(float *post, float *r) {
+	static const int base[8] = { 0, 81, 162, 486, 648, 972, 1458, 1539 };
+	static const int shift[8] = { 69, 79, 79, 56, 52, 0, 0, 0 };
+	minSumAvx2(post, r, 81, 8, base, shift);
+}
+
+__attribute__((target("avx512f")))
+static void c12_1944_6_avx512(float *post, float *r) {
+	static const int base[8] = { 0, 81, 162, 486, 648, 972, 1458, 1539 };
+	static const int shift[8] = { 69, 79, 79, 56, 52, 0, 0, 0 };
+	minSumAvx512(post, r, 81, 8, base, shift);
+}
+
+__attribute__((target("avx2")))
+static void c12_1944_7_avx2(float *post, float *r) {
+	static const int base[7] = { 0, 324, 405, 648, 810, 1539, 1620 };
+	static const int shift[7] = { 65, 38, 57, 72, 27, 0, 0 };
+	minSumAvx2(post, r, 81, 7, base, shift);
+}
+
+__attribute__((target("avx512f")))
+static void c12_1944_7_avx512(float *post, float *r) {
+	static const int base[7] = { 0, 324, 405, 648, 810, 1539, 1620 };
+	static const int shift[7] = { 65, 38, 57, 72, 27, 0, 0 };
+	minSumAvx512(post, r, 81, 7, base, shift);
+}
+
+__attribute__((target("avx2")))
+static void c12_1944_8_avx2(float *post, float *r) {
+	static const int base[7] = { 0, 324, 405, 648, 891, 1620, 1701 };
+	static const int shift[7] = { 64, 14, 52, 30, 32, 0, 0 };
+	minSumAvx2(post, r, 81, 7, base, shift);
+}
+
+__attribute__((target("avx512f")))
+static void c12_1944_8_avx512(float *post, float *r) {
+	static const int base[7] = { 0, 324, 405, 648, 891, 1620, 1701 };
+	static const int shift[7] = { 64, 14, 52, 30, 32, 0, 0 };
+	minSumAvx512(post, r, 81, 7, base, shift);
+}
+
+__attribute__((target("avx2")))
+static void c12_1944_9_avx2(float *post, float *r) {
+	static const int base[7] = { 81, 243, 324, 648, 729, 1701, 1782 };
+	static const int shift[7] = { 45, 70, 0, 77, 9, 0, 0 };
+	minSumAvx2(post, r, 81, 7, base, shift);
+}
+
+__attribute__((target("avx512f")))
+static void c12_1944_9_avx512(float *post, float *r) {
+	static const int base[7] = { 81, 243, 324, 648, 729, 1701, 1782 };
+	static const int shift[7] = { 45, 70, 0, 77, 9, 0, 0 };
+	minSumAvx512(post, r, 81, 7, base, shift);
+}
+
+__attribute__((target("avx2")))
+static void c12_1944_10_avx2(float *post, float *r) {
+	static const int base[7] = { 0, 81, 243, 324, 810, 1782, 1863 };
+	static const int shift[7] = { 2, 56, 57, 35, 12, 0, 0 };
+	minSumAvx2(post, r, 81, 7, base, shift);
+}
+
+__attribute__((target("avx512f")))
+static void c12_1944_10_avx512(float *post, float *r) {
+	static const int base[7] = { 0, 81, 243, 324, 810, 1782, 1863 };
+	static const int shift[7] = { 2, 56, 57, 35, 12, 0, 0 };
+	minSumAvx512(post, r, 81, 7, base, shift);
+}
+
+__attribute__((target("avx2")))
+static void c12_1944_11_avx2(float *post, float *r) {
+	static const int base[8] = { 0, 162, 324, 567, 648, 891, 972, 1863 };
+	static const int shift[8] = { 24, 61, 60, 27, 51, 16, 1, 0 };
+	minSumAvx2(post, r, 81, 8, base, shift);
+}
+
+__attribute__((target("avx512f")))
+static void c12_1944_11_avx512(float *post, float *r) {
+	static const int base[8] = { 0, 162, 324, 567, 648, 891, 972, 1863 };
+	static const int shift[8] = { 24, 61, 60, 27, 51, 16, 1, 0 };
+	minSumAvx512(post, r, 81, 8, base, shift);
+}
+
+#endif
+
+/* ############################################################
+### c23_648
+############################################################ */
+
+static void c23_648_0(float *post, float *r) {
+	float *v[11];
+	for (int i = 0; i < 27; i++) {
+		v[0] = post + 0 + (i < 2 ? i + 25 : i - 2);
+		v[1] = post + 27 + (i < 1 ? i + 26 : i - 1);
+		v[2] = post + 54 + (i < 13 ? i + 14 : i - 13);
+		v[3] = post + 108 + (i < 7 ? i + 20 : i - 7);
+		v[4] = post + 162 + (i < 25 ? i + 2 : i - 25);
+		v[5] = post + 216 + (i < 23 ? i + 4 : i - 23);
+		v[6] = post + 297 + (i < 19 ? i + 8 : i - 19);
+		v[7] = post + 351 + (i < 11 ? i + 16 : i - 11);
+		v[8] = post + 405 + (i < 9 ? i + 18 : i - 9);
+		v[9] = post + 432 + (i < 26 ? i + 1 : i - 26);
+		v[10] = post + 459 + i;
+		minSum(v, r + i, 11, 27);
+	}
+}
+
+static void c23_648_1(float *post, float *r) {
+	float *v[11];
+	for (int i = 0; i < 27; i++) {
+		v[0] = post + 0 + (i < 17 ? i + 10 : i - 17);
+		v[1] = post + 27 + (i < 18 ? i + 9 : i - 18);
+		v[2] = post + 54 + (i < 12 ? i + 15 : i - 12);
+		v[3] = post + 81 + (i < 16 ? i + 11 : i - 16);
+		v[4] = post + 135 + i;
+		v[5] = post + 189 + (i < 26 ? i + 1 : i - 26);
+		v[6] = post + 270 + (i < 9 ? i + 18 : i - 9);
+		v[7] = post + 324 + (i < 19 ? i + 8 : i - 19);
+		v[8] = post + 378 + (i < 17 ? i + 10 : i - 17);
+		v[9] = post + 459 + i;
+		v[10] = post + 486 + i;
+		minSum(v, r + i, 11, 27);
+	}
+}
+
+static void c23_648_2(float *post, float *r) {
+	float *v[11];
+	for (int i = 0; i < 27; i++) {
+		v[0] = post + 0 + (i < 11 ? i + 16 : i - 11);
+		v[1] = post + 27 + (i < 25 ? i + 2 : i - 25);
+		v[2] = post + 54 + (i < 7 ? i + 20 : i - 7);
+		v[3] = post + 81 + (i < 1 ? i + 26 : i - 1);
+		v[4] = post + 108 + (i < 6 ? i + 21 : i - 6);
+		v[5] = post + 162 + (i < 21 ? i + 6 : i - 21);
+		v[6] = post + 216 + (i < 26 ? i + 1 : i - 26);
+		v[7] = post + 243 + (i < 1 ? i + 26 : i - 1);
+		v[8] = post + 297 + (i < 20 ? i + 7 : i - 20);
+		v[9] = post + 486 + i;
+		v[10] = post + 513 + i;
+		minSum(v, r + i, 11, 27);
+	}
+}
+
+static void c23_648_3(float *post, float *r) {
+	float *v[11];
+	for (int i = 0; i < 27; i++) {
+		v[0] = post + 0 + (i < 17 ? i + 10 : i - 17);
+		v[1] = post + 27 + (i < 14 ? i + 13 : i - 14);
+		v[2] = post + 54 + (i < 22 ? i + 5 : i - 22);
+		v[3] = post + 81 + i;
+		v[4] = post + 135 + (i < 24 ? i + 3 : i - 24);
+		v[5] = post + 189 + (i < 20 ? i + 7 : i - 20);
+		v[6] = post + 270 + (i < 1 ? i + 26 : i - 1);
+		v[7] = post + 351 + (i < 14 ? i + 13 : i - 14);
+		v[8] = post + 405 + (i < 11 ? i + 16 : i - 11);
+		v[9] = post + 513 + i;
+		v[10] = post + 540 + i;
+		minSum(v, r + i, 11, 27);
+	}
+}
+
+static void c23_648_4(float *post, float *r) {
+	float *v[11];
+	for (int i = 0; i < 27; i++) {
+		v[0] = post + 0 + (i < 4 ? i + 23 : i - 4);
+		v[1] = post + 27 + (i < 13 ? i + 14 : i - 13);
+		v[2] = post + 54 + (i < 3 ? i + 24 : i - 3);
+		v[3] = post + 108 + (i < 15 ? i + 12 : i - 15);
+		v[4] = post + 162 + (i < 8 ? i + 19 : i - 8);
+		v[5] = post + 216 + (i < 10 ? i + 17 : i - 10);
+		v[6] = post + 324 + (i < 7 ? i + 20 : i - 7);
+		v[7] = post + 378 + (i < 6 ? i + 21 : i - 6);
+		v[8] = post + 432 + i;
+		v[9] = post + 540 + i;
+		v[10] = post + 567 + i;
+		minSum(v, r + i, 11, 27);
+	}
+}
+
+static void c23_648_5(float *post, float *r) {
+	float *v[11];
+	for (int i = 0; i < 27; i++) {
+		v[0] = post + 0 + (i < 21 ? i + 6 : i - 21);
+		v[1] = post + 27 + (i < 5 ? i + 22 : i - 5);
+		v[2] = post + 54 + (i < 18 ? i + 9 : i - 18);
+		v[3] = post + 81 + (i < 7 ? i + 20 : i - 7);
+		v[4] = post + 135 + (i < 2 ? i + 25 : i - 2);
+		v[5] = post + 189 + (i < 10 ? i + 17 : i - 10);
+		v[6] = post + 243 + (i < 19 ? i + 8 : i - 19);
+		v[7] = post + 297 + (i < 13 ? i + 14 : i - 13);
+		v[8] = post + 351 + (i < 9 ? i + 18 : i - 9);
+		v[9] = post + 567 + i;
+		v[10] = post + 594 + i;
+		minSum(v, r + i, 11, 27);
+	}
+}
+
+static void c23_648_6(float *post, float *r) {
+	float *v[11];
+	for (int i = 0; i < 27; i++) {
+		v[0] = post + 0 + (i < 13 ? i + 14 : i - 13);
+		v[1] = post + 27 + (i < 4 ? i + 23 : i - 4);
+		v[2] = post + 54 + (i < 6 ? i + 21 : i - 6);
+		v[3] = post + 81 + (i < 16 ? i + 11 : i - 16);
+		v[4] = post + 108 + (i < 7 ? i + 20 : i - 7);
+		v[5] = post + 162 + (i < 3 ? i + 24 : i - 3);
+		v[6] = post + 216 + (i < 9 ? i + 18 : i - 9);
+		v[7] = post + 270 + (i < 8 ? i + 19 : i - 8);
+		v[8] = post + 405 + (i < 5 ? i + 22 : i - 5);
+		v[9] = post + 594 + i;
+		v[10] = post + 621 + i;
+		minSum(v, r + i, 11, 27);
+	}
+}
+
+static void c23_648_7(float *post, float *r) {
+	float *v[11];
+	for (int i = 0; i < 27; i++) {
+		v[0] = post + 0 + (i < 10 ? i + 17 : i - 10);
+		v[1] = post + 27 + (i < 16 ? i + 11 : i - 16);
+		v[2] = post + 54 + (i < 16 ? i + 11 : i - 16);
+		v[3] = post + 81 + (i < 7 ? i + 20 : i - 7);
+		v[4] = post + 135 + (i < 6 ? i + 21 : i - 6);
+		v[5] = post + 189 + (i < 1 ? i + 26 : i - 1);
+		v[6] = post + 243 + (i < 24 ? i + 3 : i - 24);
+		v[7] = post + 324 + (i < 9 ? i + 18 : i - 9);
+		v[8] = post + 378 + (i < 1 ? i + 26 : i - 1);
+		v[9] = post + 432 + (i < 26 ? i + 1 : i - 26);
+		v[10] = post + 621 + i;
+		minSum(v, r + i, 11, 27);
+	}
+}
+
+#ifdef ISA_X86
+__attribute__((target("avx2")))
+static void c23_648_0_avx2(float *post, float *r) {
+	static const int base[11] = { 0, 27, 54, 108, 162, 216, 297, 351, 405, 432, 459 };
+	static const int shift[11] = { 25, 26, 14, 20, 2, 4, 8, 16, 18, 1, 0 };
+	minSumAvx2(post, r, 27, 11, base, shift);
+}
+
+__attribute__((target("avx512f")))
+static void c23_648_0_avx512(float *post, float *r) {
+	static const int base[11] = { 0, 27, 54, 108, 162, 216, 297, 351, 405, 432, 459 };
+	static const int shift[11] = { 25, 26, 14, 20, 2, 4, 8, 16, 18, 1, 0 };
+	minSumAvx512(post, r, 27, 11, base, shift);
+}
+
+__attribute__((target("avx2")))
+static void c23_648_1_avx2(float *post, float *r) {
+	static const int base[11] = { 0, 27, 54, 81, 135, 189, 270, 324, 378, 459, 486 };
+	static const int shift[11] = { 10, 9, 15, 11, 0, 1, 18, 8, 10, 0, 0 };
+	minSumAvx2(post, r, 27, 11, base, shift);
+}
+
+__attribute__((target("avx512f")))
+static void c23_648_1_avx512(float *post, float *r) {
+	static const int base[11] = { 0, 27, 54, 81, 135, 189, 270, 324, 378, 459, 486 };
+	static const int shift[11] = { 10, 9, 15, 11, 0, 1, 18, 8, 10, 0, 0 };
+	minSumAvx512(post, r, 27, 11, base, shift);
+}
+
+__attribute__((target("avx2")))
+static void c23_648_2_avx2(float *post, float *r) {
+	static const int base[11] = { 0, 27, 54, 81, 108, 162, 216, 243, 297, 486, 513 };
+	static const int shift[11] = { 16, 2, 20, 26, 21, 6, 1, 26, 7, 0, 0 };
+	minSumAvx2(post, r, 27, 11, base, shift);
+}
+
+__attribute__((target("avx512f")))
+static void c23_648_2_avx512(float *post, float *r) {
+	static const int base[11] = { 0, 27, 54, 81, 108, 162, 216, 243, 297, 486, 513 };
+	static const int shift[11] = { 16, 2, 20, 26, 21, 6, 1, 26, 7, 0, 0 };
+	minSumAvx512(post, r, 27, 11, base, shift);
+}
+
+__attribute__((target("avx2")))
+static void c23_648_3_avx2(float *post, float *r) {
+	static const int base[11] = { 0, 27, 54, 81, 135, 189, 270, 351, 405, 513, 540 };
+	static const int shift[11] = { 10, 13, 5, 0, 3, 7, 26, 13, 16, 0, 0 };
+	minSumAvx2(post, r, 27, 11, base, shift);
+}
+
+__attribute__((target("avx512f")))
+static void c23_648_3_avx512(float *post, float *r) {
+	static const int base[11] = { 0, 27, 54, 81, 135, 189, 270, 351, 405, 513, 540 };
+	static const int shift[11] = { 10, 13, 5, 0, 3, 7, 26, 13, 16, 0, 0 };
+	minSumAvx512(post, r, 27, 11, base, shift);
+}
+
+__attribute__((target("avx2")))
+static void c23_648_4_avx2(float *post, float *r) {
+	static const int base[11] = { 0, 27, 54, 108, 162, 216, 324, 378, 432, 540, 567 };
+	static const int shift[11] = { 23, 14, 24, 12, 19, 17, 20, 21, 0, 0, 0 };
+	minSumAvx2(post, r, 27, 11, base, shift);
+}
+
+__attribute__((target("avx512f")))
+static void c23_648_4_avx512(float *post, float *r) {
+	static const int base[11] = { 0, 27, 54, 108, 162, 216, 324, 378, 432, 540, 567 };
+	static const int shift[11] = { 23, 14, 24, 12, 19, 17, 20, 21, 0, 0, 0 };
+	minSumAvx512(post, r, 27, 11, base, shift);
+}
+
+__attribute__((target("avx2")))
+static void c23_648_5_avx2(float *post, float *r) {
+	static const int base[11] = { 0, 27, 54, 81, 135, 189, 243, 297, 351, 567, 594 };
+	static const int shift[11] = { 6, 22, 9, 20, 25, 17, 8, 14, 18, 0, 0 };
+	minSumAvx2(post, r, 27, 11, base, shift);
+}
+
+__attribute__((target("avx512f")))
+static void c23_648_5_avx512(float *post, float *r) {
+	static const int base[11] = { 0, 27, 54, 81, 135, 189, 243, 297, 351, 567, 594 };
+	static const int shift[11] = { 6, 22, 9, 20, 25, 17, 8, 14, 18, 0, 0 };
+	minSumAvx512(post, r, 27, 11, base, shift);
+}
+
+__attribute__((target("avx2")))
+static void c23_648_6_avx2(float *post, float *r) {
+	static const int base[11] = { 0, 27, 54, 81, 108, 162, 216, 270, 405, 594, 621 };
+	static const int shift[11] = { 14, 23, 21, 11, 20, 24, 18, 19, 22, 0, 0 };
+	minSumAvx2(post, r, 27, 11, base, shift);
+}
+
+__attribute__((target("avx512f")))
+static void c23_648_6_avx512(float *post, float *r) {
+	static const int base[11] = { 0, 27, 54, 81, 108, 162, 216, 270, 405, 594, 621 };
+	static const int shift[11] = { 14, 23, 21, 11, 20, 24, 18, 19, 22, 0, 0 };
+	minSumAvx512(post, r, 27, 11, base, shift);
+}
+
+__attribute__((target("avx2")))
+static void c23_648_7_avx2(float *post, float *r) {
+	static const int base[11] = { 0, 27, 54, 81, 135, 189, 243, 324, 378, 432, 621 };
+	static const int shift[11] = { 17, 11, 11, 20, 21, 26, 3, 18, 26, 1, 0 };
+	minSumAvx2(post, r, 27, 11, base, shift);
+}
+
+__attribute__((target("avx512f")))
+static void c23_648_7_avx512(float *post, float *r) {
+	static const int base[11] = { 0, 27, 54, 81, 135, 189, 243, 324, 378, 432, 621 };
+	static const int shift[11] = { 17, 11, 11, 20, 21, 26, 3, 18, 26, 1, 0 };
+	minSumAvx512(post, r, 27, 11, base, shift);
+}
+
+#endif
+
+/* ############################################################
+### c23_1296
+############################################################ */
+
+static void c23_1296_0(float *post, float *r) {
+	float *v[11];
+	for (int i = 0; i < 54; i++) {
+		v[0] = post + 0 + (i < 15 ? i + 39 : i - 15);
+		v[1] = post + 54 + (i < 23 ? i + 31 : i - 23);
+		v[2] = post + 108 + (i < 32 ? i + 22 : i - 32);
+		v[3] = post + 162 + (i < 11 ? i + 43 : i - 11);
+		v[4] = post + 270 + (i < 14 ? i + 40 : i - 14);
+		v[5] = post + 324 + (i < 50 ? i + 4 : i - 50);
+		v[6] = post + 432 + (i < 43 ? i + 11 : i - 43);
+		v[7] = post + 594 + (i < 4 ? i + 50 : i - 4);
+		v[8] = post + 810 + (i < 48 ? i + 6 : i - 48);
+		v[9] = post + 864 + (i < 53 ? i + 1 : i - 53);
+		v[10] = post + 918 + i;
+		minSum(v, r + i, 11, 54);
+	}
+}
+
+static void c23_1296_1(float *post, float *r) {
+	float *v[11];
+	for (int i = 0; i < 54; i++) {
+		v[0] = post + 0 + (i < 29 ? i + 25 : i - 29);
+		v[1] = post + 54 + (i < 2 ? i + 52 : i - 2);
+		v[2] = post + 108 + (i < 13 ? i + 41 : i - 13);
+		v[3] = post + 162 + (i < 52 ? i + 2 : i - 52);
+		v[4] = post + 216 + (i < 48 ? i + 6 : i - 48);
+		v[5] = post + 324 + (i < 40 ? i + 14 : i - 40);
+		v[6] = post + 432 + (i < 20 ? i + 34 : i - 20);
+		v[7] = post + 648 + (i < 30 ? i + 24 : i - 30);
+		v[8] = post + 756 + (i < 17 ? i + 37 : i - 17);
+		v[9] = post + 918 + i;
+		v[10] = post + 972 + i;
+		minSum(v, r + i, 11, 54);
+	}
+}
+
+static void c23_1296_2(float *post, float *r) {
+	float *v[11];
+	for (int i = 0; i < 54; i++) {
+		v[0] = post + 0 + (i < 11 ? i + 43 : i - 11);
+		v[1] = post + 54 + (i < 23 ? i + 31 : i - 23);
+		v[2] = post + 108 + (i < 25 ? i + 29 : i - 25);
+		v[3] = post + 162 + i;
+		v[4] = post + 216 + (i < 33 ? i + 21 : i - 33);
+		v[5] = post + 324 + (i < 26 ? i + 28 : i - 26);
+		v[6] = post + 486 + (i < 52 ? i + 2 : i - 52);
+		v[7] = post + 648 + (i < 47 ? i + 7 : i - 47);
+		v[8] = post + 756 + (i < 37 ? i + 17 : i - 37);
+		v[9] = post + 972 + i;
+		v[10] = post + 1026 + i;
+		minSum(v, r + i, 11, 54);
+	}
+}
+
+static void c23_1296_3(float *post, float *r) {
+	float *v[11];
+	for (int i = 0; i < 54; i++) {
+		v[0] = post + 0 + (i < 34 ? i + 20 : i - 34);
+		v[1] = post + 54 + (i < 21 ? i + 33 : i - 21);
+		v[2] = post + 108 + (i < 6 ? i + 48 : i - 6);
+		v[3] = post + 216 + (i < 50 ? i + 4 : i - 50);
+		v[4] = post + 270 + (i < 41 ? i + 13 : i - 41);
+		v[5] = post + 378 + (i < 28 ? i + 26 : i - 28);
+		v[6] = post + 540 + (i < 32 ? i + 22 : i - 32);
+		v[7] = post + 702 + (i < 8 ? i + 46 : i - 8);
+		v[8] = post + 756 + (i < 12 ? i + 42 : i - 12);
+		v[9] = post + 1026 + i;
+		v[10] = post + 1080 + i;
+		minSum(v, r + i, 11, 54);
+	}
+}
+
+static void c23_1296_4(float *post, float *r) {
+	float *v[11];
+	for (int i = 0; i < 54; i++) {
+		v[0] = post + 0 + (i < 9 ? i + 45 : i - 9);
+		v[1] = post + 54 + (i < 47 ? i + 7 : i - 47);
+		v[2] = post + 108 + (i < 36 ? i + 18 : i - 36);
+		v[3] = post + 162 + (i < 3 ? i + 51 : i - 3);
+		v[4] = post + 216 + (i < 42 ? i + 12 : i - 42);
+		v[5] = post + 270 + (i < 29 ? i + 25 : i - 29);
+		v[6] = post + 486 + (i < 4 ? i + 50 : i - 4);
+		v[7] = post + 648 + (i < 49 ? i + 5 : i - 49);
+		v[8] = post + 864 + i;
+		v[9] = post + 1080 + i;
+		v[10] = post + 1134 + i;
+		minSum(v, r + i, 11, 54);
+	}
+}
+
+static void c23_1296_5(float *post, float *r) {
+	float *v[11];
+	for (int i = 0; i < 54; i++) {
+		v[0] = post + 0 + (i < 19 ? i + 35 : i - 19);
+		v[1] = post + 54 + (i < 14 ? i + 40 : i - 14);
+		v[2] = post + 108 + (i < 22 ? i + 32 : i - 22);
+		v[3] = post + 162 + (i < 38 ? i + 16 : i - 38);
+		v[4] = post + 216 + (i < 49 ? i + 5 : i - 49);
+		v[5] = post + 378 + (i < 36 ? i + 18 : i - 36);
+		v[6] = post + 540 + (i < 11 ? i + 43 : i - 11);
+		v[7] = post + 594 + (i < 3 ? i + 51 : i - 3);
+		v[8] = post + 702 + (i < 22 ? i + 32 : i - 22);
+		v[9] = post + 1134 + i;
+		v[10] = post + 1188 + i;
+		minSum(v, r + i, 11, 54);
+	}
+}
+
+static void c23_1296_6(float *post, float *r) {
+	float *v[11];
+	for (int i = 0; i < 54; i++) {
+		v[0] = post + 0 + (i < 45 ? i + 9 : i - 45);
+		v[1] = post + 54 + (i < 30 ? i + 24 : i - 30);
+		v[2] = post + 108 + (i < 41 ? i + 13 : i - 41);
+		v[3] = post + 162 + (i < 32 ? i + 22 : i - 32);
+		v[4] = post + 216 + (i < 26 ? i + 28 : i - 26);
+		v[5] = post + 378 + (i < 17 ? i + 37 : i - 17);
+		v[6] = post + 540 + (i < 29 ? i + 25 : i - 29);
+		v[7] = post + 702 + (i < 2 ? i + 52 : i - 2);
+		v[8] = post + 810 + (i < 41 ? i + 13 : i - 41);
+		v[9] = post + 1188 + i;
+		v[10] = post + 1242 + i;
+		minSum(v, r + i, 11, 54);
+	}
+}
+
+static void c23_1296_7(float *post, float *r) {
+	float *v[11];
+	for (int i = 0; i < 54; i++) {
+		v[0] = post + 0 + (i < 22 ? i + 32 : i - 22);
+		v[1] = post + 54 + (i < 32 ? i + 22 : i - 32);
+		v[2] = post + 108 + (i < 50 ? i + 4 : i - 50);
+		v[3] = post + 162 + (i < 33 ? i + 21 : i - 33);
+		v[4] = post + 216 + (i < 38 ? i + 16 : i - 38);
+		v[5] = post + 432 + (i < 27 ? i + 27 : i - 27);
+		v[6] = post + 486 + (i < 26 ? i + 28 : i - 26);
+		v[7] = post + 594 + (i < 16 ? i + 38 : i - 16);
+		v[8] = post + 810 + (i < 46 ? i + 8 : i - 46);
+		v[9] = post + 864 + (i < 53 ? i + 1 : i - 53);
+		v[10] = post + 1242 + i;
+		minSum(v, r + i, 11, 54);
+	}
+}
+
+#ifdef ISA_X86
+__attribute__((target("avx2")))
+static void c23_1296_0_avx2(float *post, float *r) {
+	static const int base[11] = { 0, 54, 108, 162, 270, 324, 432, 594, 810, 864, 918 };
+	static const int shift[11] = { 39, 31, 22, 43, 40, 4, 11, 50, 6, 1, 0 };
+	minSumAvx2(post, r, 54, 11, base, shift);
+}
+
+__attribute__((target("avx512f")))
+static void c23_1296_0_avx512(float *post, float *r) {
+	static const int base[11] = { 0, 54, 108, 162, 270, 324, 432, 594, 810, 864, 918 };
+	static const int shift[11] = { 39, 31, 22, 43, 40, 4, 11, 50, 6, 1, 0 };
+	minSumAvx512(post, r, 54, 11, base, shift);
+}
+
+__attribute__((target("avx2")))
+static void c23_1296_1_avx2(float *post, float *r) {
+	static const int base[11] = { 0, 54, 108, 162, 216, 324, 432, 648, 756, 918, 972 };
+	static const int shift[11] = { 25, 52, 41, 2, 6, 14, 34, 24, 37, 0, 0 };
+	minSumAvx2(post, r, 54, 11, base, shift);
+}
+
+__attribute__((target("avx512f")))
+static void c23_1296_1_avx512(float *post, float *r) {
+	static const int base[11] = { 0, 54, 108, 162, 216, 324, 432, 648, 756, 918, 972 };
+	static const int shift[11] = { 25, 52, 41, 2, 6, 14, 34, 24, 37, 0, 0 };
+	minSumAvx512(post, r, 54, 11, base, shift);
+}
+
+__attribute__((target("avx2")))
+static void c23_1296_2_avx2(float *post, float *r) {
+	static const int base[11] = { 0, 54, 108, 162, 216, 324, 486, 648, 756, 972, 1026 };
+	static const int shift[11] = { 43, 31, 29, 0, 21, 28, 2, 7, 17, 0, 0 };
+	minSumAvx2(post, r, 54, 11, base, shift);
+}
+
+__attribute__((target("avx512f")))
+static void c23_1296_2_avx512(float *post, float *r) {
+	static const int base[11] = { 0, 54, 108, 162, 216, 324, 486, 648, 756, 972, 1026 };
+	static const int shift[11] = { 43, 31, 29, 0, 21, 28, 2, 7, 17, 0, 0 };
+	minSumAvx512(post, r, 54, 11, base, shift);
+}
+
+__attribute__((target("avx2")))
+static void c23_1296_3_avx2(float *post, float *r) {
+	static const int base[11] = { 0, 54, 108, 216, 270, 378, 540, 702, 756, 1026, 1080 };
+	static const int shift[11] = { 20, 33, 48, 4, 13, 26, 22, 46, 42, 0, 0 };
+	minSumAvx2(post, r, 54, 11, base, shift);
+}
+
+__attribute__((target("avx512f")))
+static void c23_1296_3_avx512(float *post, float *r) {
+	static const int base[11] = { 0, 54, 108, 216, 270, 378, 540, 702, 756, 1026, 1080 };
+	static const int shift[11] = { 20, 33, 48, 4, 13, 26, 22, 46, 42, 0, 0 };
+	minSumAvx512(post, r, 54, 11, base, shift);
+}
+
+__attribute__((target("avx2")))
+static void c23_1296_4_avx2(float *post, float *r) {
+	static const int base[11] = { 0, 54, 108, 162, 216, 270, 486, 648, 864, 1080, 1134 };
+	static const int shift[11] = { 45, 7, 18, 51, 12, 25, 50, 5, 0, 0, 0 };
+	minSumAvx2(post, r, 54, 11, base, shift);
+}
+
+__attribute__((target("avx512f")))
+static void c23_1296_4_avx512(float *post, float *r) {
+	static const int base[11] = { 0, 54, 108, 162, 216, 270, 486, 648, 864, 1080, 1134 };
+	static const int shift[11] = { 45, 7, 18, 51, 12, 25, 50, 5, 0, 0, 0 };
+	minSumAvx512(post, r, 54, 11, base, shift);
+}
+
+__attribute__((target("avx2")))
+static void c23_1296_5_avx2(float *post, float *r) {
+	static const int base[11] = { 0, 54, 108, 162, 216, 378, 540, 594, 702, 1134, 1188 };
+	static const int shift[11] = { 35, 40, 32, 16, 5, 18, 43, 51, 32, 0, 0 };
+	minSumAvx2(post, r, 54, 11, base, shift);
+}
+
+__attribute__((target("avx512f")))
+static void c23_1296_5_avx512(float *post, float *r) {
+	static const int base[11] = { 0, 54, 108, 162, 216, 378, 540, 594, 702, 1134, 1188 };
+	static const int shift[11] = { 35, 40, 32, 16, 5, 18, 43, 51, 32, 0, 0 };
+	minSumAvx512(post, r, 54, 11, base, shift);
+}
+
+__attribute__((target("avx2")))
+static void c23_1296_6_avx2(float *post, float *r) {
+	static const int base[11] = { 0, 54, 108, 162, 216, 378, 540, 702, 810, 1188, 1242 };
+	static const int shift[11] = { 9, 24, 13, 22, 28, 37, 25, 52, 13, 0, 0 };
+	minSumAvx2(post, r, 54, 11, base, shift);
+}
+
+__attribute__((target("avx512f")))
+static void c23_1296_6_avx512(float *post, float *r) {
+	static const int base[11] = { 0, 54, 108, 162, 216, 378, 540, 702, 810, 1188, 1242 };
+	static const int shift[11] = { 9, 24, 13, 22, 28, 37, 25, 52, 13, 0, 0 };
+	minSumAvx512(post, r, 54, 11, base, shift);
+}
+
+__attribute__((target("avx2")))
+static void c23_1296_7_avx2(float *post, float *r) {
+	static const int base[11] = { 0, 54, 108, 162, 216, 432, 486, 594, 810, 864, 1242 };
+	static const int shift[11] = { 32, 22, 4, 21, 16, 27, 28, 38, 8, 1, 0 };
+	minSumAvx2(post, r, 54, 11, base, shift);
+}
+
+__attribute__((target("avx512f")))
+static void c23_1296_7_avx512(float *post, float *r) {
+	static const int base[11] = { 0, 54, 108, 162, 216, 432, 486, 594, 810, 864, 1242 };
+	static const int shift[11] = { 32, 22, 4, 21, 16, 27, 28, 38, 8, 1, 0 };
+	minSumAvx512(post, r, 54, 11, base, shift);
+}
+
+#endif
+
+/* ############################################################
+### c23_1944
+############################################################ */
+
+static void c23_1944_0(float *post, float *r) {
+	float *v[11];
+	for (int i = 0; i < 81; i++) {
+		v[0] = post + 0 + (i < 20 ? i + 61 : i - 20);
+		v[1] = post + 81 + (i < 6 ? i + 75 : i - 6);
+		v[2] = post + 162 + (i < 77 ? i + 4 : i - 77);
+		v[3] = post + 243 + (i < 18 ? i + 63 : i - 18);
+		v[4] = post + 324 + (i < 25 ? i + 56 : i - 25);
+		v[5] = post + 891 + (i < 73 ? i + 8 : i - 73);
+		v[6] = post + 1053 + (i < 79 ? i + 2 : i - 79);
+		v[7] = post + 1134 + (i < 64 ? i + 17 : i - 64);
+		v[8] = post + 1215 + (i < 56 ? i + 25 : i - 56);
+		v[9] = post + 1296 + (i < 80 ? i + 1 : i - 80);
+		v[10] = post + 1377 + i;
+		minSum(v, r + i, 11, 81);
+	}
+}
+
+static void c23_1944_1(float *post, float *r) {
+	float *v[11];
+	for (int i = 0; i < 81; i++) {
+		v[0] = post + 0 + (i < 25 ? i + 56 : i - 25);
+		v[1] = post + 81 + (i < 7 ? i + 74 : i - 7);
+		v[2] = post + 162 + (i < 4 ? i + 77 : i - 4);
+		v[3] = post + 243 + (i < 61 ? i + 20 : i - 61);
+		v[4] = post + 567 + (i < 17 ? i + 64 : i - 17);
+		v[5] = post + 648 + (i < 57 ? i + 24 : i - 57);
+		v[6] = post + 729 + (i < 77 ? i + 4 : i - 77);
+		v[7] = post + 810 + (i < 14 ? i + 67 : i - 14);
+		v[8] = post + 972 + (i < 74 ? i + 7 : i - 74);
+		v[9] = post + 1377 + i;
+		v[10] = post + 1458 + i;
+		minSum(v, r + i, 11, 81);
+	}
+}
+
+static void c23_1944_2(float *post, float *r) {
+	float *v[11];
+	for (int i = 0; i < 81; i++) {
+		v[0] = post + 0 + (i < 53 ? i + 28 : i - 53);
+		v[1] = post + 81 + (i < 60 ? i + 21 : i - 60);
+		v[2] = post + 162 + (i < 13 ? i + 68 : i - 13);
+		v[3] = post + 243 + (i < 71 ? i + 10 : i - 71);
+		v[4] = post + 324 + (i < 74 ? i + 7 : i - 74);
+		v[5] = post + 405 + (i < 67 ? i + 14 : i - 67);
+		v[6] = post + 486 + (i < 16 ? i + 65 : i - 16);
+		v[7] = post + 810 + (i < 58 ? i + 23 : i - 58);
+		v[8] = post + 1134 + (i < 6 ? i + 75 : i - 6);
+		v[9] = post + 1458 + i;
+		v[10] = post + 1539 + i;
+		minSum(v, r + i, 11, 81);
+	}
+}
+
+static void c23_1944_3(float *post, float *r) {
+	float *v[11];
+	for (int i = 0; i < 81; i++) {
+		v[0] = post + 0 + (i < 33 ? i + 48 : i - 33);
+		v[1] = post + 81 + (i < 43 ? i + 38 : i - 43);
+		v[2] = post + 162 + (i < 38 ? i + 43 : i - 38);
+		v[3] = post + 243 + (i < 3 ? i + 78 : i - 3);
+		v[4] = post + 324 + (i < 5 ? i + 76 : i - 5);
+		v[5] = post + 729 + (i < 76 ? i + 5 : i - 76);
+		v[6] = post + 810 + (i < 45 ? i + 36 : i - 45);
+		v[7] = post + 972 + (i < 66 ? i + 15 : i - 66);
+		v[8] = post + 1053 + (i < 9 ? i + 72 : i - 9);
+		v[9] = post + 1539 + i;
+		v[10] = post + 1620 + i;
+		minSum(v, r + i, 11, 81);
+	}
+}
+
+static void c23_1944_4(float *post, float *r) {
+	float *v[11];
+	for (int i = 0; i < 81; i++) {
+		v[0] = post + 0 + (i < 41 ? i + 40 : i - 41);
+		v[1] = post + 81 + (i < 79 ? i + 2 : i - 79);
+		v[2] = post + 162 + (i < 28 ? i + 53 : i - 28);
+		v[3] = post + 243 + (i < 56 ? i + 25 : i - 56);
+		v[4] = post + 405 + (i < 29 ? i + 52 : i - 29);
+		v[5] = post + 486 + (i < 19 ? i + 62 : i - 19);
+		v[6] = post + 648 + (i < 61 ? i + 20 : i - 61);
+		v[7] = post + 891 + (i < 37 ? i + 44 : i - 37);
+		v[8] = post + 1296 + i;
+		v[9] = post + 1620 + i;
+		v[10] = post + 1701 + i;
+		minSum(v, r + i, 11, 81);
+	}
+}
+
+static void c23_1944_5(float *post, float *r) {
+	float *v[11];
+	for (int i = 0; i < 81; i++) {
+		v[0] = post + 0 + (i < 12 ? i + 69 : i - 12);
+		v[1] = post + 81 + (i < 58 ? i + 23 : i - 58);
+		v[2] = post + 162 + (i < 17 ? i + 64 : i - 17);
+		v[3] = post + 243 + (i < 71 ? i + 10 : i - 71);
+		v[4] = post + 324 + (i < 59 ? i + 22 : i - 59);
+		v[5] = post + 486 + (i < 60 ? i + 21 : i - 60);
+		v[6] = post + 972 + (i < 13 ? i + 68 : i - 13);
+		v[7] = post + 1053 + (i < 58 ? i + 23 : i - 58);
+		v[8] = post + 1134 + (i < 52 ? i + 29 : i - 52);
+		v[9] = post + 1701 + i;
+		v[10] = post + 1782 + i;
+		minSum(v, r + i, 11, 81);
+	}
+}
+
+static void c23_1944_6(float *post, float *r) {
+	float *v[11];
+	for (int i = 0; i < 81; i++) {
+		v[0] = post + 0 + (i < 69 ? i + 12 : i - 69);
+		v[1] = post + 81 + i;
+		v[2] = post + 162 + (i < 13 ? i + 68 : i - 13);
+		v[3] = post + 243 + (i < 61 ? i + 20 : i - 61);
+		v[4] = post + 324 + (i < 26 ? i + 55 : i - 26);
+		v[5] = post + 405 + (i < 20 ? i + 61 : i - 20);
+		v[6] = post + 567 + (i < 41 ? i + 40 : i - 41);
+		v[7] = post + 891 + (i < 29 ? i + 52 : i - 29);
+		v[8] = post + 1215 + (i < 37 ? i + 44 : i - 37);
+		v[9] = post + 1782 + i;
+		v[10] = post + 1863 + i;
+		minSum(v, r + i, 11, 81);
+	}
+}
+
+static void c23_1944_7(float *post, float *r) {
+	float *v[11];
+	for (int i = 0; i < 81; i++) {
+		v[0] = post + 0 + (i < 23 ? i + 58 : i - 23);
+		v[1] = post + 81 + (i < 73 ? i + 8 : i - 73);
+		v[2] = post + 162 + (i < 47 ? i + 34 : i - 47);
+		v[3] = post + 243 + (i < 17 ? i + 64 : i - 17);
+		v[4] = post + 324 + (i < 3 ? i + 78 : i - 3);
+		v[5] = post + 567 + (i < 70 ? i + 11 : i - 70);
+		v[6] = post + 648 + (i < 3 ? i + 78 : i - 3);
+		v[7] = post + 729 + (i < 57 ? i + 24 : i - 57);
+		v[8] = post + 1215 + (i < 23 ? i + 58 : i - 23);
+		v[9] = post + 1296 + (i < 80 ? i + 1 : i - 80);
+		v[10] = post + 1863 + i;
+		minSum(v, r + i, 11, 81);
+	}
+}
+
+#ifdef ISA_X86
+__attribute__((target("avx2")))
+static void c23_1944_0_avx2(float *post, float *r) {
+	static const int base[11] = { 0, 81, 162, 243, 324, 891, 1053, 1134, 1215, 1296, 1377 };
+	static const int shift[11] = { 61, 75, 4, 63, 56, 8, 2, 17, 25, 1, 0 };
+	minSumAvx2(post, r, 81, 11, base, shift);
+}
+
+__attribute__((target("avx512f")))
+static void c23_1944_0_avx512(float *post, float *r) {
+	static const int base[11] = { 0, 81, 162, 243, 324, 891, 1053, 1134, 1215, 1296, 1377 };
+	static const int shift[11] = { 61, 75, 4, 63, 56, 8, 2, 17, 25, 1, 0 };
+	minSumAvx512(post, r, 81, 11, base, shift);
+}
+
+__attribute__((target("avx2")))
+static void c23_1944_1_avx2(float *post, float *r) {
+	static const int base[11] = { 0, 81, 162, 243, 567, 648, 729, 810, 972, 1377, 1458 };
+	static const int shift[11] = { 56, 74, 77, 20, 64, 24, 4, 67, 7, 0, 0 };
+	minSumAvx2(post, r, 81, 11, base, shift);
+}
+
+__attribute__((target("avx512f")))
+static void c23_1944_1_avx512(float *post, float *r) {
+	static const int base[11] = { 0, 81, 162, 243, 567, 648, 729, 810, 972, 1377, 1458 };
+	static const int shift[11] = { 56, 74, 77, 20, 64, 24, 4, 67, 7, 0, 0 };
+	minSumAvx512(post, r, 81, 11, base, shift);
+}
+
+__attribute__((target("avx2")))
+static void c23_1944_2_avx2(float *post, float *r) {
+	static const int base[11] = { 0, 81, 162, 243, 324, 405, 486, 810, 1134, 1458, 1539 };
+	static const int shift[11] = { 28, 21, 68, 10, 7, 14, 65, 23, 75, 0, 0 };
+	minSumAvx2(post, r, 81, 11, base, shift);
+}
+
+__attribute__((target("avx512f")))
+static void c23_1944_2_avx512(float *post, float *r) {
+	static const int base[11] = { 0, 81, 162, 243, 324, 405, 486, 810, 1134, 1458, 1539 };
+	static const int shift[11] = { 28, 21, 68, 10, 7, 14, 65, 23, 75, 0, 0 };
+	minSumAvx512(post, r, 81, 11, base, shift);
+}
+
+__attribute__((target("avx2")))
+static void c23_1944_3_avx2(float *post, float *r) {
+	static const int base[11] = { 0, 81, 162, 243, 324, 729, 810, 972, 1053, 1539, 1620 };
+	static const int shift[11] = { 48, 38, 43, 78, 76, 5, 36, 15, 72, 0, 0 };
+	minSumAvx2(post, r, 81, 11, base, shift);
+}
+
+__attribute__((target("avx512f")))
+static void c23_1944_3_avx512(float *post, float *r) {
+	static const int base[11] = { 0, 81, 162, 243, 324, 729, 810, 972, 1053, 1539, 1620 };
+	static const int shift[11] = { 48, 38, 43, 78, 76, 5, 36, 15, 72, 0, 0 };
+	minSumAvx512(post, r, 81, 11, base, shift);
+}
+
+__attribute__((target("avx2")))
+static void c23_1944_4_avx2(float *post, float *r) {
+	static const int base[11] = { 0, 81, 162, 243, 405, 486, 648, 891, 1296, 1620, 1701 };
+	static const int shift[11] = { 40, 2, 53, 25, 52, 62, 20, 44, 0, 0, 0 };
+	minSumAvx2(post, r, 81, 11, base, shift);
+}
+
+__attribute__((target("avx512f")))
+static void c23_1944_4_avx512(float *post, float *r) {
+	static const int base[11] = { 0, 81, 162, 243, 405, 486, 648, 891, 1296, 1620, 1701 };
+	static const int shift[11] = { 40, 2, 53, 25, 52, 62, 20, 44, 0, 0, 0 };
+	minSumAvx512(post, r, 81, 11, base, shift);
+}
+
+__attribute__((target("avx2")))
+static void c23_1944_5_avx2(float *post, float *r) {
+	static const int base[11] = { 0, 81, 162, 243, 324, 486, 972, 1053, 1134, 1701, 1782 };
+	static const int shift[11] = { 69, 23, 64, 10, 22, 21, 68, 23, 29, 0, 0 };
+	minSumAvx2(post, r, 81, 11, base, shift);
+}
+
+__attribute__((target("avx512f")))
+static void c23_1944_5_avx512(float *post, float *r) {
+	static const int base[11] = { 0, 81, 162, 243, 324, 486, 972, 1053, 1134, 1701, 1782 };
+	static const int shift[11] = { 69, 23, 64, 10, 22, 21, 68, 23, 29, 0, 0 };
+	minSumAvx512(post, r, 81, 11, base, shift);
+}
+
+__attribute__((target("avx2")))
+static void c23_1944_6_avx2(float *post, float *r) {
+	static const int base[11] = { 0, 81, 162, 243, 324, 405, 567, 891, 1215, 1782, 1863 };
+	static const int shift[11] = { 12, 0, 68, 20, 55, 61, 40, 52, 44, 0, 0 };
+	minSumAvx2(post, r, 81, 11, base, shift);
+}
+
+__attribute__((target("avx512f")))
+static void c23_1944_6_avx512(float *post, float *r) {
+	static const int base[11] = { 0, 81, 162, 243, 324, 405, 567, 891, 1215, 1782, 1863 };
+	static const int shift[11] = { 12, 0, 68, 20, 55, 61, 40, 52, 44, 0, 0 };
+	minSumAvx512(post, r, 81, 11, base, shift);
+}
+
+__attribute__((target("avx2")))
+static void c23_1944_7_avx2(float *post, float *r) {
+	static const int base[11] = { 0, 81, 162, 243, 324, 567, 648, 729, 1215, 1296, 1863 };
+	static const int shift[11] = { 58, 8, 34, 64, 78, 11, 78, 24, 58, 1, 0 };
+	minSumAvx2(post, r, 81, 11, base, shift);
+}
+
+__attribute__((target("avx512f")))
+static void c23_1944_7_avx512(float *post, float *r) {
+	static const int base[11] = { 0, 81, 162, 243, 324, 567, 648, 729, 1215, 1296, 1863 };
+	static const int shift[11] = { 58, 8, 34, 64, 78, 11, 78, 24, 58, 1, 0 };
+	minSumAvx512(post, r, 81, 11, base, shift);
+}
+
+#endif
+
+/* ############################################################
+### c34_648
+############################################################ */
+
+static void c34_648_0(float *post, float *r) {
+	float *v[15];
+	for (int i = 0; i < 27; i++) {
+		v[0] = post + 0 + (i < 11 ? i + 16 : i - 11);
+		v[1] = post + 27 + (i < 10 ? i + 17 : i - 10);
+		v[2] = post + 54 + (i < 5 ? i + 22 : i - 5);
+		v[3] = post + 81 + (i < 3 ? i + 24 : i - 3);
+		v[4] = post + 108 + (i < 18 ? i + 9 : i - 18);
+		v[5] = post + 135 + (i < 24 ? i + 3 : i - 24);
+		v[6] = post + 162 + (i < 13 ? i + 14 : i - 13);
+		v[7] = post + 216 + (i < 23 ? i + 4 : i - 23);
+		v[8] = post + 243 + (i < 25 ? i + 2 : i - 25);
+		v[9] = post + 270 + (i < 20 ? i + 7 : i - 20);
+		v[10] = post + 324 + (i < 1 ? i + 26 : i - 1);
+		v[11] = post + 378 + (i < 25 ? i + 2 : i - 25);
+		v[12] = post + 432 + (i < 6 ? i + 21 : i - 6);
+		v[13] = post + 486 + (i < 26 ? i + 1 : i - 26);
+		v[14] = post + 513 + i;
+		minSum(v, r + i, 15, 27);
+	}
+}
+
+static void c34_648_1(float *post, float *r) {
+	float *v[15];
+	for (int i = 0; i < 27; i++) {
+		v[0] = post + 0 + (i < 2 ? i + 25 : i - 2);
+		v[1] = post + 27 + (i < 15 ? i + 12 : i - 15);
+		v[2] = post + 54 + (i < 15 ? i + 12 : i - 15);
+		v[3] = post + 81 + (i < 24 ? i + 3 : i - 24);
+		v[4] = post + 108 + (i < 24 ? i + 3 : i - 24);
+		v[5] = post + 135 + (i < 1 ? i + 26 : i - 1);
+		v[6] = post + 162 + (i < 21 ? i + 6 : i - 21);
+		v[7] = post + 189 + (i < 6 ? i + 21 : i - 6);
+		v[8] = post + 243 + (i < 12 ? i + 15 : i - 12);
+		v[9] = post + 270 + (i < 5 ? i + 22 : i - 5);
+		v[10] = post + 324 + (i < 12 ? i + 15 : i - 12);
+		v[11] = post + 378 + (i < 23 ? i + 4 : i - 23);
+		v[12] = post + 459 + (i < 11 ? i + 16 : i - 11);
+		v[13] = post + 513 + i;
+		v[14] = post + 540 + i;
+		minSum(v, r + i, 15, 27);
+	}
+}
+
+static void c34_648_2(float *post, float *r) {
+	float *v[15];
+	for (int i = 0; i < 27; i++) {
+		v[0] = post + 0 + (i < 2 ? i + 25 : i - 2);
+		v[1] = post + 27 + (i < 9 ? i + 18 : i - 9);
+		v[2] = post + 54 + (i < 1 ? i + 26 : i - 1);
+		v[3] = post + 81 + (i < 11 ? i + 16 : i - 11);
+		v[4] = post + 108 + (i < 5 ? i + 22 : i - 5);
+		v[5] = post + 135 + (i < 4 ? i + 23 : i - 4);
+		v[6] = post + 162 + (i < 18 ? i + 9 : i - 18);
+		v[7] = post + 216 + i;
+		v[8] = post + 270 + (i < 23 ? i + 4 : i - 23);
+		v[9] = post + 324 + (i < 23 ? i + 4 : i - 23);
+		v[10] = post + 378 + (i < 19 ? i + 8 : i - 19);
+		v[11] = post + 405 + (i < 4 ? i + 23 : i - 4);
+		v[12] = post + 432 + (i < 16 ? i + 11 : i - 16);
+		v[13] = post + 540 + i;
+		v[14] = post + 567 + i;
+		minSum(v, r + i, 15, 27);
+	}
+}
+
+static void c34_648_3(float *post, float *r) {
+	float *v[14];
+	for (int i = 0; i < 27; i++) {
+		v[0] = post + 0 + (i < 18 ? i + 9 : i - 18);
+		v[1] = post + 27 + (i < 20 ? i + 7 : i - 20);
+		v[2] = post + 54 + i;
+		v[3] = post + 81 + (i < 26 ? i + 1 : i - 26);
+		v[4] = post + 108 + (i < 10 ? i + 17 : i - 10);
+		v[5] = post + 189 + (i < 20 ? i + 7 : i - 20);
+		v[6] = post + 216 + (i < 24 ? i + 3 : i - 24);
+		v[7] = post + 270 + (i < 24 ? i + 3 : i - 24);
+		v[8] = post + 297 + (i < 4 ? i + 23 : i - 4);
+		v[9] = post + 351 + (i < 11 ? i + 16 : i - 11);
+		v[10] = post + 432 + (i < 6 ? i + 21 : i - 6);
+		v[11] = post + 486 + i;
+		v[12] = post + 567 + i;
+		v[13] = post + 594 + i;
+		minSum(v, r + i, 14, 27);
+	}
+}
+
+static void c34_648_4(float *post, float *r) {
+	float *v[14];
+	for (int i = 0; i < 27; i++) {
+		v[0] = post + 0 + (i < 3 ? i + 24 : i - 3);
+		v[1] = post + 27 + (i < 22 ? i + 5 : i - 22);
+		v[2] = post + 54 + (i < 1 ? i + 26 : i - 1);
+		v[3] = post + 81 + (i < 20 ? i + 7 : i - 20);
+		v[4] = post + 108 + (i < 26 ? i + 1 : i - 26);
+		v[5] = post + 189 + (i < 12 ? i + 15 : i - 12);
+		v[6] = post + 216 + (i < 3 ? i + 24 : i - 3);
+		v[7] = post + 243 + (i < 12 ? i + 15 : i - 12);
+		v[8] = post + 297 + (i < 19 ? i + 8 : i - 19);
+		v[9] = post + 351 + (i < 14 ? i + 13 : i - 14);
+		v[10] = post + 405 + (i < 14 ? i + 13 : i - 14);
+		v[11] = post + 459 + (i < 16 ? i + 11 : i - 16);
+		v[12] = post + 594 + i;
+		v[13] = post + 621 + i;
+		minSum(v, r + i, 14, 27);
+	}
+}
+
+static void c34_648_5(float *post, float *r) {
+	float *v[15];
+	for (int i = 0; i < 27; i++) {
+		v[0] = post + 0 + (i < 25 ? i + 2 : i - 25);
+		v[1] = post + 27 + (i < 25 ? i + 2 : i - 25);
+		v[2] = post + 54 + (i < 8 ? i + 19 : i - 8);
+		v[3] = post + 81 + (i < 13 ? i + 14 : i - 13);
+		v[4] = post + 108 + (i < 3 ? i + 24 : i - 3);
+		v[5] = post + 135 + (i < 26 ? i + 1 : i - 26);
+		v[6] = post + 162 + (i < 12 ? i + 15 : i - 12);
+		v[7] = post + 189 + (i < 8 ? i + 19 : i - 8);
+		v[8] = post + 243 + (i < 6 ? i + 21 : i - 6);
+		v[9] = post + 297 + (i < 25 ? i + 2 : i - 25);
+		v[10] = post + 351 + (i < 3 ? i + 24 : i - 3);
+		v[11] = post + 405 + (i < 24 ? i + 3 : i - 24);
+		v[12] = post + 459 + (i < 25 ? i + 2 : i - 25);
+		v[13] = post + 486 + (i < 26 ? i + 1 : i - 26);
+		v[14] = post + 621 + i;
+		minSum(v, r + i, 15, 27);
+	}
+}
+
+#ifdef ISA_X86
+__attribute__((target("avx2")))
+static void c34_648_0_avx2(float *post, float *r) {
+	static const int base[15] = { 0, 27, 54, 81, 108, 135, 162, 216, 243, 270, 324, 378, 432, 486, 513 };
+	static const int shift[15] = { 16, 17, 22, 24, 9, 3, 14, 4, 2, 7, 26, 2, 21, 1, 0 };
+	minSumAvx2(post, r, 27, 15, base, shift);
+}
+
+__attribute__((target("avx512f")))
+static void c34_648_0_avx512(float *post, float *r) {
+	static const int base[15] = { 0, 27, 54, 81, 108, 135, 162, 216, 243, 270, 324, 378, 432, 486, 513 };
+	static const int shift[15] = { 16, 17, 22, 24, 9, 3, 14, 4, 2, 7, 26, 2, 21, 1, 0 };
+	minSumAvx512(post, r, 27, 15, base, shift);
+}
+
+__attribute__((target("avx2")))
+static void c34_648_1_avx2(float *post, float *r) {
+	static const int base[15] = { 0, 27, 54, 81, 108, 135, 162, 189, 243, 270, 324, 378, 459, 513, 540 };
+	static const int shift[15] = { 25, 12, 12, 3, 3, 26, 6, 21, 15, 22, 15, 4, 16, 0, 0 };
+	minSumAvx2(post, r, 27, 15, base, shift);
+}
+
+__attribute__((target("avx512f")))
+static void c34_648_1_avx512(float *post, float *r) {
+	static const int base[15] = { 0, 27, 54, 81, 108, 135, 162, 189, 243, 270, 324, 378, 459, 513, 540 };
+	static const int shift[15] = { 25, 12, 12, 3, 3, 26, 6, 21, 15, 22, 15, 4, 16, 0, 0 };
+	minSumAvx512(post, r, 27, 15, base, shift);
+}
+
+__attribute__((target("avx2")))
+static void c34_648_2_avx2(float *post, float *r) {
+	static const int base[15] = { 0, 27, 54, 81, 108, 135, 162, 216, 270, 324, 378, 405, 432, 540, 567 };
+	static const int shift[15] = { 25, 18, 26, 16, 22, 23, 9, 0, 4, 4, 8, 23, 11, 0, 0 };
+	minSumAvx2(post, r, 27, 15, base, shift);
+}
+
+__attribute__((target("avx512f")))
+static void c34_648_2_avx512(float *post, float *r) {
+	static const int base[15] = { 0, 27, 54, 81, 108, 135, 162, 216, 270, 324, 378, 405, 432, 540, 567 };
+	static const int shift[15] = { 25, 18, 26, 16, 22, 23, 9, 0, 4, 4, 8, 23, 11, 0, 0 };
+	minSumAvx512(post, r, 27, 15, base, shift);
+}
+
+__attribute__((target("avx2")))
+static void c34_648_3_avx2(float *post, float *r) {
+	static const int base[14] = { 0, 27, 54, 81, 108, 189, 216, 270, 297, 351, 432, 486, 567, 594 };
+	static const int shift[14] = { 9, 7, 0, 1, 17, 7, 3, 3, 23, 16, 21, 0, 0, 0 };
+	minSumAvx2(post, r, 27, 14, base, shift);
+}
+
+__attribute__((target("avx512f")))
+static void c34_648_3_avx512(float *post, float *r) {
+	static const int base[14] = { 0, 27, 54, 81, 108, 189, 216, 270, 297, 351, 432, 486, 567, 594 };
+	static const int shift[14] = { 9, 7, 0, 1, 17, 7, 3, 3, 23, 16, 21, 0, 0, 0 };
+	minSumAvx512(post, r, 27, 14, base, shift);
+}
+
+__attribute__((target("avx2")))
+static void c34_648_4_avx2(float *post, float *r) {
+	static const int base[14] = { 0, 27, 54, 81, 108, 189, 216, 243, 297, 351, 405, 459, 594, 621 };
+	static const int shift[14] = { 24, 5, 26, 7, 1, 15, 24, 15, 8, 13, 13, 11, 0, 0 };
+	minSumAvx2(post, r, 27, 14, base, shift);
+}
+
+__attribute__((target("avx512f")))
+static void c34_648_4_avx512(float *post, float *r) {
+	static const int base[14] = { 0, 27, 54, 81, 108, 189, 216, 243, 297, 351, 405, 459, 594, 621 };
+	static const int shift[14] = { 24, 5, 26, 7, 1, 15, 24, 15, 8, 13, 13, 11, 0, 0 };
+	minSumAvx512(post, r, 27, 14, base, shift);
+}
+
+__attribute__((target("avx2")))
+static void c34_648_5_avx2(float *post, float *r) {
+	static const int base[15] = { 0, 27, 54, 81, 108, 135, 162, 189, 243, 297, 351, 405, 459, 486, 621 };
+	static const int shift[15] = { 2, 2, 19, 14, 24, 1, 15, 19, 21, 2, 24, 3, 2, 1, 0 };
+	minSumAvx2(post, r, 27, 15, base, shift);
+}
+
+__attribute__((target("avx512f")))
+static void c34_648_5_avx512(float *post, float *r) {
+	static const int base[15] = { 0, 27, 54, 81, 108, 135, 162, 189, 243, 297, 351, 405, 459, 486, 621 };
+	static const int shift[15] = { 2, 2, 19, 14, 24, 1, 15, 19, 21, 2, 24, 3, 2, 1, 0 };
+	minSumAvx512(post, r, 27, 15, base, shift);
+}
+
+#endif
+
+/* ############################################################
+### c34_1296
+############################################################ */
+
+static void c34_1296_0(float *post, float *r) {
+	float *v[15];
+	for (int i = 0; i < 54; i++) {
+		v[0] = post + 0 + (i < 15 ? i + 39 : i - 15);
+		v[1] = post + 54 + (i < 14 ? i + 40 : i - 14);
+		v[2] = post + 108 + (i < 3 ? i + 51 : i - 3);
+		v[3] = post + 162 + (i < 13 ? i + 41 : i - 13);
+		v[4] = post + 216 + (i < 51 ? i + 3 : i - 51);
+		v[5] = post + 270 + (i < 25 ? i + 29 : i - 25);
+		v[6] = post + 324 + (i < 46 ? i + 8 : i - 46);
+		v[7] = post + 378 + (i < 18 ? i + 36 : i - 18);
+		v[8] = post + 486 + (i < 40 ? i + 14 : i - 40);
+		v[9] = post + 594 + (i < 48 ? i + 6 : i - 48);
+		v[10] = post + 702 + (i < 21 ? i + 33 : i - 21);
+		v[11] = post + 810 + (i < 43 ? i + 11 : i - 43);
+		v[12] = post + 918 + (i < 50 ? i + 4 : i - 50);
+		v[13] = post + 972 + (i < 53 ? i + 1 : i - 53);
+		v[14] = post + 1026 + i;
+		minSum(v, r + i, 15, 54);
+	}
+}
+
+static void c34_1296_1(float *post, float *r) {
+	float *v[14];
+	for (int i = 0; i < 54; i++) {
+		v[0] = post + 0 + (i < 6 ? i + 48 : i - 6);
+		v[1] = post + 54 + (i < 33 ? i + 21 : i - 33);
+		v[2] = post + 108 + (i < 7 ? i + 47 : i - 7);
+		v[3] = post + 162 + (i < 45 ? i + 9 : i - 45);
+		v[4] = post + 216 + (i < 6 ? i + 48 : i - 6);
+		v[5] = post + 270 + (i < 19 ? i + 35 : i - 19);
+		v[6] = post + 324 + (i < 3 ? i + 51 : i - 3);
+		v[7] = post + 432 + (i < 16 ? i + 38 : i - 16);
+		v[8] = post + 540 + (i < 26 ? i + 28 : i - 26);
+		v[9] = post + 648 + (i < 20 ? i + 34 : i - 20);
+		v[10] = post + 756 + (i < 4 ? i + 50 : i - 4);
+		v[11] = post + 864 + (i < 4 ? i + 50 : i - 4);
+		v[12] = post + 1026 + i;
+		v[13] = post + 1080 + i;
+		minSum(v, r + i, 14, 54);
+	}
+}
+
+static void c34_1296_2(float *post, float *r) {
+	float *v[15];
+	for (int i = 0; i < 54; i++) {
+		v[0] = post + 0 + (i < 24 ? i + 30 : i - 24);
+		v[1] = post + 54 + (i < 15 ? i + 39 : i - 15);
+		v[2] = post + 108 + (i < 26 ? i + 28 : i - 26);
+		v[3] = post + 162 + (i < 12 ? i + 42 : i - 12);
+		v[4] = post + 216 + (i < 4 ? i + 50 : i - 4);
+		v[5] = post + 270 + (i < 15 ? i + 39 : i - 15);
+		v[6] = post + 324 + (i < 49 ? i + 5 : i - 49);
+		v[7] = post + 378 + (i < 37 ? i + 17 : i - 37);
+		v[8] = post + 486 + (i < 48 ? i + 6 : i - 48);
+		v[9] = post + 594 + (i < 36 ? i + 18 : i - 36);
+		v[10] = post + 702 + (i < 34 ? i + 20 : i - 34);
+		v[11] = post + 810 + (i < 39 ? i + 15 : i - 39);
+		v[12] = post + 918 + (i < 14 ? i + 40 : i - 14);
+		v[13] = post + 1080 + i;
+		v[14] = post + 1134 + i;
+		minSum(v, r + i, 15, 54);
+	}
+}
+
+static void c34_1296_3(float *post, float *r) {
+	float *v[15];
+	for (int i = 0; i < 54; i++) {
+		v[0] = post + 0 + (i < 25 ? i + 29 : i - 25);
+		v[1] = post + 54 + i;
+		v[2] = post + 108 + (i < 53 ? i + 1 : i - 53);
+		v[3] = post + 162 + (i < 11 ? i + 43 : i - 11);
+		v[4] = post + 216 + (i < 18 ? i + 36 : i - 18);
+		v[5] = post + 270 + (i < 24 ? i + 30 : i - 24);
+		v[6] = post + 324 + (i < 7 ? i + 47 : i - 7);
+		v[7] = post + 432 + (i < 5 ? i + 49 : i - 5);
+		v[8] = post + 540 + (i < 7 ? i + 47 : i - 7);
+		v[9] = post + 648 + (i < 51 ? i + 3 : i - 51);
+		v[10] = post + 756 + (i < 19 ? i + 35 : i - 19);
+		v[11] = post + 864 + (i < 20 ? i + 34 : i - 20);
+		v[12] = post + 972 + i;
+		v[13] = post + 1134 + i;
+		v[14] = post + 1188 + i;
+		minSum(v, r + i, 15, 54);
+	}
+}
+
+static void c34_1296_4(float *post, float *r) {
+	float *v[15];
+	for (int i = 0; i < 54; i++) {
+		v[0] = post + 0 + (i < 53 ? i + 1 : i - 53);
+		v[1] = post + 54 + (i < 22 ? i + 32 : i - 22);
+		v[2] = post + 108 + (i < 43 ? i + 11 : i - 43);
+		v[3] = post + 162 + (i < 31 ? i + 23 : i - 31);
+		v[4] = post + 216 + (i < 44 ? i + 10 : i - 44);
+		v[5] = post + 270 + (i < 10 ? i + 44 : i - 10);
+		v[6] = post + 324 + (i < 42 ? i + 12 : i - 42);
+		v[7] = post + 378 + (i < 47 ? i + 7 : i - 47);
+		v[8] = post + 486 + (i < 6 ? i + 48 : i - 6);
+		v[9] = post + 594 + (i < 50 ? i + 4 : i - 50);
+		v[10] = post + 702 + (i < 45 ? i + 9 : i - 45);
+		v[11] = post + 810 + (i < 37 ? i + 17 : i - 37);
+		v[12] = post + 918 + (i < 38 ? i + 16 : i - 38);
+		v[13] = post + 1188 + i;
+		v[14] = post + 1242 + i;
+		minSum(v, r + i, 15, 54);
+	}
+}
+
+static void c34_1296_5(float *post, float *r) {
+	float *v[14];
+	for (int i = 0; i < 54; i++) {
+		v[0] = post + 0 + (i < 41 ? i + 13 : i - 41);
+		v[1] = post + 54 + (i < 47 ? i + 7 : i - 47);
+		v[2] = post + 108 + (i < 39 ? i + 15 : i - 39);
+		v[3] = post + 162 + (i < 7 ? i + 47 : i - 7);
+		v[4] = post + 216 + (i < 31 ? i + 23 : i - 31);
+		v[5] = post + 270 + (i < 38 ? i + 16 : i - 38);
+		v[6] = post + 324 + (i < 7 ? i + 47 : i - 7);
+		v[7] = post + 432 + (i < 11 ? i + 43 : i - 11);
+		v[8] = post + 540 + (i < 25 ? i + 29 : i - 25);
+		v[9] = post + 648 + (i < 2 ? i + 52 : i - 2);
+		v[10] = post + 756 + (i < 52 ? i + 2 : i - 52);
+		v[11] = post + 864 + (i < 1 ? i + 53 : i - 1);
+		v[12] = post + 972 + (i < 53 ? i + 1 : i - 53);
+		v[13] = post + 1242 + i;
+		minSum(v, r + i, 14, 54);
+	}
+}
+
+#ifdef ISA_X86
+__attribute__((target("avx2")))
+static void c34_1296_0_avx2(float *post, float *r) {
+	static const int base[15] = { 0, 54, 108, 162, 216, 270, 324, 378, 486, 594, 702, 810, 918, 972, 1026 };
+	static const int shift[15] = { 39, 40, 51, 41, 3, 29, 8, 36, 14, 6, 33, 11, 4, 1, 0 };
+	minSumAvx2(post, r, 54, 15, base, shift);
+}
+
+__attribute__((target("avx512f")))
+static void c34_1296_0_avx512(float *post, float *r) {
+	static const int base[15] = { 0, 54, 108, 162, 216, 270, 324, 378, 486, 594, 702, 810, 918, 972, 1026 };
+	static const int shift[15] = { 39, 40, 51, 41, 3, 29, 8, 36, 14, 6, 33, 11, 4, 1, 0 };
+	minSumAvx512(post, r, 54, 15, base, shift);
+}
+
+__attribute__((target("avx2")))
+static void c34_1296_1_avx2(float *post, float *r) {
+	static const int base[14] = { 0, 54, 108, 162, 216, 270, 324, 432, 540, 648, 756, 864, 1026, 1080 };
+	static const int shift[14] = { 48, 21, 47, 9, 48, 35, 51, 38, 28, 34, 50, 50, 0, 0 };
+	minSumAvx2(post, r, 54, 14, base, shift);
+}
+
+__attribute__((target("avx512f")))
+static void c34_1296_1_avx512(float *post, float *r) {
+	static const int base[14] = { 0, 54, 108, 162, 216, 270, 324, 432, 540, 648, 756, 864, 1026, 1080 };
+	static const int shift[14] = { 48, 21, 47, 9, 48, 35, 51, 38, 28, 34, 50, 50, 0, 0 };
+	minSumAvx512(post, r, 54, 14, base, shift);
+}
+
+__attribute__((target("avx2")))
+static void c34_1296_2_avx2(float *post, float *r) {
+	static const int base[15] = { 0, 54, 108, 162, 216, 270, 324, 378, 486, 594, 702, 810, 918, 1080, 1134 };
+	static const int shift[15] = { 30, 39, 28, 42, 50, 39, 5, 17, 6, 18, 20, 15, 40, 0, 0 };
+	minSumAvx2(post, r, 54, 15, base, shift);
+}
+
+__attribute__((target("avx512f")))
+static void c34_1296_2_avx512(float *post, float *r) {
+	static const int base[15] = { 0, 54, 108, 162, 216, 270, 324, 378, 486, 594, 702, 810, 918, 1080, 1134 };
+	static const int shift[15] = { 30, 39, 28, 42, 50, 39, 5, 17, 6, 18, 20, 15, 40, 0, 0 };
+	minSumAvx512(post, r, 54, 15, base, shift);
+}
+
+__attribute__((target("avx2")))
+static void c34_1296_3_avx2(float *post, float *r) {
+	static const int base[15] = { 0, 54, 108, 162, 216, 270, 324, 432, 540, 648, 756, 864, 972, 1134, 1188 };
+	static const int shift[15] = { 29, 0, 1, 43, 36, 30, 47, 49, 47, 3, 35, 34, 0, 0, 0 };
+	minSumAvx2(post, r, 54, 15, base, shift);
+}
+
+__attribute__((target("avx512f")))
+static void c34_1296_3_avx512(float *post, float *r) {
+	static const int base[15] = { 0, 54, 108, 162, 216, 270, 324, 432, 540, 648, 756, 864, 972, 1134, 1188 };
+	static const int shift[15] = { 29, 0, 1, 43, 36, 30, 47, 49, 47, 3, 35, 34, 0, 0, 0 };
+	minSumAvx512(post, r, 54, 15, base, shift);
+}
+
+__attribute__((target("avx2")))
+static void c34_1296_4_avx2(float *post, float *r) {
+	static const int base[15] = { 0, 54, 108, 162, 216, 270, 324, 378, 486, 594, 702, 810, 918, 1188, 1242 };
+	static const int shift[15] = { 1, 32, 11, 23, 10, 44, 12, 7, 48, 4, 9, 17, 16, 0, 0 };
+	minSumAvx2(post, r, 54, 15, base, shift);
+}
+
+__attribute__((target("avx512f")))
+static void c34_1296_4_avx512(float *post, float *r) {
+	static const int base[15] = { 0, 54, 108, 162, 216, 270, 324, 378, 486, 594, 702, 810, 918, 1188, 1242 };
+	static const int shift[15] = { 1, 32, 11, 23, 10, 44, 12, 7, 48, 4, 9, 17, 16, 0, 0 };
+	minSumAvx512(post, r, 54, 15, base, shift);
+}
+
+__attribute__((target("avx2")))
+static void c34_1296_5_avx2(float *post, float *r) {
+	static const int base[14] = { 0, 54, 108, 162, 216, 270, 324, 432, 540, 648, 756, 864, 972, 1242 };
+	static const int shift[14] = { 13, 7, 15, 47, 23, 16, 47, 43, 29, 52, 2, 53, 1, 0 };
+	minSumAvx2(post, r, 54, 14, base, shift);
+}
+
+__attribute__((target("avx512f")))
+static void c34_1296_5_avx512(float *post, float *r) {
+	static const int base[14] = { 0, 54, 108, 162, 216, 270, 324, 432, 540, 648, 756, 864, 972, 1242 };
+	static const int shift[14] = { 13, 7, 15, 47, 23, 16, 47, 43, 29, 52, 2, 53, 1, 0 };
+	minSumAvx512(post, r, 54, 14, base, shift);
+}
+
+#endif
+
+/* ############################################################
+### c34_1944
+############################################################ */
+
+static void c34_1944_0(float *post, float *r) {
+	float *v[14];
+	for (int i = 0; i < 81; i++) {
+		v[0] = post + 0 + (i < 33 ? i + 48 : i - 33);
+		v[1] = post + 81 + (i < 52 ? i + 29 : i - 52);
+		v[2] = post + 162 + (i < 53 ? i + 28 : i - 53);
+		v[3] = post + 243 + (i < 42 ? i + 39 : i - 42);
+		v[4] = post + 324 + (i < 72 ? i + 9 : i - 72);
+		v[5] = post + 405 + (i < 20 ? i + 61 : i - 20);
+		v[6] = post + 729 + (i < 18 ? i + 63 : i - 18);
+		v[7] = post + 810 + (i < 36 ? i + 45 : i - 36);
+		v[8] = post + 891 + (i < 1 ? i + 80 : i - 1);
+		v[9] = post + 1215 + (i < 44 ? i + 37 : i - 44);
+		v[10] = post + 1296 + (i < 49 ? i + 32 : i - 49);
+		v[11] = post + 1377 + (i < 59 ? i + 22 : i - 59);
+		v[12] = post + 1458 + (i < 80 ? i + 1 : i - 80);
+		v[13] = post + 1539 + i;
+		minSum(v, r + i, 14, 81);
+	}
+}
+
+static void c34_1944_1(float *post, float *r) {
+	float *v[14];
+	for (int i = 0; i < 81; i++) {
+		v[0] = post + 0 + (i < 77 ? i + 4 : i - 77);
+		v[1] = post + 81 + (i < 32 ? i + 49 : i - 32);
+		v[2] = post + 162 + (i < 39 ? i + 42 : i - 39);
+		v[3] = post + 243 + (i < 33 ? i + 48 : i - 33);
+		v[4] = post + 324 + (i < 70 ? i + 11 : i - 70);
+		v[5] = post + 405 + (i < 51 ? i + 30 : i - 51);
+		v[6] = post + 729 + (i < 32 ? i + 49 : i - 32);
+		v[7] = post + 810 + (i < 64 ? i + 17 : i - 64);
+		v[8] = post + 891 + (i < 40 ? i + 41 : i - 40);
+		v[9] = post + 972 + (i < 44 ? i + 37 : i - 44);
+		v[10] = post + 1053 + (i < 66 ? i + 15 : i - 66);
+		v[11] = post + 1215 + (i < 27 ? i + 54 : i - 27);
+		v[12] = post + 1539 + i;
+		v[13] = post + 1620 + i;
+		minSum(v, r + i, 14, 81);
+	}
+}
+
+static void c34_1944_2(float *post, float *r) {
+	float *v[14];
+	for (int i = 0; i < 81; i++) {
+		v[0] = post + 0 + (i < 46 ? i + 35 : i - 46);
+		v[1] = post + 81 + (i < 5 ? i + 76 : i - 5);
+		v[2] = post + 162 + (i < 3 ? i + 78 : i - 3);
+		v[3] = post + 243 + (i < 30 ? i + 51 : i - 30);
+		v[4] = post + 324 + (i < 44 ? i + 37 : i - 44);
+		v[5] = post + 405 + (i < 46 ? i + 35 : i - 46);
+		v[6] = post + 486 + (i < 60 ? i + 21 : i - 60);
+		v[7] = post + 648 + (i < 64 ? i + 17 : i - 64);
+		v[8] = post + 729 + (i < 17 ? i + 64 : i - 17);
+		v[9] = post + 1053 + (i < 22 ? i + 59 : i - 22);
+		v[10] = post + 1134 + (i < 74 ? i + 7 : i - 74);
+		v[11] = post + 1377 + (i < 49 ? i + 32 : i - 49);
+		v[12] = post + 1620 + i;
+		v[13] = post + 1701 + i;
+		minSum(v, r + i, 14, 81);
+	}
+}
+
+static void c34_1944_3(float *post, float *r) {
+	float *v[15];
+	for (int i = 0; i < 81; i++) {
+		v[0] = post + 0 + (i < 72 ? i + 9 : i - 72);
+		v[1] = post + 81 + (i < 16 ? i + 65 : i - 16);
+		v[2] = post + 162 + (i < 37 ? i + 44 : i - 37);
+		v[3] = post + 243 + (i < 72 ? i + 9 : i - 72);
+		v[4] = post + 324 + (i < 27 ? i + 54 : i - 27);
+		v[5] = post + 405 + (i < 25 ? i + 56 : i - 25);
+		v[6] = post + 486 + (i < 8 ? i + 73 : i - 8);
+		v[7] = post + 567 + (i < 47 ? i + 34 : i - 47);
+		v[8] = post + 648 + (i < 39 ? i + 42 : i - 39);
+		v[9] = post + 972 + (i < 46 ? i + 35 : i - 46);
+		v[10] = post + 1296 + (i < 35 ? i + 46 : i - 35);
+		v[11] = post + 1377 + (i < 42 ? i + 39 : i - 42);
+		v[12] = post + 1458 + i;
+		v[13] = post + 1701 + i;
+		v[14] = post + 1782 + i;
+		minSum(v, r + i, 15, 81);
+	}
+}
+
+static void c34_1944_4(float *post, float *r) {
+	float *v[14];
+	for (int i = 0; i < 81; i++) {
+		v[0] = post + 0 + (i < 78 ? i + 3 : i - 78);
+		v[1] = post + 81 + (i < 19 ? i + 62 : i - 19);
+		v[2] = post + 162 + (i < 74 ? i + 7 : i - 74);
+		v[3] = post + 243 + (i < 1 ? i + 80 : i - 1);
+		v[4] = post + 324 + (i < 13 ? i + 68 : i - 13);
+		v[5] = post + 405 + (i < 55 ? i + 26 : i - 55);
+		v[6] = post + 567 + (i < 1 ? i + 80 : i - 1);
+		v[7] = post + 648 + (i < 26 ? i + 55 : i - 26);
+		v[8] = post + 810 + (i < 45 ? i + 36 : i - 45);
+		v[9] = post + 972 + (i < 55 ? i + 26 : i - 55);
+		v[10] = post + 1134 + (i < 72 ? i + 9 : i - 72);
+		v[11] = post + 1296 + (i < 9 ? i + 72 : i - 9);
+		v[12] = post + 1782 + i;
+		v[13] = post + 1863 + i;
+		minSum(v, r + i, 14, 81);
+	}
+}
+
+static void c34_1944_5(float *post, float *r) {
+	float *v[14];
+	for (int i = 0; i < 81; i++) {
+		v[0] = post + 0 + (i < 55 ? i + 26 : i - 55);
+		v[1] = post + 81 + (i < 6 ? i + 75 : i - 6);
+		v[2] = post + 162 + (i < 48 ? i + 33 : i - 48);
+		v[3] = post + 243 + (i < 60 ? i + 21 : i - 60);
+		v[4] = post + 324 + (i < 12 ? i + 69 : i - 12);
+		v[5] = post + 405 + (i < 22 ? i + 59 : i - 22);
+		v[6] = post + 486 + (i < 78 ? i + 3 : i - 78);
+		v[7] = post + 567 + (i < 43 ? i + 38 : i - 43);
+		v[8] = post + 891 + (i < 46 ? i + 35 : i - 46);
+		v[9] = post + 1053 + (i < 19 ? i + 62 : i - 19);
+		v[10] = post + 1134 + (i < 45 ? i + 36 : i - 45);
+		v[11] = post + 1215 + (i < 55 ? i + 26 : i - 55);
+		v[12] = post + 1458 + (i < 80 ? i + 1 : i - 80);
+		v[13] = post + 1863 + i;
+		minSum(v, r + i, 14, 81);
+	}
+}
+
+#ifdef ISA_X86
+__attribute__((target("avx2")))
+static void c34_1944_0_avx2(float *post, float *r) {
+	static const int base[14] = { 0, 81, 162, 243, 324, 405, 729, 810, 891, 1215, 1296, 1377, 1458, 1539 };
+	static const int shift[14] = { 48, 29, 28, 39, 9, 61, 63, 45, 80, 37, 32, 22, 1, 0 };
+	minSumAvx2(post, r, 81, 14, base, shift);
+}
+
+__attribute__((target("avx512f")))
+static void c34_1944_0_avx512(float *post, float *r) {
+	static const int base[14] = { 0, 81, 162, 243, 324, 405, 729, 810, 891, 1215, 1296, 1377, 1458, 1539 };
+	static const int shift[14] = { 48, 29, 28, 39, 9, 61, 63, 45, 80, 37, 32, 22, 1, 0 };
+	minSumAvx512(post, r, 81, 14, base, shift);
+}
+
+__attribute__((target("avx2")))
+static void c34_1944_1_avx2(float *post, float *r) {
+	static const int base[14] = { 0, 81, 162, 243, 324, 405, 729, 810, 891, 972, 1053, 1215, 1539, 1620 };
+	static const int shift[14] = { 4, 49, 42, 48, 11, 30, 49, 17, 41, 37, 15, 54, 0, 0 };
+	minSumAvx2(post, r, 81, 14, base, shift);
+}
+
+__attribute__((target("avx512f")))
+static void c34_1944_1_avx512(float *post, float *r) {
+	static const int base[14] = { 0, 81, 162, 243, 324, 405, 729, 810, 891, 972, 1053, 1215, 1539, 1620 };
+	static const int shift[14] = { 4, 49, 42, 48, 11, 30, 49, 17, 41, 37, 15, 54, 0, 0 };
+	minSumAvx512(post, r, 81, 14, base, shift);
+}
+
+__attribute__((target("avx2")))
+static void c34_1944_2_avx2(float *post, float *r) {
+	static const int base[14] = { 0, 81, 162, 243, 324, 405, 486, 648, 729, 1053, 1134, 1377, 1620, 1701 };
+	static const int shift[14] = { 35, 76, 78, 51, 37, 35, 21, 17, 64, 59, 7, 32, 0, 0 };
+	minSumAvx2(post, r, 81, 14, base, shift);
+}
+
+__attribute__((target("avx512f")))
+static void c34_1944_2_avx512(float *post, float *r) {
+	static const int base[14] = { 0, 81, 162, 243, 324, 405, 486, 648, 729, 1053, 1134, 1377, 1620, 1701 };
+	static const int shift[14] = { 35, 76, 78, 51, 37, 35, 21, 17, 64, 59, 7, 32, 0, 0 };
+	minSumAvx512(post, r, 81, 14, base, shift);
+}
+
+__attribute__((target("avx2")))
+static void c34_1944_3_avx2(float *post, float *r) {
+	static const int base[15] = { 0, 81, 162, 243, 324, 405, 486, 567, 648, 972, 1296, 1377, 1458, 1701, 1782 };
+	static const int shift[15] = { 9, 65, 44, 9, 54, 56, 73, 34, 42, 35, 46, 39, 0, 0, 0 };
+	minSumAvx2(post, r, 81, 15, base, shift);
+}
+
+__attribute__((target("avx512f")))
+static void c34_1944_3_avx512(float *post, float *r) {
+	static const int base[15] = { 0, 81, 162, 243, 324, 405, 486, 567, 648, 972, 1296, 1377, 1458, 1701, 1782 };
+	static const int shift[15] = { 9, 65, 44, 9, 54, 56, 73, 34, 42, 35, 46, 39, 0, 0, 0 };
+	minSumAvx512(post, r, 81, 15, base, shift);
+}
+
+__attribute__((target("avx2")))
+static void c34_1944_4_avx2(float *post, float *r) {
+	static const int base[14] = { 0, 81, 162, 243, 324, 405, 567, 648, 810, 972, 1134, 1296, 1782, 1863 };
+	static const int shift[14] = { 3, 62, 7, 80, 68, 26, 80, 55, 36, 26, 9, 72, 0, 0 };
+	minSumAvx2(post, r, 81, 14, base, shift);
+}
+
+__attribute__((target("avx512f")))
+static void c34_1944_4_avx512(float *post, float *r) {
+	static const int base[14] = { 0, 81, 162, 243, 324, 405, 567, 648, 810, 972, 1134, 1296, 1782, 1863 };
+	static const int shift[14] = { 3, 62, 7, 80, 68, 26, 80, 55, 36, 26, 9, 72, 0, 0 };
+	minSumAvx512(post, r, 81, 14, base, shift);
+}
+
+__attribute__((target("avx2")))
+static void c34_1944_5_avx2(float *post, float *r) {
+	static const int base[14] = { 0, 81, 162, 243, 324, 405, 486, 567, 891, 1053, 1134, 1215, 1458, 1863 };
+	static const int shift[14] = { 26, 75, 33, 21, 69, 59, 3, 38, 35, 62, 36, 26, 1, 0 };
+	minSumAvx2(post, r, 81, 14, base, shift);
+}
+
+__attribute__((target("avx512f")))
+static void c34_1944_5_avx512(float *post, float *r) {
+	static const int base[14] = { 0, 81, 162, 243, 324, 405, 486, 567, 891, 1053, 1134, 1215, 1458, 1863 };
+	static const int shift[14] = { 26, 75, 33, 21, 69, 59, 3, 38, 35, 62, 36, 26, 1, 0 };
+	minSumAvx512(post, r, 81, 14, base, shift);
+}
+
+#endif
+
+/* ############################################################
+### c56_648
+############################################################ */
+
+static void c56_648_0(float *post, float *r) {
+	float *v[22];
+	for (int i = 0; i < 27; i++) {
+		v[0] = post + 0 + (i < 10 ? i + 17 : i - 10);
+		v[1] = post + 27 + (i < 14 ? i + 13 : i - 14);
+		v[2] = post + 54 + (i < 19 ? i + 8 : i - 19);
+		v[3] = post + 81 + (i < 6 ? i + 21 : i - 6);
+		v[4] = post + 108 + (i < 18 ? i + 9 : i - 18);
+		v[5] = post + 135 + (i < 24 ? i + 3 : i - 24);
+		v[6] = post + 162 + (i < 9 ? i + 18 : i - 9);
+		v[7] = post + 189 + (i < 15 ? i + 12 : i - 15);
+		v[8] = post + 216 + (i < 17 ? i + 10 : i - 17);
+		v[9] = post + 243 + i;
+		v[10] = post + 270 + (i < 23 ? i + 4 : i - 23);
+		v[11] = post + 297 + (i < 12 ? i + 15 : i - 12);
+		v[12] = post + 324 + (i < 8 ? i + 19 : i - 8);
+		v[13] = post + 351 + (i < 25 ? i + 2 : i - 25);
+		v[14] = post + 378 + (i < 22 ? i + 5 : i - 22);
+		v[15] = post + 405 + (i < 17 ? i + 10 : i - 17);
+		v[16] = post + 432 + (i < 1 ? i + 26 : i - 1);
+		v[17] = post + 459 + (i < 8 ? i + 19 : i - 8);
+		v[18] = post + 486 + (i < 14 ? i + 13 : i - 14);
+		v[19] = post + 513 + (i < 14 ? i + 13 : i - 14);
+		v[20] = post + 540 + (i < 26 ? i + 1 : i - 26);
+		v[21] = post + 567 + i;
+		minSum(v, r + i, 22, 27);
+	}
+}
+
+static void c56_648_1(float *post, float *r) {
+	float *v[22];
+	for (int i = 0; i < 27; i++) {
+		v[0] = post + 0 + (i < 24 ? i + 3 : i - 24);
+		v[1] = post + 27 + (i < 15 ? i + 12 : i - 15);
+		v[2] = post + 54 + (i < 16 ? i + 11 : i - 16);
+		v[3] = post + 81 + (i < 13 ? i + 14 : i - 13);
+		v[4] = post + 108 + (i < 16 ? i + 11 : i - 16);
+		v[5] = post + 135 + (i < 2 ? i + 25 : i - 2);
+		v[6] = post + 162 + (i < 22 ? i + 5 : i - 22);
+		v[7] = post + 189 + (i < 9 ? i + 18 : i - 9);
+		v[8] = post + 216 + i;
+		v[9] = post + 243 + (i < 18 ? i + 9 : i - 18);
+		v[10] = post + 270 + (i < 25 ? i + 2 : i - 25);
+		v[11] = post + 297 + (i < 1 ? i + 26 : i - 1);
+		v[12] = post + 324 + (i < 1 ? i + 26 : i - 1);
+		v[13] = post + 351 + (i < 17 ? i + 10 : i - 17);
+		v[14] = post + 378 + (i < 3 ? i + 24 : i - 3);
+		v[15] = post + 405 + (i < 20 ? i + 7 : i - 20);
+		v[16] = post + 432 + (i < 13 ? i + 14 : i - 13);
+		v[17] = post + 459 + (i < 7 ? i + 20 : i - 7);
+		v[18] = post + 486 + (i < 23 ? i + 4 : i - 23);
+		v[19] = post + 513 + (i < 25 ? i + 2 : i - 25);
+		v[20] = post + 567 + i;
+		v[21] = post + 594 + i;
+		minSum(v, r + i, 22, 27);
+	}
+}
+
+static void c56_648_2(float *post, float *r) {
+	float *v[22];
+	for (int i = 0; i < 27; i++) {
+		v[0] = post + 0 + (i < 5 ? i + 22 : i - 5);
+		v[1] = post + 27 + (i < 11 ? i + 16 : i - 11);
+		v[2] = post + 54 + (i < 23 ? i + 4 : i - 23);
+		v[3] = post + 81 + (i < 24 ? i + 3 : i - 24);
+		v[4] = post + 108 + (i < 17 ? i + 10 : i - 17);
+		v[5] = post + 135 + (i < 6 ? i + 21 : i - 6);
+		v[6] = post + 162 + (i < 15 ? i + 12 : i - 15);
+		v[7] = post + 189 + (i < 22 ? i + 5 : i - 22);
+		v[8] = post + 216 + (i < 6 ? i + 21 : i - 6);
+		v[9] = post + 243 + (i < 13 ? i + 14 : i - 13);
+		v[10] = post + 270 + (i < 8 ? i + 19 : i - 8);
+		v[11] = post + 297 + (i < 22 ? i + 5 : i - 22);
+		v[12] = post + 351 + (i < 19 ? i + 8 : i - 19);
+		v[13] = post + 378 + (i < 22 ? i + 5 : i - 22);
+		v[14] = post + 405 + (i < 9 ? i + 18 : i - 9);
+		v[15] = post + 432 + (i < 16 ? i + 11 : i - 16);
+		v[16] = post + 459 + (i < 22 ? i + 5 : i - 22);
+		v[17] = post + 486 + (i < 22 ? i + 5 : i - 22);
+		v[18] = post + 513 + (i < 12 ? i + 15 : i - 12);
+		v[19] = post + 540 + i;
+		v[20] = post + 594 + i;
+		v[21] = post + 621 + i;
+		minSum(v, r + i, 22, 27);
+	}
+}
+
+static void c56_648_3(float *post, float *r) {
+	float *v[22];
+	for (int i = 0; i < 27; i++) {
+		v[0] = post + 0 + (i < 20 ? i + 7 : i - 20);
+		v[1] = post + 27 + (i < 20 ? i + 7 : i - 20);
+		v[2] = post + 54 + (i < 13 ? i + 14 : i - 13);
+		v[3] = post + 81 + (i < 13 ? i + 14 : i - 13);
+		v[4] = post + 108 + (i < 23 ? i + 4 : i - 23);
+		v[5] = post + 135 + (i < 11 ? i + 16 : i - 11);
+		v[6] = post + 162 + (i < 11 ? i + 16 : i - 11);
+		v[7] = post + 189 + (i < 3 ? i + 24 : i - 3);
+		v[8] = post + 216 + (i < 3 ? i + 24 : i - 3);
+		v[9] = post + 243 + (i < 17 ? i + 10 : i - 17);
+		v[10] = post + 270 + (i < 26 ? i + 1 : i - 26);
+		v[11] = post + 297 + (i < 20 ? i + 7 : i - 20);
+		v[12] = post + 324 + (i < 12 ? i + 15 : i - 12);
+		v[13] = post + 351 + (i < 21 ? i + 6 : i - 21);
+		v[14] = post + 378 + (i < 17 ? i + 10 : i - 17);
+		v[15] = post + 405 + (i < 1 ? i + 26 : i - 1);
+		v[16] = post + 432 + (i < 19 ? i + 8 : i - 19);
+		v[17] = post + 459 + (i < 9 ? i + 18 : i - 9);
+		v[18] = post + 486 + (i < 6 ? i + 21 : i - 6);
+		v[19] = post + 513 + (i < 13 ? i + 14 : i - 13);
+		v[20] = post + 540 + (i < 26 ? i + 1 : i - 26);
+		v[21] = post + 621 + i;
+		minSum(v, r + i, 22, 27);
+	}
+}
+
+#ifdef ISA_X86
+__attribute__((target("avx2")))
+static void c56_648_0_avx2(float *post, float *r) {
+	static const int base[22] = { 0, 27, 54, 81, 108, 135, 162, 189, 216, 243, 270, 297, 324, 351, 378, 405, 432, 459, 486, 513, 540, 567 };
+	static const int shift[22] = { 17, 13, 8, 21, 9, 3, 18, 12, 10, 0, 4, 15, 19, 2, 5, 10, 26, 19, 13, 13, 1, 0 };
+	minSumAvx2(post, r, 27, 22, base, shift);
+}
+
+__attribute__((target("avx512f")))
+static void c56_648_0_avx512(float *post, float *r) {
+	static const int base[22] = { 0, 27, 54, 81, 108, 135, 162, 189, 216, 243, 270, 297, 324, 351, 378, 405, 432, 459, 486, 513, 540, 567 };
+	static const int shift[22] = { 17, 13, 8, 21, 9, 3, 18, 12, 10, 0, 4, 15, 19, 2, 5, 10, 26, 19, 13, 13, 1, 0 };
+	minSumAvx512(post, r, 27, 22, base, shift);
+}
+
+__attribute__((target("avx2")))
+static void c56_648_1_avx2(float *post, float *r) {
+	static const int base[22] = { 0, 27, 54, 81, 108, 135, 162, 189, 216, 243, 270, 297, 324, 351, 378, 405, 432, 459, 486, 513, 567, 594 };
+	static const int shift[22] = { 3, 12, 11, 14, 11, 25, 5, 18, 0, 9, 2, 26, 26, 10, 24, 7, 14, 20, 4, 2, 0, 0 };
+	minSumAvx2(post, r, 27, 22, base, shift);
+}
+
+__attribute__((target("avx512f")))
+static void c56_648_1_avx512(float *post, float *r) {
+	static const int base[22] = { 0, 27, 54, 81, 108, 135, 162, 189, 216, 243, 270, 297, 324, 351, 378, 405, 432, 459, 486, 513, 567, 594 };
+	static const int shift[22] = { 3, 12, 11, 14, 11, 25, 5, 18, 0, 9, 2, 26, 26, 10, 24, 7, 14, 20, 4, 2, 0, 0 };
+	minSumAvx512(post, r, 27, 22, base, shift);
+}
+
+__attribute__((target("avx2")))
+static void c56_648_2_avx2(float *post, float *r) {
+	static const int base[22] = { 0, 27, 54, 81, 108, 135, 162, 189, 216, 243, 270, 297, 351, 378, 405, 432, 459, 486, 513, 540, 594, 621 };
+	static const int shift[22] = { 22, 16, 4, 3, 10, 21, 12, 5, 21, 14, 19, 5, 8, 5, 18, 11, 5, 5, 15, 0, 0, 0 };
+	minSumAvx2(post, r, 27, 22, base, shift);
+}
+
+__attribute__((target("avx512f")))
+static void c56_648_2_avx512(float *post, float *r) {
+	static const int base[22] = { 0, 27, 54, 81, 108, 135, 162, 189, 216, 243, 270, 297, 351, 378, 405, 432, 459, 486, 513, 540, 594, 621 };
+	static const int shift[22] = { 22, 16, 4, 3, 10, 21, 12, 5, 21, 14, 19, 5, 8, 5, 18, 11, 5, 5, 15, 0, 0, 0 };
+	minSumAvx512(post, r, 27, 22, base, shift);
+}
+
+__attribute__((target("avx2")))
+static void c56_648_3_avx2(float *post, float *r) {
+	static const int base[22] = { 0, 27, 54, 81, 108, 135, 162, 189, 216, 243, 270, 297, 324, 351, 378, 405, 432, 459, 486, 513, 540, 621 };
+	static const int shift[22] = { 7, 7, 14, 14, 4, 16, 16, 24, 24, 10, 1, 7, 15, 6, 10, 26, 8, 18, 21, 14, 1, 0 };
+	minSumAvx2(post, r, 27, 22, base, shift);
+}
+
+__attribute__((target("avx512f")))
+static void c56_648_3_avx512(float *post, float *r) {
+	static const int base[22] = { 0, 27, 54, 81, 108, 135, 162, 189, 216, 243, 270, 297, 324, 351, 378, 405, 432, 459, 486, 513, 540, 621 };
+	static const int shift[22] = { 7, 7, 14, 14, 4, 16, 16, 24, 24, 10, 1, 7, 15, 6, 10, 26, 8, 18, 21, 14, 1, 0 };
+	minSumAvx512(post, r, 27, 22, base, shift);
+}
+
+#endif
+
+/* ############################################################
+### c56_1296
+############################################################ */
+
+static void c56_1296_0(float *post, float *r) {
+	float *v[21];
+	for (int i = 0; i < 54; i++) {
+		v[0] = post + 0 + (i < 6 ? i + 48 : i - 6);
+		v[1] = post + 54 + (i < 25 ? i + 29 : i - 25);
+		v[2] = post + 108 + (i < 17 ? i + 37 : i - 17);
+		v[3] = post + 162 + (i < 2 ? i + 52 : i - 2);
+		v[4] = post + 216 + (i < 52 ? i + 2 : i - 52);
+		v[5] = post + 270 + (i < 38 ? i + 16 : i - 38);
+		v[6] = post + 324 + (i < 48 ? i + 6 : i - 48);
+		v[7] = post + 378 + (i < 40 ? i + 14 : i - 40);
+		v[8] = post + 432 + (i < 1 ? i + 53 : i - 1);
+		v[9] = post + 486 + (i < 23 ? i + 31 : i - 23);
+		v[10] = post + 540 + (i < 20 ? i + 34 : i - 20);
+		v[11] = post + 594 + (i < 49 ? i + 5 : i - 49);
+		v[12] = post + 648 + (i < 36 ? i + 18 : i - 36);
+		v[13] = post + 702 + (i < 12 ? i + 42 : i - 12);
+		v[14] = post + 756 + (i < 1 ? i + 53 : i - 1);
+		v[15] = post + 810 + (i < 23 ? i + 31 : i - 23);
+		v[16] = post + 864 + (i < 9 ? i + 45 : i - 9);
+		v[17] = post + 972 + (i < 8 ? i + 46 : i - 8);
+		v[18] = post + 1026 + (i < 2 ? i + 52 : i - 2);
+		v[19] = post + 1080 + (i < 53 ? i + 1 : i - 53);
+		v[20] = post + 1134 + i;
+		minSum(v, r + i, 21, 54);
+	}
+}
+
+static void c56_1296_1(float *post, float *r) {
+	float *v[21];
+	for (int i = 0; i < 54; i++) {
+		v[0] = post + 0 + (i < 37 ? i + 17 : i - 37);
+		v[1] = post + 54 + (i < 50 ? i + 4 : i - 50);
+		v[2] = post + 108 + (i < 24 ? i + 30 : i - 24);
+		v[3] = post + 162 + (i < 47 ? i + 7 : i - 47);
+		v[4] = post + 216 + (i < 11 ? i + 43 : i - 11);
+		v[5] = post + 270 + (i < 43 ? i + 11 : i - 43);
+		v[6] = post + 324 + (i < 30 ? i + 24 : i - 30);
+		v[7] = post + 378 + (i < 48 ? i + 6 : i - 48);
+		v[8] = post + 432 + (i < 40 ? i + 14 : i - 40);
+		v[9] = post + 486 + (i < 33 ? i + 21 : i - 33);
+		v[10] = post + 540 + (i < 48 ? i + 6 : i - 48);
+		v[11] = post + 594 + (i < 15 ? i + 39 : i - 15);
+		v[12] = post + 648 + (i < 37 ? i + 17 : i - 37);
+		v[13] = post + 702 + (i < 14 ? i + 40 : i - 14);
+		v[14] = post + 756 + (i < 7 ? i + 47 : i - 7);
+		v[15] = post + 810 + (i < 47 ? i + 7 : i - 47);
+		v[16] = post + 864 + (i < 39 ? i + 15 : i - 39);
+		v[17] = post + 918 + (i < 13 ? i + 41 : i - 13);
+		v[18] = post + 972 + (i < 35 ? i + 19 : i - 35);
+		v[19] = post + 1134 + i;
+		v[20] = post + 1188 + i;
+		minSum(v, r + i, 21, 54);
+	}
+}
+
+static void c56_1296_2(float *post, float *r) {
+	float *v[22];
+	for (int i = 0; i < 54; i++) {
+		v[0] = post + 0 + (i < 47 ? i + 7 : i - 47);
+		v[1] = post + 54 + (i < 52 ? i + 2 : i - 52);
+		v[2] = post + 108 + (i < 3 ? i + 51 : i - 3);
+		v[3] = post + 162 + (i < 23 ? i + 31 : i - 23);
+		v[4] = post + 216 + (i < 8 ? i + 46 : i - 8);
+		v[5] = post + 270 + (i < 31 ? i + 23 : i - 31);
+		v[6] = post + 324 + (i < 38 ? i + 16 : i - 38);
+		v[7] = post + 378 + (i < 43 ? i + 11 : i - 43);
+		v[8] = post + 432 + (i < 1 ? i + 53 : i - 1);
+		v[9] = post + 486 + (i < 14 ? i + 40 : i - 14);
+		v[10] = post + 540 + (i < 44 ? i + 10 : i - 44);
+		v[11] = post + 594 + (i < 47 ? i + 7 : i - 47);
+		v[12] = post + 648 + (i < 8 ? i + 46 : i - 8);
+		v[13] = post + 702 + (i < 1 ? i + 53 : i - 1);
+		v[14] = post + 756 + (i < 21 ? i + 33 : i - 21);
+		v[15] = post + 810 + (i < 19 ? i + 35 : i - 19);
+		v[16] = post + 918 + (i < 29 ? i + 25 : i - 29);
+		v[17] = post + 972 + (i < 19 ? i + 35 : i - 19);
+		v[18] = post + 1026 + (i < 16 ? i + 38 : i - 16);
+		v[19] = post + 1080 + i;
+		v[20] = post + 1188 + i;
+		v[21] = post + 1242 + i;
+		minSum(v, r + i, 22, 54);
+	}
+}
+
+static void c56_1296_3(float *post, float *r) {
+	float *v[21];
+	for (int i = 0; i < 54; i++) {
+		v[0] = post + 0 + (i < 35 ? i + 19 : i - 35);
+		v[1] = post + 54 + (i < 6 ? i + 48 : i - 6);
+		v[2] = post + 108 + (i < 13 ? i + 41 : i - 13);
+		v[3] = post + 162 + (i < 53 ? i + 1 : i - 53);
+		v[4] = post + 216 + (i < 44 ? i + 10 : i - 44);
+		v[5] = post + 270 + (i < 47 ? i + 7 : i - 47);
+		v[6] = post + 324 + (i < 18 ? i + 36 : i - 18);
+		v[7] = post + 378 + (i < 7 ? i + 47 : i - 7);
+		v[8] = post + 432 + (i < 49 ? i + 5 : i - 49);
+		v[9] = post + 486 + (i < 25 ? i + 29 : i - 25);
+		v[10] = post + 540 + (i < 2 ? i + 52 : i - 2);
+		v[11] = post + 594 + (i < 2 ? i + 52 : i - 2);
+		v[12] = post + 648 + (i < 23 ? i + 31 : i - 23);
+		v[13] = post + 702 + (i < 44 ? i + 10 : i - 44);
+		v[14] = post + 756 + (i < 28 ? i + 26 : i - 28);
+		v[15] = post + 810 + (i < 48 ? i + 6 : i - 48);
+		v[16] = post + 864 + (i < 51 ? i + 3 : i - 51);
+		v[17] = post + 918 + (i < 52 ? i + 2 : i - 52);
+		v[18] = post + 1026 + (i < 3 ? i + 51 : i - 3);
+		v[19] = post + 1080 + (i < 53 ? i + 1 : i - 53);
+		v[20] = post + 1242 + i;
+		minSum(v, r + i, 21, 54);
+	}
+}
+
+#ifdef ISA_X86
+__attribute__((target("avx2")))
+static void c56_1296_0_avx2(float *post, float *r) {
+	static const int base[21] = { 0, 54, 108, 162, 216, 270, 324, 378, 432, 486, 540, 594, 648, 702, 756, 810, 864, 972, 1026, 1080, 1134 };
+	static const int shift[21] = { 48, 29, 37, 52, 2, 16, 6, 14, 53, 31, 34, 5, 18, 42, 53, 31, 45, 46, 52, 1, 0 };
+	minSumAvx2(post, r, 54, 21, base, shift);
+}
+
+__attribute__((target("avx512f")))
+static void c56_1296_0_avx512(float *post, float *r) {
+	static const int base[21] = { 0, 54, 108, 162, 216, 270, 324, 378, 432, 486, 540, 594, 648, 702, 756, 810, 864, 972, 1026, 1080, 1134 };
+	static const int shift[21] = { 48, 29, 37, 52, 2, 16, 6, 14, 53, 31, 34, 5, 18, 42, 53, 31, 45, 46, 52, 1, 0 };
+	minSumAvx512(post, r, 54, 21, base, shift);
+}
+
+__attribute__((target("avx2")))
+static void c56_1296_1_avx2(float *post, float *r) {
+	static const int base[21] = { 0, 54, 108, 162, 216, 270, 324, 378, 432, 486, 540, 594, 648, 702, 756, 810, 864, 918, 972, 1134, 1188 };
+	static const int shift[21] = { 17, 4, 30, 7, 43, 11, 24, 6, 14, 21, 6, 39, 17, 40, 47, 7, 15, 41, 19, 0, 0 };
+	minSumAvx2(post, r, 54, 21, base, shift);
+}
+
+__attribute__((target("avx512f")))
+static void c56_1296_1_avx512(float *post, float *r) {
+	static const int base[21] = { 0, 54, 108, 162, 216, 270, 324, 378, 432, 486, 540, 594, 648, 702, 756, 810, 864, 918, 972, 1134, 1188 };
+	static const int shift[21] = { 17, 4, 30, 7, 43, 11, 24, 6, 14, 21, 6, 39, 17, 40, 47, 7, 15, 41, 19, 0, 0 };
+	minSumAvx512(post, r, 54, 21, base, shift);
+}
+
+__attribute__((target("avx2")))
+static void c56_1296_2_avx2(float *post, float *r) {
+	static const int base[22] = { 0, 54, 108, 162, 216, 270, 324, 378, 432, 486, 540, 594, 648, 702, 756, 810, 918, 972, 1026, 1080, 1188, 1242 };
+	static const int shift[22] = { 7, 2, 51, 31, 46, 23, 16, 11, 53, 40, 10, 7, 46, 53, 33, 35, 25, 35, 38, 0, 0, 0 };
+	minSumAvx2(post, r, 54, 22, base, shift);
+}
+
+__attribute__((target("avx512f")))
+static void c56_1296_2_avx512(float *post, float *r) {
+	static const int base[22] = { 0, 54, 108, 162, 216, 270, 324, 378, 432, 486, 540, 594, 648, 702, 756, 810, 918, 972, 1026, 1080, 1188, 1242 };
+	static const int shift[22] = { 7, 2, 51, 31, 46, 23, 16, 11, 53, 40, 10, 7, 46, 53, 33, 35, 25, 35, 38, 0, 0, 0 };
+	minSumAvx512(post, r, 54, 22, base, shift);
+}
+
+__attribute__((target("avx2")))
+static void c56_1296_3_avx2(float *post, float *r) {
+	static const int base[21] = { 0, 54, 108, 162, 216, 270, 324, 378, 432, 486, 540, 594, 648, 702, 756, 810, 864, 918, 1026, 1080, 1242 };
+	static const int shift[21] = { 19, 48, 41, 1, 10, 7, 36, 47, 5, 29, 52, 52, 31, 10, 26, 6, 3, 2, 51, 1, 0 };
+	minSumAvx2(post, r, 54, 21, base, shift);
+}
+
+__attribute__((target("avx512f")))
+static void c56_1296_3_avx512(float *post, float *r) {
+	static const int base[21] = { 0, 54, 108, 162, 216, 270, 324, 378, 432, 486, 540, 594, 648, 702, 756, 810, 864, 918, 1026, 1080, 1242 };
+	static const int shift[21] = { 19, 48, 41, 1, 10, 7, 36, 47, 5, 29, 52, 52, 31, 10, 26, 6, 3, 2, 51, 1, 0 };
+	minSumAvx512(post, r, 54, 21, base, shift);
+}
+
+#endif
+
+/* ############################################################
+### c56_1944
+############################################################ */
+
+static void c56_1944_0(float *post, float *r) {
+	float *v[20];
+	for (int i = 0; i < 81; i++) {
+		v[0] = post + 0 + (i < 68 ? i + 13 : i - 68);
+		v[1] = post + 81 + (i < 33 ? i + 48 : i - 33);
+		v[2] = post + 162 + (i < 1 ? i + 80 : i - 1);
+		v[3] = post + 243 + (i < 15 ? i + 66 : i - 15);
+		v[4] = post + 324 + (i < 77 ? i + 4 : i - 77);
+		v[5] = post + 405 + (i < 7 ? i + 74 : i - 7);
+		v[6] = post + 486 + (i < 74 ? i + 7 : i - 74);
+		v[7] = post + 567 + (i < 51 ? i + 30 : i - 51);
+		v[8] = post + 648 + (i < 5 ? i + 76 : i - 5);
+		v[9] = post + 729 + (i < 29 ? i + 52 : i - 29);
+		v[10] = post + 810 + (i < 44 ? i + 37 : i - 44);
+		v[11] = post + 891 + (i < 21 ? i + 60 : i - 21);
+		v[12] = post + 1053 + (i < 32 ? i + 49 : i - 32);
+		v[13] = post + 1134 + (i < 8 ? i + 73 : i - 8);
+		v[14] = post + 1215 + (i < 50 ? i + 31 : i - 50);
+		v[15] = post + 1296 + (i < 7 ? i + 74 : i - 7);
+		v[16] = post + 1377 + (i < 8 ? i + 73 : i - 8);
+		v[17] = post + 1458 + (i < 58 ? i + 23 : i - 58);
+		v[18] = post + 1620 + (i < 80 ? i + 1 : i - 80);
+		v[19] = post + 1701 + i;
+		minSum(v, r + i, 20, 81);
+	}
+}
+
+static void c56_1944_1(float *post, float *r) {
+	float *v[20];
+	for (int i = 0; i < 81; i++) {
+		v[0] = post + 0 + (i < 12 ? i + 69 : i - 12);
+		v[1] = post + 81 + (i < 18 ? i + 63 : i - 18);
+		v[2] = post + 162 + (i < 7 ? i + 74 : i - 7);
+		v[3] = post + 243 + (i < 25 ? i + 56 : i - 25);
+		v[4] = post + 324 + (i < 17 ? i + 64 : i - 17);
+		v[5] = post + 405 + (i < 4 ? i + 77 : i - 4);
+		v[6] = post + 486 + (i < 24 ? i + 57 : i - 24);
+		v[7] = post + 567 + (i < 16 ? i + 65 : i - 16);
+		v[8] = post + 648 + (i < 75 ? i + 6 : i - 75);
+		v[9] = post + 729 + (i < 65 ? i + 16 : i - 65);
+		v[10] = post + 810 + (i < 30 ? i + 51 : i - 30);
+		v[11] = post + 972 + (i < 17 ? i + 64 : i - 17);
+		v[12] = post + 1134 + (i < 13 ? i + 68 : i - 13);
+		v[13] = post + 1215 + (i < 72 ? i + 9 : i - 72);
+		v[14] = post + 1296 + (i < 33 ? i + 48 : i - 33);
+		v[15] = post + 1377 + (i < 19 ? i + 62 : i - 19);
+		v[16] = post + 1458 + (i < 27 ? i + 54 : i - 27);
+		v[17] = post + 1539 + (i < 54 ? i + 27 : i - 54);
+		v[18] = post + 1701 + i;
+		v[19] = post + 1782 + i;
+		minSum(v, r + i, 20, 81);
+	}
+}
+
+static void c56_1944_2(float *post, float *r) {
+	float *v[20];
+	for (int i = 0; i < 81; i++) {
+		v[0] = post + 0 + (i < 30 ? i + 51 : i - 30);
+		v[1] = post + 81 + (i < 66 ? i + 15 : i - 66);
+		v[2] = post + 162 + i;
+		v[3] = post + 243 + (i < 1 ? i + 80 : i - 1);
+		v[4] = post + 324 + (i < 57 ? i + 24 : i - 57);
+		v[5] = post + 405 + (i < 56 ? i + 25 : i - 56);
+		v[6] = post + 486 + (i < 39 ? i + 42 : i - 39);
+		v[7] = post + 567 + (i < 27 ? i + 54 : i - 27);
+		v[8] = post + 648 + (i < 37 ? i + 44 : i - 37);
+		v[9] = post + 729 + (i < 10 ? i + 71 : i - 10);
+		v[10] = post + 810 + (i < 10 ? i + 71 : i - 10);
+		v[11] = post + 891 + (i < 72 ? i + 9 : i - 72);
+		v[12] = post + 972 + (i < 14 ? i + 67 : i - 14);
+		v[13] = post + 1053 + (i < 46 ? i + 35 : i - 46);
+		v[14] = post + 1215 + (i < 23 ? i + 58 : i - 23);
+		v[15] = post + 1377 + (i < 52 ? i + 29 : i - 52);
+		v[16] = post + 1539 + (i < 28 ? i + 53 : i - 28);
+		v[17] = post + 1620 + i;
+		v[18] = post + 1782 + i;
+		v[19] = post + 1863 + i;
+		minSum(v, r + i, 20, 81);
+	}
+}
+
+static void c56_1944_3(float *post, float *r) {
+	float *v[19];
+	for (int i = 0; i < 81; i++) {
+		v[0] = post + 0 + (i < 65 ? i + 16 : i - 65);
+		v[1] = post + 81 + (i < 52 ? i + 29 : i - 52);
+		v[2] = post + 162 + (i < 45 ? i + 36 : i - 45);
+		v[3] = post + 243 + (i < 40 ? i + 41 : i - 40);
+		v[4] = post + 324 + (i < 37 ? i + 44 : i - 37);
+		v[5] = post + 405 + (i < 25 ? i + 56 : i - 25);
+		v[6] = post + 486 + (i < 22 ? i + 59 : i - 22);
+		v[7] = post + 567 + (i < 44 ? i + 37 : i - 44);
+		v[8] = post + 648 + (i < 31 ? i + 50 : i - 31);
+		v[9] = post + 729 + (i < 57 ? i + 24 : i - 57);
+		v[10] = post + 891 + (i < 16 ? i + 65 : i - 16);
+		v[11] = post + 972 + (i < 77 ? i + 4 : i - 77);
+		v[12] = post + 1053 + (i < 16 ? i + 65 : i - 16);
+		v[13] = post + 1134 + (i < 29 ? i + 52 : i - 29);
+		v[14] = post + 1296 + (i < 77 ? i + 4 : i - 77);
+		v[15] = post + 1458 + (i < 8 ? i + 73 : i - 8);
+		v[16] = post + 1539 + (i < 29 ? i + 52 : i - 29);
+		v[17] = post + 1620 + (i < 80 ? i + 1 : i - 80);
+		v[18] = post + 1863 + i;
+		minSum(v, r + i, 19, 81);
+	}
+}
+
+#ifdef ISA_X86
+__attribute__((target("avx2")))
+static void c56_1944_0_avx2(float *post, float *r) {
+	static const int base[20] = { 0, 81, 162, 243, 324, 405, 486, 567, 648, 729, 810, 891, 1053, 1134, 1215, 1296, 1377, 1458, 1620, 1701 };
+	static const int shift[20] = { 13, 48, 80, 66, 4, 74, 7, 30, 76, 52, 37, 60, 49, 73, 31, 74, 73, 23, 1, 0 };
+	minSumAvx2(post, r, 81, 20, base, shift);
+}
+
+__attribute__((target("avx512f")))
+static void c56_1944_0_avx512(float *post, float *r) {
+	static const int base[20] = { 0, 81, 162, 243, 324, 405, 486, 567, 648, 729, 810, 891, 1053, 1134, 1215, 1296, 1377, 1458, 1620, 1701 };
+	static const int shift[20] = { 13, 48, 80, 66, 4, 74, 7, 30, 76, 52, 37, 60, 49, 73, 31, 74, 73, 23, 1, 0 };
+	minSumAvx512(post, r, 81, 20, base, shift);
+}
+
+__attribute__((target("avx2")))
+static void c56_1944_1_avx2(float *post, float *r) {
+	static const int base[20] = { 0, 81, 162, 243, 324, 405, 486, 567, 648, 729, 810, 972, 1134, 1215, 1296, 1377, 1458, 1539, 1701, 1782 };
+	static const int shift[20] = { 69, 63, 74, 56, 64, 77, 57, 65, 6, 16, 51, 64, 68, 9, 48, 62, 54, 27, 0, 0 };
+	minSumAvx2(post, r, 81, 20, base, shift);
+}
+
+__attribute__((target("avx512f")))
+static void c56_1944_1_avx512(float *post, float *r) {
+	static const int base[20] = { 0, 81, 162, 243, 324, 405, 486, 567, 648, 729, 810, 972, 1134, 1215, 1296, 1377, 1458, 1539, 1701, 1782 };
+	static const int shift[20] = { 69, 63, 74, 56, 64, 77, 57, 65, 6, 16, 51, 64, 68, 9, 48, 62, 54, 27, 0, 0 };
+	minSumAvx512(post, r, 81, 20, base, shift);
+}
+
+__attribute__((target("avx2")))
+static void c56_1944_2_avx2(float *post, float *r) {
+	static const int base[20] = { 0, 81, 162, 243, 324, 405, 486, 567, 648, 729, 810, 891, 972, 1053, 1215, 1377, 1539, 1620, 1782, 1863 };
+	static const int shift[20] = { 51, 15, 0, 80, 24, 25, 42, 54, 44, 71, 71, 9, 67, 35, 58, 29, 53, 0, 0, 0 };
+	minSumAvx2(post, r, 81, 20, base, shift);
+}
+
+__attribute__((target("avx512f")))
+static void c56_1944_2_avx512(float *post, float *r) {
+	static const int base[20] = { 0, 81, 162, 243, 324, 405, 486, 567, 648, 729, 810, 891, 972, 1053, 1215, 1377, 1539, 1620, 1782, 1863 };
+	static const int shift[20] = { 51, 15, 0, 80, 24, 25, 42, 54, 44, 71, 71, 9, 67, 35, 58, 29, 53, 0, 0, 0 };
+	minSumAvx512(post, r, 81, 20, base, shift);
+}
+
+__attribute__((target("avx2")))
+static void c56_1944_3_avx2(float *post, float *r) {
+	static const int base[19] = { 0, 81, 162, 243, 324, 405, 486, 567, 648, 729, 891, 972, 1053, 1134, 1296, 1458, 1539, 1620, 1863 };
+	static const int shift[19] = { 16, 29, 36, 41, 44, 56, 59, 37, 50, 24, 65, 4, 65, 52, 4, 73, 52, 1, 0 };
+	minSumAvx2(post, r, 81, 19, base, shift);
+}
+
+__attribute__((target("avx512f")))
+static void c56_1944_3_avx512(float *post, float *r) {
+	static const int base[19] = { 0, 81, 162, 243, 324, 405, 486, 567, 648, 729, 891, 972, 1053, 1134, 1296, 1458, 1539, 1620, 1863 };
+	static const int shift[19] = { 16, 29, 36, 41, 44, 56, 59, 37, 50, 24, 65, 4, 65, 52, 4, 73, 52, 1, 0 };
+	minSumAvx512(post, r, 81, 19, base, shift);
+}
+
+#endif
+
+static LdpcKernel kernels[] = {
+	{
+		&c12_648,
+		2376, // nrEdges
+		{ 0, 189, 405, 594, 783, 972, 1188, 1377, 1566, 1782, 1971, 2187 },
+		{
+			c12_648_0, c12_648_1, c12_648_2, c12_648_3,
+			c12_648_4, c12_648_5, c12_648_6, c12_648_7,
+			c12_648_8, c12_648_9, c12_648_10, c12_648_11
+		},
+#ifdef ISA_X86
+		{
+			c12_648_0_avx2, c12_648_1_avx2, c12_648_2_avx2, c12_648_3_avx2,
+			c12_648_4_avx2, c12_648_5_avx2, c12_648_6_avx2, c12_648_7_avx2,
+			c12_648_8_avx2, c12_648_9_avx2, c12_648_10_avx2, c12_648_11_avx2
+		},
+		{
+			c12_648_0_avx512, c12_648_1_avx512, c12_648_2_avx512, c12_648_3_avx512,
+			c12_648_4_avx512, c12_648_5_avx512, c12_648_6_avx512, c12_648_7_avx512,
+			c12_648_8_avx512, c12_648_9_avx512, c12_648_10_avx512, c12_648_11_avx512
+		}
+#endif
+	},
+	{
+		&c12_1296,
+		4644, // nrEdges
+		{ 0, 378, 810, 1188, 1566, 1944, 2322, 2700, 3132, 3510, 3888, 4266 },
+		{
+			c12_1296_0, c12_1296_1, c12_1296_2, c12_1296_3,
+			c12_1296_4, c12_1296_5, c12_1296_6, c12_1296_7,
+			c12_1296_8, c12_1296_9, c12_1296_10, c12_1296_11
+		},
+#ifdef ISA_X86
+		{
+			c12_1296_0_avx2, c12_1296_1_avx2, c12_1296_2_avx2, c12_1296_3_avx2,
+			c12_1296_4_avx2, c12_1296_5_avx2, c12_1296_6_avx2, c12_1296_7_avx2,
+			c12_1296_8_avx2, c12_1296_9_avx2, c12_1296_10_avx2, c12_1296_11_avx2
+		},
+		{
+			c12_1296_0_avx512, c12_1296_1_avx512, c12_1296_2_avx512, c12_1296_3_avx512,
+			c12_1296_4_avx512, c12_1296_5_avx512, c12_1296_6_avx512, c12_1296_7_avx512,
+			c12_1296_8_avx512, c12_1296_9_avx512, c12_1296_10_avx512, c12_1296_11_avx512
+		}
+#endif
+	},
+	{
+		&c12_1944,
+		6966, // nrEdges
+		{ 0, 567, 1134, 1701, 2268, 2835, 3402, 4050, 4617, 5184, 5751, 6318 },
+		{
+			c12_1944_0, c12_1944_1, c12_1944_2, c12_1944_3,
+			c12_1944_4, c12_1944_5, c12_1944_6, c12_1944_7,
+			c12_1944_8, c12_1944_9, c12_1944_10, c12_1944_11
+		},
+#ifdef ISA_X86
+		{
+			c12_1944_0_avx2, c12_1944_1_avx2, c12_1944_2_avx2, c12_1944_3_avx2,
+			c12_1944_4_avx2, c12_1944_5_avx2, c12_1944_6_avx2, c12_1944_7_avx2,
+			c12_1944_8_avx2, c12_1944_9_avx2, c12_1944_10_avx2, c12_1944_11_avx2
+		},
+		{
+			c12_1944_0_avx512, c12_1944_1_avx512, c12_1944_2_avx512, c12_1944_3_avx512,
+			c12_1944_4_avx512, c12_1944_5_avx512, c12_1944_6_avx512, c12_1944_7_avx512,
+			c12_1944_8_avx512, c12_1944_9_avx512, c12_1944_10_avx512, c12_1944_11_avx512
+		}
+#endif
+	},
+	{
+		&c23_648,
+		2376, // nrEdges
+		{ 0, 297, 594, 891, 1188, 1485, 1782, 2079 },
+		{
+			c23_648_0, c23_648_1, c23_648_2, c23_648_3,
+			c23_648_4, c23_648_5, c23_648_6, c23_648_7
+		},
+#ifdef ISA_X86
+		{
+			c23_648_0_avx2, c23_648_1_avx2, c23_648_2_avx2, c23_648_3_avx2,
+			c23_648_4_avx2, c23_648_5_avx2, c23_648_6_avx2, c23_648_7_avx2
+		},
+		{
+			c23_648_0_avx512, c23_648_1_avx512, c23_648_2_avx512, c23_648_3_avx512,
+			c23_648_4_avx512, c23_648_5_avx512, c23_648_6_avx512, c23_648_7_avx512
+		}
+#endif
+	},
+	{
+		&c23_1296,
+		4752, // nrEdges
+		{ 0, 594, 1188, 1782, 2376, 2970, 3564, 4158 },
+		{
+			c23_1296_0, c23_1296_1, c23_1296_2, c23_1296_3,
+			c23_1296_4, c23_1296_5, c23_1296_6, c23_1296_7
+		},
+#ifdef ISA_X86
+		{
+			c23_1296_0_avx2, c23_1296_1_avx2, c23_1296_2_avx2, c23_1296_3_avx2,
+			c23_1296_4_avx2, c23_1296_5_avx2, c23_1296_6_avx2, c23_1296_7_avx2
+		},
+		{
+			c23_1296_0_avx512, c23_1296_1_avx512, c23_1296_2_avx512, c23_1296_3_avx512,
+			c23_1296_4_avx512, c23_1296_5_avx512, c23_1296_6_avx512, c23_1296_7_avx512
+		}
+#endif
+	},
+	{
+		&c23_1944,
+		7128, // nrEdges
+		{ 0, 891, 1782, 2673, 3564, 4455, 5346, 6237 },
+		{
+			c23_1944_0, c23_1944_1, c23_1944_2, c23_1944_3,
+			c23_1944_4, c23_1944_5, c23_1944_6, c23_1944_7
+		},
+#ifdef ISA_X86
+		{
+			c23_1944_0_avx2, c23_1944_1_avx2, c23_1944_2_avx2, c23_1944_3_avx2,
+			c23_1944_4_avx2, c23_1944_5_avx2, c23_1944_6_avx2, c23_1944_7_avx2
+		},
+		{
+			c23_1944_0_avx512, c23_1944_1_avx512, c23_1944_2_avx512, c23_1944_3_avx512,
+			c23_1944_4_avx512, c23_1944_5_avx512, c23_1944_6_avx512, c23_1944_7_avx512
+		}
+#endif
+	},
+	{
+		&c34_648,
+		2376, // nrEdges
+		{ 0, 405, 810, 1215, 1593, 1971 },
+		{
+			c34_648_0, c34_648_1, c34_648_2, c34_648_3,
+			c34_648_4, c34_648_5
+		},
+#ifdef ISA_X86
+		{
+			c34_648_0_avx2, c34_648_1_avx2, c34_648_2_avx2, c34_648_3_avx2,
+			c34_648_4_avx2, c34_648_5_avx2
+		},
+		{
+			c34_648_0_avx512, c34_648_1_avx512, c34_648_2_avx512, c34_648_3_avx512,
+			c34_648_4_avx512, c34_648_5_avx512
+		}
+#endif
+	},
+	{
+		&c34_1296,
+		4752, // nrEdges
+		{ 0, 810, 1566, 2376, 3186, 3996 },
+		{
+			c34_1296_0, c34_1296_1, c34_1296_2, c34_1296_3,
+			c34_1296_4, c34_1296_5
+		},
+#ifdef ISA_X86
+		{
+			c34_1296_0_avx2, c34_1296_1_avx2, c34_1296_2_avx2, c34_1296_3_avx2,
+			c34_1296_4_avx2, c34_1296_5_avx2
+		},
+		{
+			c34_1296_0_avx512, c34_1296_1_avx512, c34_1296_2_avx512, c34_1296_3_avx512,
+			c34_1296_4_avx512, c34_1296_5_avx512
+		}
+#endif
+	},
+	{
+		&c34_1944,
+		6885, // nrEdges
+		{ 0, 1134, 2268, 3402, 4617, 5751 },
+		{
+			c34_1944_0, c34_1944_1, c34_1944_2, c34_1944_3,
+			c34_1944_4, c34_1944_5
+		},
+#ifdef ISA_X86
+		{
+			c34_1944_0_avx2, c34_1944_1_avx2, c34_1944_2_avx2, c34_1944_3_avx2,
+			c34_1944_4_avx2, c34_1944_5_avx2
+		},
+		{
+			c34_1944_0_avx512, c34_1944_1_avx512, c34_1944_2_avx512, c34_1944_3_avx512,
+			c34_1944_4_avx512, c34_1944_5_avx512
+		}
+#endif
+	},
+	{
+		&c56_648,
+		2376, // nrEdges
+		{ 0, 594, 1188, 1782 },
+		{
+			c56_648_0, c56_648_1, c56_648_2, c56_648_3
+		},
+#ifdef ISA_X86
+		{
+			c56_648_0_avx2, c56_648_1_avx2, c56_648_2_avx2, c56_648_3_avx2
+		},
+		{
+			c56_648_0_avx512, c56_648_1_avx512, c56_648_2_avx512, c56_648_3_avx512
+		}
+#endif
+	},
+	{
+		&c56_1296,
+		4590, // nrEdges
+		{ 0, 1134, 2268, 3456 },
+		{
+			c56_1296_0, c56_1296_1, c56_1296_2, c56_1296_3
+		},
+#ifdef ISA_X86
+		{
+			c56_1296_0_avx2, c56_1296_1_avx2, c56_1296_2_avx2, c56_1296_3_avx2
+		},
+		{
+			c56_1296_0_avx512, c56_1296_1_avx512, c56_1296_2_avx512, c56_1296_3_avx512
+		}
+#endif
+	},
+	{
+		&c56_1944,
+		6399, // nrEdges
+		{ 0, 1620, 3240, 4860 },
+		{
+			c56_1944_0, c56_1944_1, c56_1944_2, c56_1944_3
+		},
+#ifdef ISA_X86
+		{
+			c56_1944_0_avx2, c56_1944_1_avx2, c56_1944_2_avx2, c56_1944_3_avx2
+		},
+		{
+			c56_1944_0_avx512, c56_1944_1_avx512, c56_1944_2_avx512, c56_1944_3_avx512
+		}
+#endif
+	}
+};
+
+/**
+ * Find the generated kernels of a code
+ */
+LdpcKernel *ldpcKernelFind(Code *code) {
+	for (int c = 0; c < 12; c++) {
+		if (kernels[c].code == code) {
+			return &kernels[c];
+		}
+	}
+	return (LdpcKernel *)0;
+}
+
+/**
+ * Pick the widest form of the kernels that isaLevel() allows
+ */
+LayerKernel *ldpcKernelLayers(LdpcKernel *kernel) {
+#ifdef ISA_X86
+	IsaLevel level = isaLevel();
+	if (level >= ISA_AVX512) {
+		return kernel->avx512;
+	} else if (level >= ISA_AVX2) {
+		return kernel->avx2;
+	}
+#endif
+	return kernel->layers;
+}
@@ -0,0 +1,314 @@
+#include <stdlib.h>
+#include <string.h>
+
+#include "802-ppdu.h"
+#include "util.h"
+#include "workers.h"
+
+/**
+ * Codes in the same order as PpduEncoder.encoders
+ */
+static Code *ppduCodes[12] = {
+	&c12_648, &c12_1296, &c12_1944,
+	&c23_648, &c23_1296, &c23_1944,
+	&c34_648, &c34_1296, &c34_1944,
+	&c56_648, &c56_1296, &c56_1944
+};
+
+/**
+ * Codeword count under which we do not bother with threads
+ */
+#define PPDU_MIN_THREADED_CW 16
+
+/**
+ * Find the index of a code in ppduCodes
+ * @return {int} the index if found, else -1
+ */
+static int codeIndex(int rateNum, int rateDen, int lLdpc) {
+	int rate;
+	if (rateNum == 1 && rateDen == 2) {
+		rate = 0;
+	} else if (rateNum == 2 && rateDen == 3) {
+		rate = 1;
+	} else if (rateNum == 3 && rateDen == 4) {
+		rate = 2;
+	} else if (rateNum == 5 && rateDen == 6) {
+		rate = 3;
+	} else {
+		return -1;
+	}
+	int len = lLdpc / 648 - 1;
+	if (len < 0 || len > 2 || lLdpc % 648) {
+		return -1;
+	}
+	return rate * 3 + len;
+}
+
+/**
+ * Compute the LDPC encoding parameters for a PSDU, per 20.3.11.7.5.
+ * All of the (1 - R) comparisons are done in integers, scaled by rateDen.
+ */
+int ppduParamsInit(PpduParams *p, int length, int nCbps, int rateNum, int rateDen, int mStbc) {
+	if (length < 0 || nCbps <= 0 || mStbc < 1 || mStbc > 2 ||
+			codeIndex(rateNum, rateDen, 648) < 0) {
+		return 0;
+	}
+	p->length = length;
+	p->nCbps = nCbps;
+	p->rateNum = rateNum;
+	p->rateDen = rateDen;
+	p->mStbc = mStbc;
+
+	int num = rateNum;
+	int den = rateDen;
+	int nPld = length * 8 + 16;
+	int symBits = nCbps * mStbc;
+	int nAvbits = symBits * ((nPld * den + symBits * num - 1) / (symBits * num));
+
+	// step b: number of codewords and codeword length
+	int nCw;
+	int lLdpc;
+	if (nAvbits <= 648) {
+		nCw = 1;
+		lLdpc = nAvbits * den >= nPld * den + 912 * (den - num) ? 1296 : 648;
+	} else if (nAvbits <= 1296) {
+		nCw = 1;
+		lLdpc = nAvbits * den >= nPld * den + 1464 * (den - num) ? 1944 : 1296;
+	} else if (nAvbits <= 1944) {
+		nCw = 1;
+		lLdpc = 1944;
+	} else if (nAvbits <= 2592) {
+		nCw = 2;
+		lLdpc = nAvbits * den >= nPld * den + 2916 * (den - num) ? 1944 : 1296;
+	} else {
+		nCw = (nPld * den + 1944 * num - 1) / (1944 * num);
+		lLdpc = 1944;
+	}
+	int k0 = lLdpc * num / den;
+	int parity = lLdpc - k0;
+
+	// step c: shortening
+	int nShrt = nCw * k0 - nPld;
+	if (nShrt < 0) {
+		nShrt = 0;
+	}
+
+	// step d: puncturing, adding a symbol if we would puncture too much
+	int nPunc = nCw * lLdpc - nAvbits - nShrt;
+	if (nPunc < 0) {
+		nPunc = 0;
+	}
+	if ((10 * nPunc > nCw * parity && 10 * nShrt * (den - num) < 12 * nPunc * num) ||
+			10 * nPunc > 3 * nCw * parity) {
+		nAvbits += symBits;
+		nPunc = nCw * lLdpc - nAvbits - nShrt;
+		if (nPunc < 0) {
+			nPunc = 0;
+		}
+	}
+
+	// step e: repetition
+	int nRep = nAvbits - nCw * parity - nPld;
+	if (nRep < 0) {
+		nRep = 0;
+	}
+
+	p->nPld = nPld;
+	p->nAvbits = nAvbits;
+	p->nCw = nCw;
+	p->lLdpc = lLdpc;
+	p->nShrt = nShrt;
+	p->nPunc = nPunc;
+	p->nRep = nRep;
+	p->nSym = nAvbits / nCbps;
+	p->code = ppduCodes[codeIndex(rateNum, rateDen, lLdpc)];
+	return 1;
+}
+
+
+/**
+ * Create a new PPDU encoder
+ */
+PpduEncoder *ppduEncoderCreate(int nrThreads) {
+	PpduEncoder *penc = (PpduEncoder *) malloc(sizeof(PpduEncoder));
+	if (!penc) {
+		return (PpduEncoder *)0;
+	}
+	for (int i = 0; i < 12; i++) {
+		penc->encoders[i] = (LdpcEncoder *)0;
+	}
+	penc->nrThreads = nrThreads > 0 ? nrThreads : workersCount();
+	penc->scrambler = scramblerCreate(127);
+	penc->data = (uint8_t *)0;
+	penc->dataLen = 0;
+	if (!penc->scrambler) {
+		free(penc);
+		return (PpduEncoder *)0;
+	}
+	return penc;
+}
+
+/**
+ * Clean up a PPDU encoder
+ */
+void ppduEncoderDestroy(PpduEncoder *penc) {
+	if (!penc) {
+		return;
+	}
+	for (int i = 0; i < 12; i++) {
+		ldpcEncoderDestroy(penc->encoders[i]);
+	}
+	scramblerDestroy(penc->scrambler);
+	free(penc->data);
+	free(penc);
+}
+
+
+/**
+ * Spread count evenly over nCw codewords, with one more for the first
+ * (count % nCw) of them.
+ * @return {int} the sum over codewords 0 to i-1
+ */
+static int spreadBefore(int count, int nCw, int i) {
+	int extra = count % nCw;
+	return i * (count / nCw) + (i < extra ? i : extra);
+}
+
+/**
+ * @return {int} the share of count for codeword i
+ */
+static int spreadAt(int count, int nCw, int i) {
+	return count / nCw + (i < count % nCw ? 1 : 0);
+}
+
+/**
+ * Shared state for the threads of one ppduEncode() call
+ */
+typedef struct {
+	LdpcEncoder **encoders;
+	PpduParams *p;
+	uint8_t *bytes;
+	uint8_t *out;
+} PpduBatch;
+
+static void ppduEncodeSlice(void *ctx, int worker, int start, int end) {
+	PpduBatch *batch = (PpduBatch *) ctx;
+	LdpcEncoder *enc = batch->encoders[worker];
+	PpduParams *p = batch->p;
+	int nCw = p->nCw;
+	int k0 = p->code->messageBits;
+	int N = p->code->N;
+	for (int i = start; i < end; i++) {
+		int dataBits = k0 - spreadAt(p->nShrt, nCw, i);
+		int dataOffset = i * k0 - spreadBefore(p->nShrt, nCw, i);
+		int parityBits = N - k0 - spreadAt(p->nPunc, nCw, i);
+		int repBits = spreadAt(p->nRep, nCw, i);
+		int outOffset = i * N - spreadBefore(p->nShrt, nCw, i)
+			- spreadBefore(p->nPunc, nCw, i) + spreadBefore(p->nRep, nCw, i);
+		uint8_t *out = batch->out + outOffset;
+
+		// the systematic bits go straight to the output, then to the encoder
+		extractBitsBE(out, batch->bytes, dataOffset, dataBits);
+		uint8_t *x = ldpcEncode(enc, out, dataBits);
+
+		// the parity bits, less the punctured ones at the end
+		uint8_t *dest = out + dataBits;
+		uint8_t *src = x + k0;
+		for (int j = 0; j < parityBits; j++) {
+			*dest++ = *src++;
+		}
+
+		// repeat from the start of the sent codeword, wrapping if needed
+		int sent = dataBits + parityBits;
+		for (int j = 0; j < repBits; j++) {
+			*dest++ = out[j % sent];
+		}
+	}
+}
+
+/**
+ * Encode the data bits of a PPDU into p->nAvbits coded bits
+ * @param {PpduEncoder *} penc the PPDU encoder
+ * @param {PpduParams *} p parameters from ppduParamsInit()
+ * @param {uint8_t *} bytes the p->nPld scrambled data bits, packed big-endian
+ * @param {uint8_t *} out output for p->nAvbits bits, one per byte
+ * @return {int} 1 if successful, else 0
+ */
+int ppduEncode(PpduEncoder *penc, PpduParams *p, uint8_t *bytes, uint8_t *out) {
+	int idx = codeIndex(p->rateNum, p->rateDen, p->lLdpc);
+	if (idx < 0) {
+		return 0;
+	}
+	LdpcEncoder *enc = penc->encoders[idx];
+	if (!enc) {
+		enc = ldpcEncoderCreate(p->code);
+		if (!enc) {
+			return 0;
+		}
+		penc->encoders[idx] = enc;
+	}
+
+	int nrThreads = p->nCw < PPDU_MIN_THREADED_CW ? 1 : penc->nrThreads;
+	if (nrThreads > p->nCw) {
+		nrThreads = p->nCw;
+	}
+	LdpcEncoder *encoders[nrThreads];
+	encoders[0] = enc;
+	for (int i = 1; i < nrThreads; i++) {
+		encoders[i] = ldpcEncoderClone(enc);
+		if (!encoders[i]) {
+			nrThreads = i;
+			break;
+		}
+	}
+	PpduBatch batch;
+	batch.encoders = encoders;
+	batch.p = p;
+	batch.bytes = bytes;
+	batch.out = out;
+	workersRun(ppduEncodeSlice, &batch, p->nCw, nrThreads);
+	for (int i = 1; i < nrThreads; i++) {
+		ldpcEncoderDestroy(encoders[i]);
+	}
+	return 1;
+}
+
+/**
+ * Prepend the SERVICE field to a PSDU, scramble it, and encode it
+ * @param {PpduEncoder *} penc the PPDU encoder
+ * @param {PpduParams *} p parameters from ppduParamsInit()
+ * @param {uint8_t *} psdu the p->length bytes of the PSDU
+ * @param {int} seed the initial scrambler state, 1 to 127
+ * @param {uint8_t *} out output for p->nAvbits bits, one per byte
+ * @return {int} 1 if successful, else 0
+ */
+int ppduEncodePsdu(PpduEncoder *penc, PpduParams *p, uint8_t *psdu, int seed, uint8_t *out) {
+	if (seed < 1 || seed > 127) {
+		return 0;
+	}
+	int len = p->length + 2;
+	if (len > penc->dataLen) {
+		uint8_t *data = (uint8_t *) realloc(penc->data, len);
+		if (!data) {
+			return 0;
+		}
+		penc->data = data;
+		penc->dataLen = len;
+	}
+	Scrambler *scrambler = penc->scrambler;
+	if (scrambler->seed != seed) {
+		scrambler = scramblerCreate(seed);
+		if (!scrambler) {
+			return 0;
+		}
+		scramblerDestroy(penc->scrambler);
+		penc->scrambler = scrambler;
+	}
+	scramblerReset(scrambler);
+	// the SERVICE field is all zeros when it is scrambled
+	penc->data[0] = 0;
+	penc->data[1] = 0;
+	memcpy(penc->data + 2, psdu, p->length);
+	scramblerScramble(scrambler, penc->data, penc->data, len);
+	return ppduEncode(penc, p, penc->data, out);
+}
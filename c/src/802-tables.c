@@ -26,11 +26,13 @@ static void tableInit(Table *table, Code *code) {
 	table->Dlen = z;
 	table->D = qcToSparse(Hb, nb, kb, mb - 1, 1, 1, z);
 	table->Elen = z;
-	table->E = qcToSparse(Hb, nb, kb + 1, mb - 1, nb - kb, 1, z);
+	table->E = qcToSparse(Hb, nb, kb + 1, mb - 1, nb - kb - 1, 1, z);
 	table->Tlen = M - z;
-	table->T = qcToSparse(Hb, nb, kb + 1, 0, nb - kb, mb - 1, z);
+	table->T = qcToSparse(Hb, nb, kb + 1, 0, nb - kb - 1, mb - 1, z);
 	table->Hlen = M;
 	table->H = qcToSparse(Hb, nb, 0, 0, nb, mb, z);
+	table->Slen = nb * z;
+	table->S = qcToSparseColumns(Hb, nb, 0, 0, nb, mb, z);
 }
 
 /**
@@ -65,6 +67,7 @@ void tableDestroy(Table *table) {
 	freeSparseMatrix(table->E, table->Elen);
 	freeSparseMatrix(table->T, table->Tlen);
 	freeSparseMatrix(table->H, table->Hlen);
+	freeSparseMatrix(table->S, table->Slen);
 	free(table);
 }
 
@@ -110,4 +113,37 @@ int **qcToSparse(int *qc, int qcWidth, int xoff, int yoff, int width, int height
 		}
 	}
 	return mat;
-}
\ No newline at end of file
+}
+
+
+/**
+ * Same as qcToSparse(), but transposed.  Each output row lists the row
+ * indices of the 1's of one column of the subblock.
+ * @param {int *} qc the source quasi-cyclic matrices in a single array
+ * @param {int} qcWidth the width of a qc row of the qc table
+ * @param {int} xoff the x-offset of the subblock in the qc table
+ * @param {int} yoff the y-offset of the subblock in the qc table
+ * @param {int} width the width of the subblock in the qc table
+ * @param {int} height the height of the subblock in the qc table
+ * @param {int} z the size of a qc cell (for example, 27x27) in an expanded table
+ */
+int **qcToSparseColumns(int *qc, int qcWidth, int xoff, int yoff, int width, int height, int z) {
+	int **mat = (int **) malloc(sizeof (int *) * width * z);
+	int outCol = 0;
+	for (int col = 0; col < width; col++) {
+		for (int colOfCell = 0; colOfCell < z; colOfCell++) {
+			int *cdata = (int *) malloc(sizeof (int) * (height + 1));
+			int entryCount = 0;
+			for (int row = 0; row < height; row++) {
+				int rot = qc[(row + yoff) * qcWidth + (col + xoff)];
+				if (rot >= 0) {
+					// the row of the cell whose 1 lands on this column
+					cdata[++entryCount] = row * z + (colOfCell - rot % z + z) % z;
+				}
+			}
+			cdata[0] = entryCount;
+			mat[outCol++] = cdata;
+		}
+	}
+	return mat;
+}
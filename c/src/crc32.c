@@ -1,4 +1,15 @@
 #include <stdint.h>
+#include <pthread.h>
+
+#include "crc32.h"
+#include "isa.h"
+
+#ifdef ISA_X86
+#include <immintrin.h>
+#endif
+
+// the shortest run worth setting up the folds for
+#define CLMUL_MIN_LEN 64
 
 const uint32_t crcTable[] = {
 	0x00000000, 0x77073096, 0xee0e612c, 0x990951ba, 0x076dc419, 0x706af48f,
@@ -47,15 +58,175 @@ const uint32_t crcTable[] = {
 };
 
 /**
- * Calculate the crc32 checksum for an array of bytes
+ * Slicing tables.  slices[k][b] is the CRC of byte b followed by k zero
+ * bytes, so that k + 1 bytes can be looked up at once.  slices[0] is
+ * crcTable.
+ */
+static uint32_t slices[16][256];
+static pthread_once_t slicesOnce = PTHREAD_ONCE_INIT;
+
+static void makeSlices(void) {
+	for (int b = 0; b < 256; b++) {
+		slices[0][b] = crcTable[b];
+	}
+	for (int k = 1; k < 16; k++) {
+		for (int b = 0; b < 256; b++) {
+			uint32_t prev = slices[k - 1][b];
+			slices[k][b] = crcTable[prev & 0xff] ^ (prev >> 8);
+		}
+	}
+}
+
+static inline uint32_t load32(uint8_t *p) {
+	return (uint32_t)p[0] | (uint32_t)p[1] << 8 | (uint32_t)p[2] << 16 | (uint32_t)p[3] << 24;
+}
+
+static inline uint32_t updateTable(uint32_t crc, uint8_t *p, int len) {
+	while (len--) {
+		crc = crcTable[((uint8_t)crc ^ *(p++))] ^ (crc >> 8);
+	}
+	return crc;
+}
+
+static uint32_t updateSlice8(uint32_t crc, uint8_t *p, int len) {
+	pthread_once(&slicesOnce, makeSlices);
+	for (; len >= 8; len -= 8, p += 8) {
+		uint32_t one = load32(p) ^ crc;
+		uint32_t two = load32(p + 4);
+		crc = slices[7][one & 0xff] ^ slices[6][(one >> 8) & 0xff] ^
+			slices[5][(one >> 16) & 0xff] ^ slices[4][one >> 24] ^
+			slices[3][two & 0xff] ^ slices[2][(two >> 8) & 0xff] ^
+			slices[1][(two >> 16) & 0xff] ^ slices[0][two >> 24];
+	}
+	return updateTable(crc, p, len);
+}
+
+static uint32_t updateSlice16(uint32_t crc, uint8_t *p, int len) {
+	pthread_once(&slicesOnce, makeSlices);
+	for (; len >= 16; len -= 16, p += 16) {
+		uint32_t one = load32(p) ^ crc;
+		uint32_t two = load32(p + 4);
+		uint32_t three = load32(p + 8);
+		uint32_t four = load32(p + 12);
+		crc = slices[15][one & 0xff] ^ slices[14][(one >> 8) & 0xff] ^
+			slices[13][(one >> 16) & 0xff] ^ slices[12][one >> 24] ^
+			slices[11][two & 0xff] ^ slices[10][(two >> 8) & 0xff] ^
+			slices[9][(two >> 16) & 0xff] ^ slices[8][two >> 24] ^
+			slices[7][three & 0xff] ^ slices[6][(three >> 8) & 0xff] ^
+			slices[5][(three >> 16) & 0xff] ^ slices[4][three >> 24] ^
+			slices[3][four & 0xff] ^ slices[2][(four >> 8) & 0xff] ^
+			slices[1][(four >> 16) & 0xff] ^ slices[0][four >> 24];
+	}
+	return updateSlice8(crc, p, len);
+}
+
+#ifdef ISA_X86
+/**
+ * Fold 128 bits of the running remainder forward over 128 bits of data,
+ * by k = (x^(a+32) mod P, x^(b+32) mod P), bit reflected
+ */
+__attribute__((target("sse4.2,pclmul")))
+static inline __m128i fold(__m128i x, __m128i k, __m128i data) {
+	__m128i lo = _mm_clmulepi64_si128(x, k, 0x00);
+	__m128i hi = _mm_clmulepi64_si128(x, k, 0x11);
+	return _mm_xor_si128(_mm_xor_si128(lo, hi), data);
+}
+
+/**
+ * Carry-less multiply folding, as in Intel's "Fast CRC Computation for
+ * Generic Polynomials Using PCLMULQDQ".  Four 128-bit lanes are folded
+ * 64 bytes at a time, then into one, which is then cut down to 32 bits
+ * by a Barrett reduction.  len is at least 64, and a multiple of 16.
+ */
+__attribute__((target("sse4.2,pclmul")))
+static uint32_t foldClmul(uint32_t crc, uint8_t *p, int len) {
+	const __m128i k1k2 = _mm_set_epi64x(0x1c6e41596LL, 0x154442bd4LL);
+	const __m128i k3k4 = _mm_set_epi64x(0x0ccaa009eLL, 0x1751997d0LL);
+	const __m128i k5 = _mm_set_epi64x(0, 0x163cd6124LL);
+	const __m128i poly = _mm_set_epi64x(0x1f7011641LL, 0x1db710641LL);
+	const __m128i mask32 = _mm_set_epi32(0, 0, 0, -1);
+
+	__m128i x1 = _mm_loadu_si128((__m128i *)p);
+	__m128i x2 = _mm_loadu_si128((__m128i *)(p + 16));
+	__m128i x3 = _mm_loadu_si128((__m128i *)(p + 32));
+	__m128i x4 = _mm_loadu_si128((__m128i *)(p + 48));
+	x1 = _mm_xor_si128(x1, _mm_cvtsi32_si128((int)crc));
+	p += 64;
+	len -= 64;
+	for (; len >= 64; len -= 64, p += 64) {
+		x1 = fold(x1, k1k2, _mm_loadu_si128((__m128i *)p));
+		x2 = fold(x2, k1k2, _mm_loadu_si128((__m128i *)(p + 16)));
+		x3 = fold(x3, k1k2, _mm_loadu_si128((__m128i *)(p + 32)));
+		x4 = fold(x4, k1k2, _mm_loadu_si128((__m128i *)(p + 48)));
+	}
+	x1 = fold(x1, k3k4, x2);
+	x1 = fold(x1, k3k4, x3);
+	x1 = fold(x1, k3k4, x4);
+	for (; len >= 16; len -= 16, p += 16) {
+		x1 = fold(x1, k3k4, _mm_loadu_si128((__m128i *)p));
+	}
+
+	// 128 bits to 64, with 32 zero bits appended
+	__m128i t = _mm_clmulepi64_si128(k3k4, x1, 0x01);
+	x1 = _mm_xor_si128(_mm_srli_si128(x1, 8), t);
+	// 64 to 32
+	t = _mm_srli_si128(x1, 4);
+	x1 = _mm_clmulepi64_si128(_mm_and_si128(x1, mask32), k5, 0x00);
+	x1 = _mm_xor_si128(x1, t);
+	// Barrett reduction
+	t = x1;
+	x1 = _mm_clmulepi64_si128(_mm_and_si128(x1, mask32), poly, 0x10);
+	x1 = _mm_clmulepi64_si128(_mm_and_si128(x1, mask32), poly, 0x00);
+	x1 = _mm_xor_si128(x1, t);
+	return (uint32_t)_mm_extract_epi32(x1, 1);
+}
+#endif
+
+/**
+ * Crc32ofBytes() a byte at a time
+ */
+uint32_t Crc32ofBytesTable(uint8_t *p, int len) {
+	return updateTable(0xffffffff, p, len) ^ 0xffffffff;
+}
+
+/**
+ * Crc32ofBytes() eight bytes at a time
+ */
+uint32_t Crc32ofBytesSlice8(uint8_t *p, int len) {
+	return updateSlice8(0xffffffff, p, len) ^ 0xffffffff;
+}
+
+/**
+ * Crc32ofBytes() sixteen bytes at a time
+ */
+uint32_t Crc32ofBytesSlice16(uint8_t *p, int len) {
+	return updateSlice16(0xffffffff, p, len) ^ 0xffffffff;
+}
+
+/**
+ * Crc32ofBytes() by carry-less multiply folding, with the part of 16
+ * bytes left over by slicing
+ */
+uint32_t Crc32ofBytesClmul(uint8_t *p, int len) {
+	uint32_t crc = 0xffffffff;
+#ifdef ISA_X86
+	if (len >= CLMUL_MIN_LEN && isaHasClmul()) {
+		int whole = len & ~15;
+		crc = foldClmul(crc, p, whole);
+		p += whole;
+		len -= whole;
+	}
+#endif
+	return updateSlice16(crc, p, len) ^ 0xffffffff;
+}
+
+/**
+ * Calculate the crc32 checksum for an array of bytes, by carry-less
+ * multiply where isaHasClmul(), else by slicing
  * @param {ubyte *} p array of bytes
  * @param {int} len number of bytes in array
  * @return {uint32_t} the crc
  */
 uint32_t Crc32ofBytes(uint8_t* p, int len) {
-	uint32_t crc = 0xffffffff;
-	while (len--) {
-		crc =  crcTable[((uint8_t)crc ^ *(p++))] ^ (crc >> 8);
-	}
-	return (crc ^ 0xffffffff);
+	return Crc32ofBytesClmul(p, len);
 }
@@ -0,0 +1,244 @@
+#include <string.h>
+
+#include "half.h"
+#include "isa.h"
+
+#ifdef ISA_X86
+#include <immintrin.h>
+#endif
+
+
+static inline uint32_t floatBits(float f) {
+	uint32_t x;
+	memcpy(&x, &f, sizeof(x));
+	return x;
+}
+
+static inline float bitsFloat(uint32_t x) {
+	float f;
+	memcpy(&f, &x, sizeof(f));
+	return f;
+}
+
+/**
+ * Round a float to FP16
+ */
+uint16_t halfFromFloat(float f) {
+	uint32_t x = floatBits(f);
+	uint32_t sign = (x >> 16) & 0x8000;
+	uint32_t abs = x & 0x7fffffff;
+	if (abs > 0x7f800000) {
+		// NaN, made quiet, with the top of its payload
+		return sign | 0x7e00 | ((abs & 0x7fffff) >> 13);
+	}
+	if (abs >= 0x477ff000) {
+		// 65520 and up round to infinity
+		return sign | 0x7c00;
+	}
+	if (abs < 0x38800000) {
+		// below 2^-14, a subnormal in units of 2^-24
+		if (abs < 0x33000000) {
+			return sign;
+		}
+		int shift = 126 - (abs >> 23);
+		uint32_t m = (abs & 0x7fffff) | 0x800000;
+		uint32_t h = m >> shift;
+		uint32_t rest = m & ((1u << shift) - 1);
+		uint32_t tie = 1u << (shift - 1);
+		if (rest > tie || (rest == tie && (h & 1))) {
+			h++;
+		}
+		return sign | h;
+	}
+	// rebias the exponent from 127 to 15, and round off 13 bits.  A carry
+	// out of the mantissa goes into the exponent, as it should
+	uint32_t h = (abs - 0x38000000) >> 13;
+	uint32_t rest = abs & 0x1fff;
+	if (rest > 0x1000 || (rest == 0x1000 && (h & 1))) {
+		h++;
+	}
+	return sign | h;
+}
+
+/**
+ * Widen FP16 to a float
+ */
+float halfToFloat(uint16_t h) {
+	uint32_t sign = (uint32_t)(h & 0x8000) << 16;
+	uint32_t e = (h >> 10) & 0x1f;
+	uint32_t m = h & 0x3ff;
+	if (e == 31) {
+		return bitsFloat(sign | 0x7f800000 | (m ? 0x400000 : 0) | (m << 13));
+	}
+	if (e == 0) {
+		if (!m) {
+			return bitsFloat(sign);
+		}
+		// normalize the subnormal
+		e = 113;
+		while (!(m & 0x400)) {
+			m <<= 1;
+			e--;
+		}
+		m &= 0x3ff;
+		return bitsFloat(sign | (e << 23) | (m << 13));
+	}
+	return bitsFloat(sign | ((e + 112) << 23) | (m << 13));
+}
+
+/**
+ * Round a float to BF16, with subnormals flushed to zero
+ */
+uint16_t bf16FromFloat(float f) {
+	uint32_t x = floatBits(f);
+	uint32_t abs = x & 0x7fffffff;
+	if (abs > 0x7f800000) {
+		return (x >> 16) | 0x40;
+	}
+	if (abs < 0x00800000) {
+		return (x >> 16) & 0x8000;
+	}
+	x += 0x7fff + ((x >> 16) & 1);
+	return x >> 16;
+}
+
+/**
+ * Widen BF16 to a float
+ */
+float bf16ToFloat(uint16_t h) {
+	return bitsFloat((uint32_t)h << 16);
+}
+
+/**
+ * halfPack() one value at a time
+ */
+void halfPackScalar(uint16_t *out, float *in, int n) {
+	for (int k = 0; k < n; k++) {
+		out[k] = halfFromFloat(in[k]);
+	}
+}
+
+#ifdef ISA_X86
+/**
+ * The whole groups of eight, with F16C.  Returns how many were done
+ */
+__attribute__((target("avx,f16c")))
+static int packF16c(uint16_t *out, float *in, int n) {
+	int k = 0;
+	for (; k + 8 <= n; k += 8) {
+		__m128i h = _mm256_cvtps_ph(_mm256_loadu_ps(in + k), _MM_FROUND_TO_NEAREST_INT);
+		_mm_storeu_si128((__m128i *)(out + k), h);
+	}
+	return k;
+}
+
+__attribute__((target("avx,f16c")))
+static int unpackF16c(float *out, uint16_t *in, int n) {
+	int k = 0;
+	for (; k + 8 <= n; k += 8) {
+		__m128i h = _mm_loadu_si128((__m128i *)(in + k));
+		_mm256_storeu_ps(out + k, _mm256_cvtph_ps(h));
+	}
+	return k;
+}
+
+/**
+ * The whole groups of sixteen, with AVX-512 BF16
+ */
+__attribute__((target("avx512f,avx512bf16")))
+static int packBf16(uint16_t *out, float *in, int n) {
+	int k = 0;
+	for (; k + 16 <= n; k += 16) {
+		__m256bh h = _mm512_cvtneps_pbh(_mm512_loadu_ps(in + k));
+		_mm256_storeu_si256((__m256i *)(out + k), (__m256i)h);
+	}
+	return k;
+}
+#endif
+
+/**
+ * halfPack() eight values at a time
+ */
+void halfPackVector(uint16_t *out, float *in, int n) {
+	int k = 0;
+#ifdef ISA_X86
+	if (isaLevel() >= ISA_AVX2) {
+		k = packF16c(out, in, n);
+	}
+#endif
+	halfPackScalar(out + k, in + k, n - k);
+}
+
+/**
+ * Round n floats to FP16
+ */
+void halfPack(uint16_t *out, float *in, int n) {
+	halfPackVector(out, in, n);
+}
+
+/**
+ * halfUnpack() one value at a time
+ */
+void halfUnpackScalar(float *out, uint16_t *in, int n) {
+	for (int k = 0; k < n; k++) {
+		out[k] = halfToFloat(in[k]);
+	}
+}
+
+/**
+ * halfUnpack() eight values at a time
+ */
+void halfUnpackVector(float *out, uint16_t *in, int n) {
+	int k = 0;
+#ifdef ISA_X86
+	if (isaLevel() >= ISA_AVX2) {
+		k = unpackF16c(out, in, n);
+	}
+#endif
+	halfUnpackScalar(out + k, in + k, n - k);
+}
+
+/**
+ * Widen n FP16 values to floats
+ */
+void halfUnpack(float *out, uint16_t *in, int n) {
+	halfUnpackVector(out, in, n);
+}
+
+/**
+ * bf16Pack() one value at a time
+ */
+void bf16PackScalar(uint16_t *out, float *in, int n) {
+	for (int k = 0; k < n; k++) {
+		out[k] = bf16FromFloat(in[k]);
+	}
+}
+
+/**
+ * bf16Pack() sixteen values at a time
+ */
+void bf16PackVector(uint16_t *out, float *in, int n) {
+	int k = 0;
+#ifdef ISA_X86
+	if (isaHasBf16()) {
+		k = packBf16(out, in, n);
+	}
+#endif
+	bf16PackScalar(out + k, in + k, n - k);
+}
+
+/**
+ * Round n floats to BF16
+ */
+void bf16Pack(uint16_t *out, float *in, int n) {
+	bf16PackVector(out, in, n);
+}
+
+/**
+ * Widen n BF16 values to floats
+ */
+void bf16Unpack(float *out, uint16_t *in, int n) {
+	for (int k = 0; k < n; k++) {
+		out[k] = bf16ToFloat(in[k]);
+	}
+}
@@ -0,0 +1,96 @@
+#include <stdlib.h>
+
+#include "harq.h"
+
+
+/**
+ * Create a new HARQ buffer
+ */
+HarqBuffer *harqCreate(Code *code) {
+	HarqBuffer *h = (HarqBuffer *) malloc(sizeof(HarqBuffer));
+	if (!h) {
+		return (HarqBuffer *)0;
+	}
+	// one edge per row of each QC cell that is not empty
+	int nrEdges = 0;
+	for (int i = 0; i < code->nb * code->mb; i++) {
+		if (code->Hb[i] >= 0) {
+			nrEdges += code->z;
+		}
+	}
+	h->code = code;
+	h->nrEdges = nrEdges;
+	h->llr = (float *) malloc(code->N * sizeof(float));
+	h->messages = (float *) malloc(nrEdges * sizeof(float));
+	if (!h->llr || !h->messages) {
+		harqDestroy(h);
+		return (HarqBuffer *)0;
+	}
+	harqReset(h);
+	return h;
+}
+
+/**
+ * Clean up a HARQ buffer
+ */
+void harqDestroy(HarqBuffer *h) {
+	if (!h) {
+		return;
+	}
+	free(h->llr);
+	free(h->messages);
+	free(h);
+}
+
+/**
+ * Empty the buffer, for a new codeword on this process
+ */
+void harqReset(HarqBuffer *h) {
+	for (int i = 0; i < h->code->N; i++) {
+		h->llr[i] = 0.0f;
+	}
+	h->hasMessages = 0;
+	h->transmissions = 0;
+}
+
+/**
+ * Add a transmission into the buffer.  Values add, since the channel
+ * values of independent looks at a bit add as LLRs.
+ */
+int harqCombine(HarqBuffer *h, float *received, int nrReceived, uint8_t *erased) {
+	int N = h->code->N;
+	int count = N;
+	if (erased) {
+		for (int i = 0; i < N; i++) {
+			count -= erased[i];
+		}
+	}
+	if (count != nrReceived) {
+		return 0;
+	}
+	float *llr = h->llr;
+	for (int i = 0; i < N; i++) {
+		if (!erased || !erased[i]) {
+			llr[i] += *received++;
+		}
+	}
+	h->transmissions++;
+	return 1;
+}
+
+/**
+ * Decode what has been combined so far
+ */
+uint8_t *harqDecode(HarqBuffer *h, LdpcDecoder *dec, int maxIter, int warmStart) {
+	if (warmStart && h->hasMessages) {
+		ldpcDecoderWarmStart(dec, h->messages);
+	}
+	uint8_t *bits = ldpcDecodeMS(dec, h->llr, h->code->N, maxIter);
+	if (bits) {
+		h->hasMessages = 0;
+	} else if (dec->iterations > 0) {
+		ldpcDecoderSaveMessages(dec, h->messages);
+		h->hasMessages = 1;
+	}
+	return bits;
+}
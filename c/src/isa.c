@@ -0,0 +1,120 @@
+#include <stdlib.h>
+#include <string.h>
+#include <pthread.h>
+
+#include "isa.h"
+
+static const char *names[ISA_NR_LEVELS] = { "generic", "sse4.2", "avx2", "avx512" };
+
+static pthread_once_t once = PTHREAD_ONCE_INIT;
+static volatile int level = ISA_GENERIC;
+static volatile int bf16 = 0;
+static volatile int clmul = 0;
+
+/**
+ * Find the best level that this CPU has
+ */
+IsaLevel isaDetect(void) {
+#ifdef ISA_X86
+	__builtin_cpu_init();
+	if (!__builtin_cpu_supports("sse4.2") || !__builtin_cpu_supports("popcnt")) {
+		return ISA_GENERIC;
+	}
+	if (!__builtin_cpu_supports("avx2") || !__builtin_cpu_supports("bmi2") ||
+			!__builtin_cpu_supports("fma") || !__builtin_cpu_supports("f16c")) {
+		return ISA_SSE42;
+	}
+	if (!__builtin_cpu_supports("avx512f") || !__builtin_cpu_supports("avx512bw") ||
+			!__builtin_cpu_supports("avx512vl")) {
+		return ISA_AVX2;
+	}
+	return ISA_AVX512;
+#else
+	return ISA_GENERIC;
+#endif
+}
+
+static int detectBf16(void) {
+#ifdef ISA_X86
+	return __builtin_cpu_supports("avx512bf16") ? 1 : 0;
+#else
+	return 0;
+#endif
+}
+
+static int detectClmul(void) {
+#ifdef ISA_X86
+	return __builtin_cpu_supports("pclmul") ? 1 : 0;
+#else
+	return 0;
+#endif
+}
+
+/**
+ * Look up a level by name
+ */
+int isaParse(const char *name) {
+	for (int i = 0; i < ISA_NR_LEVELS; i++) {
+		if (!strcmp(name, names[i])) {
+			return i;
+		}
+	}
+	return -1;
+}
+
+static void decide(void) {
+	int best = isaDetect();
+	const char *env = getenv("LDPC802_ISA");
+	if (env) {
+		int wanted = isaParse(env);
+		if (wanted >= 0 && wanted < best) {
+			best = wanted;
+		}
+	}
+	level = best;
+	bf16 = best >= ISA_AVX512 && detectBf16();
+	clmul = best >= ISA_SSE42 && detectClmul();
+}
+
+/**
+ * Get the level that the kernels use
+ */
+IsaLevel isaLevel(void) {
+	pthread_once(&once, decide);
+	return (IsaLevel) level;
+}
+
+/**
+ * Set the level that the kernels use
+ */
+IsaLevel isaSelect(IsaLevel wanted) {
+	pthread_once(&once, decide);
+	int best = isaDetect();
+	level = wanted < best ? wanted : best;
+	bf16 = level >= ISA_AVX512 && detectBf16();
+	clmul = level >= ISA_SSE42 && detectClmul();
+	return (IsaLevel) level;
+}
+
+/**
+ * 1 if the kernels may use AVX-512 BF16
+ */
+int isaHasBf16(void) {
+	pthread_once(&once, decide);
+	return bf16;
+}
+
+/**
+ * 1 if the kernels may use PCLMULQDQ
+ */
+int isaHasClmul(void) {
+	pthread_once(&once, decide);
+	return clmul;
+}
+
+/**
+ * Get the name of a level
+ */
+const char *isaName(IsaLevel which) {
+	return which >= 0 && which < ISA_NR_LEVELS ? names[which] : "unknown";
+}
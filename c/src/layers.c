@@ -0,0 +1,138 @@
+#include <stdlib.h>
+
+#include "layers.h"
+
+
+/**
+ * Count the block columns that two layers both touch
+ */
+int layerOverlap(Code *code, int a, int b) {
+	int nb = code->nb;
+	int count = 0;
+	for (int j = 0; j < nb; j++) {
+		if (code->Hb[a * nb + j] >= 0 && code->Hb[b * nb + j] >= 0) {
+			count++;
+		}
+	}
+	return count;
+}
+
+/**
+ * Find the cyclic order of layers with the least total overlap between
+ * neighbors.  This is a travelling salesman tour over at most 12 layers,
+ * so Held-Karp, O(2^mb mb^2), is quick enough to run at create time.
+ * The tour starts at layer 0, since any rotation of it is as good.
+ */
+static int bestOrder(Code *code, int *order) {
+	int mb = code->mb;
+	int overlap[LAYERS_MAX_MB][LAYERS_MAX_MB];
+	for (int a = 0; a < mb; a++) {
+		for (int b = 0; b < mb; b++) {
+			overlap[a][b] = layerOverlap(code, a, b);
+		}
+	}
+	int full = 1 << mb;
+	// cost[mask * mb + last] of the best path from 0 through mask, ending at last
+	int *cost = (int *) malloc(full * mb * sizeof(int));
+	int *from = (int *) malloc(full * mb * sizeof(int));
+	if (!cost || !from) {
+		free(cost);
+		free(from);
+		return -1;
+	}
+	for (int i = 0; i < full * mb; i++) {
+		cost[i] = -1;
+	}
+	cost[1 * mb + 0] = 0;
+	for (int mask = 1; mask < full; mask += 2) {
+		for (int last = 0; last < mb; last++) {
+			int c = cost[mask * mb + last];
+			if (c < 0) {
+				continue;
+			}
+			for (int next = 1; next < mb; next++) {
+				if (mask & (1 << next)) {
+					continue;
+				}
+				int m = mask | (1 << next);
+				int nc = c + overlap[last][next];
+				int *slot = &cost[m * mb + next];
+				if (*slot < 0 || nc < *slot) {
+					*slot = nc;
+					from[m * mb + next] = last;
+				}
+			}
+		}
+	}
+	int mask = full - 1;
+	int best = -1;
+	int last = 0;
+	for (int l = 0; l < mb; l++) {
+		int c = cost[mask * mb + l];
+		if (c < 0) {
+			continue;
+		}
+		c += overlap[l][0];
+		if (best < 0 || c < best) {
+			best = c;
+			last = l;
+		}
+	}
+	for (int k = mb - 1; k > 0; k--) {
+		order[k] = last;
+		int prev = from[mask * mb + last];
+		mask &= ~(1 << last);
+		last = prev;
+	}
+	order[0] = 0;
+	free(cost);
+	free(from);
+	return best;
+}
+
+/**
+ * Work out a layer schedule for a code
+ */
+void layerScheduleInit(LayerSchedule *s, Code *code, int optimize) {
+	int mb = code->mb;
+	int nb = code->nb;
+	s->nrLayers = mb;
+	for (int k = 0; k < mb; k++) {
+		s->order[k] = k;
+	}
+	if (optimize && mb > 2) {
+		int order[LAYERS_MAX_MB];
+		if (bestOrder(code, order) >= 0) {
+			for (int k = 0; k < mb; k++) {
+				s->order[k] = order[k];
+			}
+		}
+	}
+
+	/**
+	 * Within a layer, a column the next layer needs should be written
+	 * early, and a column the last layer wrote should be read late
+	 */
+	s->stalls = 0;
+	for (int k = 0; k < mb; k++) {
+		int layer = s->order[k];
+		int prev = s->order[(k + mb - 1) % mb];
+		int next = s->order[(k + 1) % mb];
+		s->stalls += layerOverlap(code, layer, next);
+		int n = 0;
+		for (int rank = -1; rank <= 1; rank++) {
+			for (int j = 0; j < nb; j++) {
+				int *row = code->Hb + layer * nb;
+				if (row[j] < 0) {
+					continue;
+				}
+				int early = mb > 1 && code->Hb[next * nb + j] >= 0;
+				int late = mb > 1 && code->Hb[prev * nb + j] >= 0;
+				if (late - early == rank) {
+					s->columns[layer][n++] = j;
+				}
+			}
+		}
+		s->nrColumns[layer] = n;
+	}
+}
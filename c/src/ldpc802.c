@@ -1,16 +1,252 @@
-
 #include <stdlib.h>
+#include <string.h>
+
+#include "ldpc802.h"
+#include "util.h"
 
-#include <ldpc802.h>
+#define DEFAULT_MAX_ITER 50
 
-LdpcCodec* ldpcCodecCreate() {
-	LdpcCodec *codec = (LdpcCodec *) malloc(sizeof(LdpcCodec));
-	//initialize
+/**
+ * Create a new codec
+ * @param {Code *} code the code to use for each frame
+ * @param {int} withCrc 1 to seal each chunk with a CRC32, else 0
+ * @return {LdpcCodec *} a new codec if successful, else null
+ */
+LdpcCodec *ldpcCodecCreate(Code *code, int withCrc) {
+	LdpcCodec *codec = (LdpcCodec *) calloc(1, sizeof(LdpcCodec));
+	if (!codec) {
+		return codec;
+	}
+	codec->code = code;
+	codec->withCrc = withCrc ? 1 : 0;
+	codec->maxIter = DEFAULT_MAX_ITER;
+	codec->chunkBytes = code->messageBits / 8 - (withCrc ? 4 : 0);
+	codec->parityBytes = (code->N - code->messageBits + 7) / 8;
+	codec->frameBytes = ldpcCodecFrameBytes(codec, codec->chunkBytes);
+	codec->encoder = ldpcEncoderCreate(code);
+	codec->decoder = ldpcDecoderCreate(code);
+	codec->txChunk = (uint8_t *) malloc(code->messageBits / 8);
+	codec->rxFrame = (float *) malloc(codec->frameBytes * 8 * sizeof(float));
+	codec->rxBytes = (uint8_t *) malloc(code->messageBits / 8);
+	if (!codec->encoder || !codec->decoder || !codec->txChunk ||
+			!codec->rxFrame || !codec->rxBytes) {
+		ldpcCodecDestroy(codec);
+		return (LdpcCodec *)0;
+	}
 	return codec;
 }
 
+/**
+ * Clean up a codec
+ * @param {LdpcCodec *} codec the codec to destroy
+ */
 void ldpcCodecDestroy(LdpcCodec *codec) {
-	if (codec) {
-		free(codec);
+	if (!codec) {
+		return;
+	}
+	ldpcEncoderDestroy(codec->encoder);
+	ldpcDecoderDestroy(codec->decoder);
+	scramblerDestroy(codec->txScrambler);
+	scramblerDestroy(codec->rxScrambler);
+	free(codec->txChunk);
+	free(codec->rxFrame);
+	free(codec->rxBytes);
+	free(codec);
+}
+
+/**
+ * Turn on whitening of the payload with the 802.11 scrambler
+ * @param {LdpcCodec *} codec the codec
+ * @param {int} seed the scrambler seed, 1 to 127, or 0 to turn it off
+ * @return {int} 1 if successful, else 0
+ */
+int ldpcCodecSetScrambler(LdpcCodec *codec, int seed) {
+	Scrambler *tx = (Scrambler *)0;
+	Scrambler *rx = (Scrambler *)0;
+	if (seed) {
+		tx = scramblerCreate(seed);
+		rx = scramblerCreate(seed);
+		if (!tx || !rx) {
+			scramblerDestroy(tx);
+			scramblerDestroy(rx);
+			return 0;
+		}
+	}
+	scramblerDestroy(codec->txScrambler);
+	scramblerDestroy(codec->rxScrambler);
+	codec->txScrambler = tx;
+	codec->rxScrambler = rx;
+	return 1;
+}
+
+/**
+ * Get the size of the frame that carries a chunk
+ */
+int ldpcCodecFrameBytes(LdpcCodec *codec, int nrBytes) {
+	return nrBytes + (codec->withCrc ? 4 : 0) + codec->parityBytes;
+}
+
+/**
+ * Get the most output that ldpcCodecEncode() will give for an input
+ */
+int ldpcCodecEncodeSize(LdpcCodec *codec, int len) {
+	return ((codec->txLen + len) / codec->chunkBytes) * codec->frameBytes;
+}
+
+/**
+ * Get the most output that ldpcCodecDecode() will give for an input
+ */
+int ldpcCodecDecodeSize(LdpcCodec *codec, int len) {
+	return ((codec->rxLen + len) / (codec->frameBytes * 8)) * codec->chunkBytes;
+}
+
+
+/**
+ * Encode the chunk in txChunk into a frame
+ * @return {int} the size of the frame
+ */
+static int encodeChunk(LdpcCodec *codec, int len, uint8_t *out) {
+	int messageBits = codec->code->messageBits;
+	// the payload goes straight into the frame, and is encoded from there
+	if (codec->txScrambler) {
+		scramblerScramble(codec->txScrambler, out, codec->txChunk, len);
+	} else {
+		memcpy(out, codec->txChunk, len);
+	}
+	uint8_t *x;
+	if (codec->withCrc) {
+		x = ldpcEncodeBytesCrc(codec->encoder, out, len, out + len);
+		len += 4;
+	} else {
+		x = ldpcEncodeBytes(codec->encoder, out, len);
+	}
+	bitsToBytesBE(out + len, x + messageBits, codec->code->N - messageBits);
+	return len + codec->parityBytes;
+}
+
+/**
+ * Push bytes into the transmit side
+ */
+int ldpcCodecEncode(LdpcCodec *codec, uint8_t *bytes, int len, uint8_t *out, int outLen) {
+	if (outLen < ldpcCodecEncodeSize(codec, len)) {
+		return -1;
+	}
+	int chunkBytes = codec->chunkBytes;
+	int written = 0;
+	while (len > 0) {
+		int n = chunkBytes - codec->txLen;
+		if (n > len) {
+			n = len;
+		}
+		memcpy(codec->txChunk + codec->txLen, bytes, n);
+		codec->txLen += n;
+		bytes += n;
+		len -= n;
+		if (codec->txLen == chunkBytes) {
+			written += encodeChunk(codec, chunkBytes, out + written);
+			codec->txLen = 0;
+		}
 	}
-}
\ No newline at end of file
+	return written;
+}
+
+/**
+ * Send whatever is left in the transmit side as a short frame
+ */
+int ldpcCodecEncodeFlush(LdpcCodec *codec, uint8_t *out, int outLen) {
+	int len = codec->txLen;
+	if (!len) {
+		return 0;
+	}
+	if (outLen < ldpcCodecFrameBytes(codec, len)) {
+		return -1;
+	}
+	codec->txLen = 0;
+	return encodeChunk(codec, len, out);
+}
+
+
+/**
+ * Decode the frame in rxFrame, of len soft bits
+ * @return {int} the size of the payload, or 0 if it is dropped
+ */
+static int decodeFrame(LdpcCodec *codec, int len, uint8_t *out) {
+	Code *code = codec->code;
+	int crcBytes = codec->withCrc ? 4 : 0;
+	int sentBytes = len / 8 - codec->parityBytes;
+	int payload = sentBytes - crcBytes;
+	if (payload <= 0 || payload > codec->chunkBytes) {
+		codec->decodeErrors++;
+		return 0;
+	}
+	codec->frames++;
+
+	int sentBits = sentBytes * 8;
+	// the decoder checks the CRC as it goes, and stops once it passes
+	if (codec->withCrc) {
+		ldpcDecoderSetCrc(codec->decoder, payload * 8, payload);
+	}
+	// the bits that were not sent are known zeros, and are left out of the decoding
+	uint8_t *bits = ldpcDecodeShortenedMS(codec->decoder, codec->rxFrame,
+		code->messageBits - sentBits, codec->maxIter);
+	if (!bits) {
+		if (codec->decoder->status == LDPC_BAD_CRC) {
+			codec->crcErrors++;
+		} else {
+			codec->decodeErrors++;
+		}
+		if (codec->rxScrambler) {
+			scramblerSkip(codec->rxScrambler, payload);
+		}
+		return 0;
+	}
+	uint8_t *bytes = codec->rxBytes;
+	bitsToBytesBE(bytes, bits, sentBits);
+	if (codec->rxScrambler) {
+		scramblerDescramble(codec->rxScrambler, out, bytes, payload);
+	} else {
+		memcpy(out, bytes, payload);
+	}
+	return payload;
+}
+
+/**
+ * Push received soft bits into the receive side
+ */
+int ldpcCodecDecode(LdpcCodec *codec, float *samples, int len, uint8_t *out, int outLen) {
+	if (outLen < ldpcCodecDecodeSize(codec, len)) {
+		return -1;
+	}
+	int frameBits = codec->frameBytes * 8;
+	int written = 0;
+	while (len > 0) {
+		int n = frameBits - codec->rxLen;
+		if (n > len) {
+			n = len;
+		}
+		memcpy(codec->rxFrame + codec->rxLen, samples, n * sizeof(float));
+		codec->rxLen += n;
+		samples += n;
+		len -= n;
+		if (codec->rxLen == frameBits) {
+			written += decodeFrame(codec, frameBits, out + written);
+			codec->rxLen = 0;
+		}
+	}
+	return written;
+}
+
+/**
+ * Decode whatever is left in the receive side as a short frame
+ */
+int ldpcCodecDecodeFlush(LdpcCodec *codec, uint8_t *out, int outLen) {
+	int len = codec->rxLen;
+	if (!len) {
+		return 0;
+	}
+	if (outLen < codec->chunkBytes) {
+		return -1;
+	}
+	codec->rxLen = 0;
+	return decodeFrame(codec, len, out);
+}
@@ -1,11 +1,25 @@
 
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 #include <math.h>
 
 #include "ldpcDecoder.h"
+#include "syndrome.h"
+#include "scms.h"
+#include "half.h"
+#include "crc32.h"
 #include "util.h"
 
+/**
+ * Where a decode keeps its check node messages, see ldpcDecoderSaveMessages()
+ */
+typedef enum {
+	STORE_EDGES = 0, // qr->r of each edge
+	STORE_KERNEL,    // dec->kernelR, by kernelPass()
+	STORE_HALF,      // dec->halfMessages, by halfPass()
+	STORE_COMPRESSED // dec->compressedChecks
+} MessageStore;
 
 /*
 static float calcVariance(float *samples, int n) {
@@ -21,9 +35,20 @@ static float calcVariance(float *samples, int n) {
 }
 */	
 
+/**
+ * Input value for a bit that is known to be 0.  Only its sign is used,
+ * since pinned bits take no part in the iterations
+ */
+#define KNOWN_ZERO 20.0f
+
+/**
+ * Bit flips for ldpcDecode() to try before min-sum
+ */
+#define DEFAULT_BF_FLIPS 16
+
 static float atanhCalc(float x) {
 	if (x < -0.9999) {
-		return 5.0f;
+		return -5.0f;
 	} else if (x > 0.9999) {
 		return 5.0f;
 	} else {
@@ -32,27 +57,196 @@ static float atanhCalc(float x) {
 }
 
 /**
- * Check is the codeword passes check.  Fails early
- * for speed.
- * @param {int **} H sparse matrix
- * @param {int} len sparse matrix length
- * @param {array} codeword the word to check
- * @return {boolean} true if passes 
+ * Decide whether the current hard decisions are done with.  Without a CRC
+ * that is when every check passes.  With one, it is when the CRC passes,
+ * and a word that passes every check but not the CRC is given up on.
+ * @param {LdpcDecoder *} dec the decoder context
+ * @return {int} 1 to accept the word, -1 to give up on it, 0 to go on
  */
-static int checkFast(int **matrix, int len, uint8_t *codeword) {
+static int checkDone(LdpcDecoder *dec) {
+	if (!dec->crcPos) {
+		return !dec->unsatisfied;
+	}
+	if (dec->crcCalc == dec->crcGiven) {
+		return 1;
+	}
+	if (!dec->unsatisfied) {
+		dec->status = LDPC_BAD_CRC;
+		return -1;
+	}
+	return 0;
+}
 
-	for (int i = 0; i < len; i++) {
-		int *row = matrix[i];
-		int rlen = row[0];
-		int sum = 0;
-		for (int j = 1; j <= rlen; j++) {
-			sum ^= codeword[row[j]];
+/**
+ * Work out the CRC of the hard decisions in dec->syndrome from scratch
+ */
+static void loadCrc(LdpcDecoder *dec) {
+	if (!dec->crcPos) {
+		return;
+	}
+	uint8_t *c = dec->syndrome;
+	uint32_t crc = dec->crcZero;
+	for (int i = dec->crcStart; i < dec->crcPos; i++) {
+		if (c[i]) {
+			crc ^= dec->crcTerms[i];
 		}
-		if (sum) {
-			return 0;
+	}
+	dec->crcCalc = crc;
+	uint32_t given = 0;
+	for (int i = 0; i < 32; i++) {
+		given = (given << 1) | c[dec->crcPos + i];
+	}
+	dec->crcGiven = given;
+}
+
+/**
+ * Slice the input to hard bits and check them before doing any message
+ * passing.  At high SNR most words pass here, and need nothing more.
+ * @param {LdpcDecoder *} dec the decoder context
+ * @param {float *} inBits message array of data from -1 -> 1
+ * @return {int} as for checkDone().  The hard bits are left in dec->syndrome
+ */
+static int checkHard(LdpcDecoder *dec, float *inBits) {
+	QcWord words[SYNDROME_MAX_NB];
+	uint8_t *c = dec->syndrome;
+	syndromePackSoft(words, dec->code, inBits, c);
+	dec->iterations = 0;
+	dec->updates = 0;
+	dec->unsatisfied = syndromeRows(dec->code, words, dec->parity);
+	dec->status = LDPC_OK;
+	loadCrc(dec);
+	int verdict = checkDone(dec);
+	dec->fastPath = verdict > 0;
+	return verdict;
+}
+
+/**
+ * Give the soft output of a word that is done with before any iterations.
+ * With no check messages yet, the posterior is the channel value alone.
+ * @param {LdpcDecoder *} dec the decoder context
+ * @param {float *} inBits message array of data from -1 -> 1
+ * @param {float} weight the scale from the input to the decoder's LLRs
+ */
+static void softFromInput(LdpcDecoder *dec, float *inBits, float weight) {
+	int N = dec->code->N;
+	if (dec->appOut) {
+		for (int i = 0; i < N; i++) {
+			dec->appOut[i] = inBits[i] * weight;
+		}
+	}
+	if (dec->extOut) {
+		for (int i = 0; i < N; i++) {
+			dec->extOut[i] = 0.0f;
 		}
 	}
-	return 1;
+}
+
+/**
+ * The place of each block column among the edges of a check node of a
+ * layer, when they are in the order of the rows of H, which is by column.
+ * The links of a check node may be in any order, see ldpcDecoderSetLayers()
+ * @param {Code *} code the code
+ * @param {int} layer the QC block row of the check node
+ * @param {int *} rank output for the place of each block column
+ * @return {int} the number of edges of the check node
+ */
+static int columnRanks(Code *code, int layer, int *rank) {
+	int nb = code->nb;
+	int deg = 0;
+	for (int j = 0; j < nb; j++) {
+		rank[j] = deg;
+		deg += code->Hb[layer * nb + j] >= 0;
+	}
+	return deg;
+}
+
+/**
+ * Load saved check node messages, and bring the variable node messages
+ * up to date with them, as step 3 would.  Flooding keeps no other state
+ * between iterations, so this carries on as if the earlier decode had
+ * never stopped.  Called after step 1, which has set ci.
+ * @param {LdpcDecoder *} dec the decoder context
+ * @param {float *} saved the messages, from ldpcDecoderSaveMessages()
+ */
+static void loadMessages(LdpcDecoder *dec, float *saved) {
+	Code *code = dec->code;
+	int z = code->z;
+	int rank[LAYERS_MAX_NB];
+	for (int c = 0; c < code->M; c++) {
+		int deg = columnRanks(code, c / z, rank);
+		for (QRNode *qr = dec->checks[c]->qrNodes; qr; qr = qr->next) {
+			qr->r = saved[rank[qr->vnode->index / z]];
+		}
+		saved += deg;
+	}
+	for (VariableNode *vnode = dec->activeVariables; vnode; vnode = vnode->nextActive) {
+		for (Link *link = vnode->links; link; link = link->next) {
+			float sum = 0.0;
+			for (Link *c = vnode->links; c; c = c->next) {
+				if (c != link) {
+					sum += c->qr->r;
+				}
+			}
+			link->qr->q = vnode->ci + sum;
+		}
+	}
+}
+
+/**
+ * Watch the count of unsatisfied checks from one iteration to the next.
+ * A word that has gone stallLimit iterations without a new low is
+ * unlikely to ever converge, so it is better to give up on it.
+ * @param {LdpcDecoder *} dec the decoder context
+ * @param {int *} best the lowest count so far
+ * @param {int *} since the number of iterations since best was set
+ * @return {boolean} true if the decode has stalled
+ */
+static int checkStall(LdpcDecoder *dec, int *best, int *since) {
+	if (!dec->stallLimit) {
+		return 0;
+	}
+	if (dec->unsatisfied < *best) {
+		*best = dec->unsatisfied;
+		*since = 0;
+		return 0;
+	}
+	return ++(*since) >= dec->stallLimit;
+}
+
+/**
+ * Keep the CRC up to date when hard decision i flips
+ */
+static inline void flipCrc(LdpcDecoder *dec, int i) {
+	if (i < dec->crcPos) {
+		if (i >= dec->crcStart) {
+			dec->crcCalc ^= dec->crcTerms[i];
+		}
+	} else if (i < dec->crcPos + 32 && dec->crcPos) {
+		dec->crcGiven ^= 0x80000000u >> (i - dec->crcPos);
+	}
+}
+
+/**
+ * Set the hard decision of a variable node.  If it flips, only the
+ * parity of its own checks changes, so the count of unsatisfied checks
+ * is kept up to date without checking all of H again.
+ * @param {LdpcDecoder *} dec the decoder context
+ * @param {int} i the index of the variable node
+ * @param {Link *} links the links of the variable node
+ * @param {uint8_t} bit the new hard decision
+ */
+static inline void setHard(LdpcDecoder *dec, int i, Link *links, uint8_t bit) {
+	if (dec->syndrome[i] == bit) {
+		return;
+	}
+	dec->syndrome[i] = bit;
+	flipCrc(dec, i);
+	uint8_t *parity = dec->parity;
+	for (Link *link = links; link; link = link->next) {
+		int check = link->check;
+		parity[check] ^= 1;
+		dec->unsatisfied += parity[check] ? 1 : -1;
+	}
 }
 
 
@@ -81,13 +275,31 @@ static int createTanner(LdpcDecoder *dec) {
 			vnhead->next = vn;
 			vnhead = vn;
 		}
+		vn->index = i;
 		vn->ci = 0.0;
 		vn->links = (Link *) 0;
 		vn->linkHead = (Link *) 0;
 		vn->next = (VariableNode *) 0;
+		vn->nextActive = (VariableNode *) 0;
 	}
 
 
+	/**
+	 * 16-bit message store, a block for each check node, see halfPass()
+	 */
+	int nrEdges = 0;
+	for (int i = 0; i < M; i++) {
+		nrEdges += H[i][0];
+	}
+	dec->halfMessages = (uint16_t *) malloc(nrEdges * sizeof(uint16_t));
+	if (!dec->halfMessages) {
+		return 0;
+	}
+	dec->compressedChecks = (CompressedCheck *) malloc(M * sizeof(CompressedCheck));
+	if (!dec->compressedChecks) {
+		return 0;
+	}
+
 	/**
 	 * Set up QR records, and link to them from both sides
 	 * using the sparse array information from H
@@ -112,12 +324,17 @@ static int createTanner(LdpcDecoder *dec) {
 			QRNode *qr = (QRNode *) malloc(sizeof(QRNode));
 			qr->q = 0.0;
 			qr->r = 0.0;
+			qr->rNext = 0.0;
+			qr->t = 0.0;
+			qr->pinned = 0;
 			qr->next = (QRNode *)0;
+			qr->nextActive = (QRNode *)0;
 			if (!qrNodes) {
 				qrNodes = qr;
 				qrHead = qr;
 			} else {
 				qrHead->next = qr;
+				qrHead->nextActive = qr;
 				qrHead = qr;
 			}
 
@@ -137,8 +354,16 @@ static int createTanner(LdpcDecoder *dec) {
 			}
 			link->next = (Link *)0;
 			link->qr = qr;
+			link->check = i;
+			link->checkNode = cn;
+			qr->vnode = vn;
 		}
 		cn->qrNodes = qrNodes;
+		cn->active = qrNodes;
+		cn->residual = 0.0;
+		cn->heapPos = i;
+		dec->heap[i] = cn;
+		dec->checks[i] = cn;
 	}
 	// printf("M:%d max: %d\n", M, max);
 
@@ -147,9 +372,58 @@ static int createTanner(LdpcDecoder *dec) {
 	 */
 	dec->checkNodes = cnodes;
 	dec->variableNodes = vnodes;
+	dec->activeVariables = vnodes;
+	for (VariableNode *vn = vnodes; vn; vn = vn->next) {
+		vn->nextActive = vn->next;
+	}
+	dec->pinStart = 0;
+	dec->pinEnd = 0;
 	return 1;
 }
 
+/**
+ * Pin a range of variable nodes, whose values are known, and take them
+ * and their edges out of the active lists that the iterations walk.
+ * A known 0 has infinite reliability, which changes neither the min nor
+ * the product of a check node, so leaving its edges out gives the same
+ * result for less work.
+ * @param {LdpcDecoder *} dec the decoder context
+ * @param {int} start the first variable to pin
+ * @param {int} end one past the last, or the same as start for none
+ */
+static void setPinned(LdpcDecoder *dec, int start, int end) {
+	if (start == end) {
+		start = end = 0;
+	}
+	if (start == dec->pinStart && end == dec->pinEnd) {
+		return;
+	}
+	VariableNode **tail = &dec->activeVariables;
+	for (VariableNode *vn = dec->variableNodes; vn; vn = vn->next) {
+		int pinned = vn->index >= start && vn->index < end;
+		for (Link *link = vn->links; link; link = link->next) {
+			link->qr->pinned = pinned;
+		}
+		if (!pinned) {
+			*tail = vn;
+			tail = &vn->nextActive;
+		}
+	}
+	*tail = (VariableNode *)0;
+	for (CheckNode *cn = dec->checkNodes; cn; cn = cn->next) {
+		QRNode **qrTail = &cn->active;
+		for (QRNode *qr = cn->qrNodes; qr; qr = qr->next) {
+			if (!qr->pinned) {
+				*qrTail = qr;
+				qrTail = &qr->nextActive;
+			}
+		}
+		*qrTail = (QRNode *)0;
+	}
+	dec->pinStart = start;
+	dec->pinEnd = end;
+}
+
 
 
 /**
@@ -165,6 +439,24 @@ LdpcDecoder *ldpcDecoderCreate(Code *code) {
 	}
 
 	dec->code = code;
+	dec->schedule = LDPC_SCHEDULE_FLOODING;
+	dec->selfCorrect = 0;
+	dec->compressed = 0;
+	dec->messageFormat = LDPC_MESSAGES_FP32;
+	dec->specialized = 1;
+	dec->stallLimit = 0;
+	dec->crcStart = 0;
+	dec->crcPos = 0;
+	dec->appOut = (float *)0;
+	dec->extOut = (float *)0;
+	dec->warmStart = (float *)0;
+	dec->messageStore = STORE_EDGES;
+	dec->bfMaxFlips = DEFAULT_BF_FLIPS;
+	dec->bfFallback = 1;
+	dec->osd = (LdpcOsd *)0;
+	for (int i = 0; i < LDPC_NR_STAGES; i++) {
+		dec->stageCounts[i] = 0;
+	}
 
 	Table *table = tableCreate(code);
 	if (!table) {
@@ -178,9 +470,93 @@ LdpcDecoder *ldpcDecoderCreate(Code *code) {
 		tableDestroy(table);
 		return (LdpcDecoder *)0;
 	}
+	dec->kernel = ldpcKernelFind(code);
+	dec->kernelR = (float *)0;
+	if (dec->kernel) {
+		dec->kernelR = (float *) malloc(dec->kernel->nrEdges * sizeof(float));
+		if (!dec->kernelR) {
+			ldpcDecoderDestroy(dec);
+			return (LdpcDecoder *)0;
+		}
+	}
+	ldpcDecoderSetLayers(dec, 1);
 	return dec;
 }
 
+/**
+ * Set the layer order for the row-layered schedule.  Each check node's
+ * edges are relinked in the column order of its layer, so that the
+ * decoder reads and writes the columns in that order.
+ */
+void ldpcDecoderSetLayers(LdpcDecoder *dec, int optimize) {
+	Code *code = dec->code;
+	int z = code->z;
+	LayerSchedule *s = &dec->layers;
+	layerScheduleInit(s, code, optimize);
+	for (int layer = 0; layer < code->mb; layer++) {
+		int *columns = s->columns[layer];
+		for (int i = 0; i < z; i++) {
+			CheckNode *cn = dec->checks[layer * z + i];
+			QRNode *byColumn[LAYERS_MAX_NB];
+			for (QRNode *qr = cn->qrNodes; qr; qr = qr->next) {
+				byColumn[qr->vnode->index / z] = qr;
+			}
+			QRNode **tail = &cn->qrNodes;
+			for (int j = 0; j < s->nrColumns[layer]; j++) {
+				*tail = byColumn[columns[j]];
+				tail = &(*tail)->next;
+			}
+			*tail = (QRNode *)0;
+		}
+	}
+	// the active lists follow the new order
+	int start = dec->pinStart;
+	int end = dec->pinEnd;
+	dec->pinStart = -1;
+	setPinned(dec, start, end);
+}
+
+/**
+ * Turn on CRC-aided termination.  The CRC is linear in the message bits,
+ * so each bit has a fixed term that it adds in when it is a 1.  These
+ * are found by running the reflected CRC register back from the end.
+ */
+int ldpcDecoderSetCrc(LdpcDecoder *dec, int pos, int nrBytes) {
+	int start = pos - nrBytes * 8;
+	if (!nrBytes) {
+		dec->crcPos = 0;
+		return 1;
+	}
+	if (start < 0 || pos + 32 > dec->code->N) {
+		return 0;
+	}
+	if (dec->crcPos == pos && dec->crcStart == start) {
+		return 1;
+	}
+	uint8_t zeros[243];
+	for (int i = 0; i < nrBytes; i++) {
+		zeros[i] = 0;
+	}
+	dec->crcZero = Crc32ofBytes(zeros, nrBytes);
+	// each byte goes into the register LSB first
+	uint32_t term = 0xedb88320u;
+	for (int step = nrBytes * 8 - 1; step >= 0; step--) {
+		int i = start + (step & ~7) + 7 - (step & 7);
+		dec->crcTerms[i] = term;
+		term = (term & 1) ? (term >> 1) ^ 0xedb88320u : term >> 1;
+	}
+	dec->crcStart = start;
+	dec->crcPos = pos;
+	return 1;
+}
+
+/**
+ * Start the next decode from saved check node messages
+ */
+void ldpcDecoderWarmStart(LdpcDecoder *dec, float *r) {
+	dec->warmStart = r;
+}
+
 /**
  * Clean up a decoder context
  */
@@ -190,6 +566,9 @@ void ldpcDecoderDestroy(LdpcDecoder *dec) {
 	}
 
 	tableDestroy(dec->table);
+	free(dec->halfMessages);
+	free(dec->compressedChecks);
+	free(dec->kernelR);
 
 	/**
 	 * Check Nodes
@@ -239,29 +618,689 @@ void makeLlr(float *inBits, int nrBits) {
 
 
 /**
- * Decode codeword bits to message bits by the Sum-Product algorithm
+ * Sum-product message from a check node to one of its edges, from the
+ * q of the other active edges
+ * @param {QRNode *} qrNodes the active edges of the check node
+ * @param {QRNode *} qr the edge to update
+ * @return {float} the new r
+ */
+static inline float checkSP(QRNode *qrNodes, QRNode *qr) {
+	float prod = 1.0;
+	for (QRNode *v = qrNodes; v; v = v->nextActive) {
+		if (v == qr) {
+			continue;
+		}
+		float q = v->q;
+		q = q < -20.0 ? -20.0 : q > 20.0 ? 20.0 : q;
+		prod *= tanhf(0.5f * q);
+	}
+	return 2.0f * atanhCalc(prod);
+}
+
+/**
+ * Min-sum message from a check node to one of its edges, from the
+ * q of the other active edges
+ * @param {QRNode *} qrNodes the active edges of the check node
+ * @param {QRNode *} qr the edge to update
+ * @return {float} the new r
+ */
+static inline float checkMS(QRNode *qrNodes, QRNode *qr) {
+	float prod = 1000.0;
+	for (QRNode *v = qrNodes; v; v = v->nextActive) {
+		if (v == qr) {
+			continue;
+		}
+		float q = v->q;
+		q = q < -20.0 ? -20.0 : q > 20.0 ? 20.0 : q;
+		float absProd = fabs(prod);
+		float absQ = fabs(q);
+		float sgnQ = q < 0.0 ? -1.0 : 1.0;
+		float sgnProd = prod < 0 ? -1.0 : 1.0;
+		float min = absQ < absProd ? absQ : absProd;
+		prod = sgnQ * sgnProd * min;
+	}
+	return prod;
+}
+
+/**
+ * Update the q of each edge of a variable node, from the r of its other edges
+ * @param {VariableNode *} vnode the variable node
+ * @param {int} selfCorrect 1 to erase the q that change sign, see scmsUpdate()
+ */
+static inline void updateQ(VariableNode *vnode, int selfCorrect) {
+	if (selfCorrect) {
+		float r[SCMS_MAX_DEGREE];
+		float q[SCMS_MAX_DEGREE];
+		int n = 0;
+		for (Link *link = vnode->links; link; link = link->next) {
+			r[n] = link->qr->r;
+			q[n] = link->qr->q;
+			n++;
+		}
+		scmsUpdate(vnode->ci, r, q, n);
+		n = 0;
+		for (Link *link = vnode->links; link; link = link->next) {
+			link->qr->q = q[n++];
+		}
+		return;
+	}
+	for (Link *link = vnode->links; link; link = link->next) {
+		float sum = 0.0;
+		for (Link *c = vnode->links; c; c = c->next) {
+			if (c != link) {
+				sum += c->qr->r;
+			}
+		}
+		link->qr->q = vnode->ci + sum;
+	}
+}
+
+/**
+ * A check node message function, checkSP() or checkMS()
+ */
+typedef float (*CheckFunc)(QRNode *qrNodes, QRNode *qr);
+
+/**
+ * Move a check node up the residual heap to its place
+ */
+static void heapUp(CheckNode **heap, int pos) {
+	CheckNode *cn = heap[pos];
+	while (pos > 0) {
+		int parent = (pos - 1) >> 1;
+		if (heap[parent]->residual >= cn->residual) {
+			break;
+		}
+		heap[pos] = heap[parent];
+		heap[pos]->heapPos = pos;
+		pos = parent;
+	}
+	heap[pos] = cn;
+	cn->heapPos = pos;
+}
+
+/**
+ * Move a check node down the residual heap to its place
+ */
+static void heapDown(CheckNode **heap, int len, int pos) {
+	CheckNode *cn = heap[pos];
+	while (1) {
+		int child = 2 * pos + 1;
+		if (child >= len) {
+			break;
+		}
+		if (child + 1 < len && heap[child + 1]->residual > heap[child]->residual) {
+			child++;
+		}
+		if (heap[child]->residual <= cn->residual) {
+			break;
+		}
+		heap[pos] = heap[child];
+		heap[pos]->heapPos = pos;
+		pos = child;
+	}
+	heap[pos] = cn;
+	cn->heapPos = pos;
+}
+
+/**
+ * Set tanh(q/2) of each edge of a variable node from its q, for
+ * findResidual().  Only the edges of the variables of an update have new
+ * q, so each tanh is taken once, not once for each message made from it.
+ * @param {VariableNode *} vnode the variable node
+ */
+static inline void updateTanh(VariableNode *vnode) {
+	for (Link *link = vnode->links; link; link = link->next) {
+		QRNode *qr = link->qr;
+		float q = qr->q;
+		q = q < -20.0 ? -20.0 : q > 20.0 ? 20.0 : q;
+		qr->t = tanhf(0.5f * q);
+	}
+}
+
+/**
+ * Work out the next sum-product messages of a check node, and how far they
+ * are from the current ones.  The product of the others for each edge is
+ * the product of those before it times those after it, so it is O(dc)
+ * rather than a checkSP() for each edge.
+ * @param {CheckNode *} cn the check node, with the t of its edges set
+ */
+static inline void findResidual(CheckNode *cn) {
+	float t[LAYERS_MAX_NB];
+	float after[LAYERS_MAX_NB + 1];
+	int deg = 0;
+	for (QRNode *qr = cn->active; qr; qr = qr->nextActive) {
+		t[deg++] = qr->t;
+	}
+	after[deg] = 1.0;
+	for (int n = deg - 1; n >= 0; n--) {
+		after[n] = after[n + 1] * t[n];
+	}
+	float before = 1.0;
+	float residual = 0.0;
+	int n = 0;
+	for (QRNode *qr = cn->active; qr; qr = qr->nextActive, n++) {
+		qr->rNext = 2.0f * atanhCalc(before * after[n + 1]);
+		before *= t[n];
+		float d = fabsf(qr->rNext - qr->r);
+		if (d > residual) {
+			residual = d;
+		}
+	}
+	cn->residual = residual;
+}
+
+/**
+ * Row-layered message passing, one iteration.  Each layer is a QC block
+ * row, whose z check nodes share no variables, so they could all be run
+ * at once.  For each check node, the q of its edges are the posteriors
+ * less the old r, then the new r are added back into the posteriors,
+ * for the next layer to use.
  * @param {LdpcDecoder *} dec the decoder context
- * @param {float *} inBits message array of data from -1 -> 1
- * @param {int} nrBits the number of values in the array
+ * @param {CheckFunc} check the check node message function
+ * @param {int} start 1 on the first pass of a decode, to set the posteriors
+ */
+static void layeredPass(LdpcDecoder *dec, CheckFunc check, int start) {
+	int z = dec->code->z;
+	LayerSchedule *s = &dec->layers;
+	if (start) {
+		for (VariableNode *vnode = dec->activeVariables; vnode; vnode = vnode->nextActive) {
+			float post = vnode->ci;
+			for (Link *link = vnode->links; link; link = link->next) {
+				post += link->qr->r;
+			}
+			vnode->post = post;
+		}
+	}
+	for (int k = 0; k < s->nrLayers; k++) {
+		CheckNode **checks = dec->checks + s->order[k] * z;
+		for (int i = 0; i < z; i++) {
+			QRNode *qrNodes = checks[i]->active;
+			for (QRNode *qr = qrNodes; qr; qr = qr->nextActive) {
+				qr->q = qr->vnode->post - qr->r;
+			}
+			for (QRNode *qr = qrNodes; qr; qr = qr->nextActive) {
+				qr->r = check(qrNodes, qr);
+				qr->vnode->post = qr->q + qr->r;
+			}
+		}
+	}
+}
+
+/**
+ * Row-layered min-sum, one iteration, by the generated kernels of the
+ * code, on flat arrays of posteriors and messages.  The same, bit for bit,
+ * as layeredPass() with checkMS().  The posteriors are copied back into
+ * the variable nodes for step 4.
+ * @param {LdpcDecoder *} dec the decoder context
+ * @param {int} start 1 on the first pass of a decode, to clear the messages
+ */
+static void kernelPass(LdpcDecoder *dec, int start) {
+	LdpcKernel *kernel = dec->kernel;
+	LayerKernel *layers = ldpcKernelLayers(kernel);
+	LayerSchedule *s = &dec->layers;
+	float *post = dec->kernelPost;
+	if (start) {
+		for (VariableNode *vnode = dec->variableNodes; vnode; vnode = vnode->next) {
+			post[vnode->index] = vnode->ci;
+		}
+		memset(dec->kernelR, 0, kernel->nrEdges * sizeof(float));
+	}
+	for (int k = 0; k < s->nrLayers; k++) {
+		int layer = s->order[k];
+		layers[layer](post, dec->kernelR + kernel->offsets[layer]);
+	}
+	for (VariableNode *vnode = dec->variableNodes; vnode; vnode = vnode->next) {
+		vnode->post = post[vnode->index];
+	}
+}
+
+/**
+ * Round messages to the 16-bit format, and widen them back
+ */
+static inline void packMessages(uint16_t *out, float *in, int n, int bf16) {
+	if (bf16) {
+		bf16Pack(out, in, n);
+	} else {
+		halfPack(out, in, n);
+	}
+}
+
+static inline void unpackMessages(float *out, uint16_t *in, int n, int bf16) {
+	if (bf16) {
+		bf16Unpack(out, in, n);
+	} else {
+		halfUnpack(out, in, n);
+	}
+}
+
+/**
+ * New messages of a check node from the q of its edges, for halfPass().
+ * Min-sum takes min1, min2 and the signs in one pass, as compressedPass()
+ * does.  Sum-product takes the tanh of each q once, and multiplies those of
+ * the others for each edge in the same order as checkSP(), so the results
+ * are the same as theirs.
+ * @param {float *} q the q of the active edges
+ * @param {float *} r output for the new r of each
+ * @param {int} deg the number of active edges
+ * @param {int} minSum 1 for min-sum, 0 for sum-product
+ */
+static inline void rowMessages(float *q, float *r, int deg, int minSum) {
+	if (minSum) {
+		float min1 = 1000.0;
+		float min2 = 1000.0;
+		int minPos = -1;
+		uint32_t signs = 0;
+		for (int n = 0; n < deg; n++) {
+			float v = q[n];
+			v = v < -20.0 ? -20.0 : v > 20.0 ? 20.0 : v;
+			float mag = fabs(v);
+			if (v < 0.0) {
+				signs |= 1u << n;
+			}
+			if (mag < min1) {
+				min2 = min1;
+				min1 = mag;
+				minPos = n;
+			} else if (mag < min2) {
+				min2 = mag;
+			}
+		}
+		signs ^= __builtin_parity(signs) ? ~0u : 0u;
+		for (int n = 0; n < deg; n++) {
+			float mag = n == minPos ? min2 : min1;
+			r[n] = (signs >> n) & 1 ? -mag : mag;
+		}
+		return;
+	}
+	float t[LAYERS_MAX_NB];
+	for (int n = 0; n < deg; n++) {
+		float v = q[n];
+		v = v < -20.0 ? -20.0 : v > 20.0 ? 20.0 : v;
+		t[n] = tanhf(0.5f * v);
+	}
+	for (int n = 0; n < deg; n++) {
+		float prod = 1.0;
+		for (int m = 0; m < deg; m++) {
+			if (m != n) {
+				prod *= t[m];
+			}
+		}
+		r[n] = 2.0f * atanhCalc(prod);
+	}
+}
+
+/**
+ * Row-layered message passing, one iteration, as layeredPass(), but with
+ * the r kept in 16 bits in dec->halfMessages.  It does not walk the graph.
+ * As in compressedPass(), the posteriors are N flat floats, and the edges
+ * of a check node are found from the block columns and shifts of its layer.
+ * The r of a check node are a block in dec->halfMessages, by block column
+ * from left to right, in the order that ldpcDecoderSaveMessages() gives
+ * them.  They are widened to floats as the check node is worked on, and
+ * the new ones are rounded as they are stored.  The posteriors take the
+ * rounded r, so that the same value is taken out of them next time as
+ * went in.  The posteriors are copied back into the variable nodes for
+ * step 4.
+ * @param {LdpcDecoder *} dec the decoder context
+ * @param {int} minSum 1 for min-sum, 0 for sum-product
+ * @param {int} start 1 on the first pass of a decode, to clear the messages
+ */
+static void halfPass(LdpcDecoder *dec, int minSum, int start) {
+	Code *code = dec->code;
+	int z = code->z;
+	int nb = code->nb;
+	int pinStart = dec->pinStart;
+	int pinEnd = dec->pinEnd;
+	int bf16 = dec->messageFormat == LDPC_MESSAGES_BF16;
+	LayerSchedule *s = &dec->layers;
+	float *post = dec->kernelPost;
+	// where the block of the first check node of each layer starts
+	int offsets[LAYERS_MAX_MB];
+	int nrEdges = 0;
+	for (int layer = 0; layer < code->mb; layer++) {
+		offsets[layer] = nrEdges;
+		nrEdges += z * s->nrColumns[layer];
+	}
+	if (start) {
+		for (VariableNode *vnode = dec->activeVariables; vnode; vnode = vnode->nextActive) {
+			post[vnode->index] = vnode->ci;
+		}
+		// all bits 0 is +0 in both formats
+		memset(dec->halfMessages, 0, nrEdges * sizeof(uint16_t));
+	}
+	int rank[LAYERS_MAX_NB];
+	int base[LAYERS_MAX_NB];
+	int shift[LAYERS_MAX_NB];
+	int slot[LAYERS_MAX_NB];
+	int idx[LAYERS_MAX_NB];
+	int at[LAYERS_MAX_NB];
+	float q[LAYERS_MAX_NB];
+	float rNew[LAYERS_MAX_NB];
+	float r[LAYERS_MAX_NB];
+	for (int k = 0; k < s->nrLayers; k++) {
+		int layer = s->order[k];
+		int degree = columnRanks(code, layer, rank);
+		for (int e = 0; e < degree; e++) {
+			int j = s->columns[layer][e];
+			base[e] = j * z;
+			shift[e] = code->Hb[layer * nb + j];
+			slot[e] = rank[j];
+		}
+		uint16_t *half = dec->halfMessages + offsets[layer];
+		for (int i = 0; i < z; i++, half += degree) {
+			unpackMessages(r, half, degree, bf16);
+			// the q of the active edges, in the column order of the layer,
+			// with where each one's r is kept in the block
+			int deg = 0;
+			for (int e = 0; e < degree; e++) {
+				int col = i + shift[e];
+				int v = base[e] + (col < z ? col : col - z);
+				if (v < pinStart || v >= pinEnd) {
+					idx[deg] = v;
+					at[deg] = slot[e];
+					q[deg] = post[v] - r[slot[e]];
+					deg++;
+				}
+			}
+			rowMessages(q, rNew, deg, minSum);
+			for (int n = 0; n < deg; n++) {
+				r[at[n]] = rNew[n];
+			}
+			packMessages(half, r, degree, bf16);
+			unpackMessages(r, half, degree, bf16);
+			for (int n = 0; n < deg; n++) {
+				post[idx[n]] = q[n] + r[at[n]];
+			}
+		}
+	}
+	for (VariableNode *vnode = dec->activeVariables; vnode; vnode = vnode->nextActive) {
+		vnode->post = post[vnode->index];
+	}
+}
+
+/**
+ * Rebuild the min-sum message of edge k of a check node from its
+ * compressed form
+ */
+static inline float compressedR(CompressedCheck *cc, int k) {
+	float mag = k == cc->minPos ? cc->min2 : cc->min1;
+	uint32_t neg = __builtin_parity(cc->signs) ^ ((cc->signs >> k) & 1);
+	return neg ? -mag : mag;
+}
+
+/**
+ * Row-layered min-sum, one iteration, as layeredPass() with checkMS(), but
+ * with each check node's messages kept as min1, min2, the argmin and the
+ * signs, in dec->compressedChecks.  It does not walk the graph.  The
+ * posteriors are N flat floats, and the edges of a check node are found
+ * from the block columns and shifts of its layer, as the generated kernels
+ * find them.  The old r are rebuilt as the q are made, and the q are held
+ * only while the check node is worked on.  The results are the same, bit
+ * for bit, as for layeredPass().  The posteriors are copied back into the
+ * variable nodes for step 4.
+ * @param {LdpcDecoder *} dec the decoder context
+ * @param {int} start 1 on the first pass of a decode, to clear the messages
+ */
+static void compressedPass(LdpcDecoder *dec, int start) {
+	Code *code = dec->code;
+	int z = code->z;
+	int nb = code->nb;
+	int pinStart = dec->pinStart;
+	int pinEnd = dec->pinEnd;
+	LayerSchedule *s = &dec->layers;
+	float *post = dec->kernelPost;
+	if (start) {
+		for (VariableNode *vnode = dec->activeVariables; vnode; vnode = vnode->nextActive) {
+			post[vnode->index] = vnode->ci;
+		}
+		for (int c = 0; c < code->M; c++) {
+			CompressedCheck *cc = dec->compressedChecks + c;
+			cc->min1 = 0.0;
+			cc->min2 = 0.0;
+			cc->minPos = -1;
+			cc->signs = 0;
+		}
+	}
+	float q[LAYERS_MAX_NB];
+	int base[LAYERS_MAX_NB];
+	int shift[LAYERS_MAX_NB];
+	int idx[LAYERS_MAX_NB];
+	for (int k = 0; k < s->nrLayers; k++) {
+		int layer = s->order[k];
+		int degree = s->nrColumns[layer];
+		for (int e = 0; e < degree; e++) {
+			int j = s->columns[layer][e];
+			base[e] = j * z;
+			shift[e] = code->Hb[layer * nb + j];
+		}
+		CompressedCheck *cc = dec->compressedChecks + layer * z;
+		for (int i = 0; i < z; i++, cc++) {
+			// the posteriors of the active edges
+			int deg = 0;
+			for (int e = 0; e < degree; e++) {
+				int col = i + shift[e];
+				int v = base[e] + (col < z ? col : col - z);
+				if (v < pinStart || v >= pinEnd) {
+					idx[deg++] = v;
+				}
+			}
+			// the old messages, taken apart once rather than for each edge
+			float oldMin1 = cc->min1;
+			float oldMin2 = cc->min2;
+			int oldMinPos = cc->minPos;
+			uint32_t oldSigns = cc->signs ^ (__builtin_parity(cc->signs) ? ~0u : 0u);
+			float min1 = 1000.0;
+			float min2 = 1000.0;
+			int minPos = -1;
+			uint32_t signs = 0;
+			for (int n = 0; n < deg; n++) {
+				float r = n == oldMinPos ? oldMin2 : oldMin1;
+				float v = post[idx[n]] - ((oldSigns >> n) & 1 ? -r : r);
+				q[n] = v;
+				v = v < -20.0 ? -20.0 : v > 20.0 ? 20.0 : v;
+				float mag = fabs(v);
+				if (v < 0.0) {
+					signs |= 1u << n;
+				}
+				if (mag < min1) {
+					min2 = min1;
+					min1 = mag;
+					minPos = n;
+				} else if (mag < min2) {
+					min2 = mag;
+				}
+			}
+			cc->min1 = min1;
+			cc->min2 = min2;
+			cc->minPos = minPos;
+			cc->signs = signs;
+			signs ^= __builtin_parity(signs) ? ~0u : 0u;
+			for (int n = 0; n < deg; n++) {
+				float r = n == minPos ? min2 : min1;
+				post[idx[n]] = q[n] + ((signs >> n) & 1 ? -r : r);
+			}
+		}
+	}
+	for (VariableNode *vnode = dec->activeVariables; vnode; vnode = vnode->nextActive) {
+		vnode->post = post[vnode->index];
+	}
+}
+
+/**
+ * Copy out the check node messages of the last decode, from wherever it
+ * kept them.  Each goes to its place by the column of its edge, not by
+ * the order of the links, which ldpcDecoderSetLayers() changes.  The
+ * generated kernels keep those of a layer as a block of z for each of its
+ * block columns, from left to right.  halfPass() keeps them in the order
+ * that they are saved in.
+ */
+void ldpcDecoderSaveMessages(LdpcDecoder *dec, float *r) {
+	Code *code = dec->code;
+	int z = code->z;
+	int bf16 = dec->messageFormat == LDPC_MESSAGES_BF16;
+	float *out = r;
+	int rank[LAYERS_MAX_NB];
+	for (int c = 0; c < code->M; c++) {
+		CheckNode *cn = dec->checks[c];
+		int layer = c / z;
+		int deg = columnRanks(code, layer, rank);
+		int n = 0;
+		if (dec->messageStore == STORE_KERNEL) {
+			float *kr = dec->kernelR + dec->kernel->offsets[layer] + c % z;
+			for (QRNode *qr = cn->qrNodes; qr; qr = qr->next) {
+				int k = rank[qr->vnode->index / z];
+				r[k] = kr[k * z];
+			}
+		} else if (dec->messageStore == STORE_HALF) {
+			unpackMessages(r, dec->halfMessages + (r - out), deg, bf16);
+		} else if (dec->messageStore == STORE_COMPRESSED) {
+			for (QRNode *qr = cn->qrNodes; qr; qr = qr->next) {
+				r[rank[qr->vnode->index / z]] = qr->pinned ? qr->r :
+					compressedR(dec->compressedChecks + c, n++);
+			}
+		} else {
+			for (QRNode *qr = cn->qrNodes; qr; qr = qr->next) {
+				r[rank[qr->vnode->index / z]] = qr->r;
+			}
+		}
+		r += deg;
+	}
+}
+
+/**
+ * Residual belief propagation by sum-product, one iteration's worth of M
+ * check node updates.  Each takes the check node whose messages would
+ * change the most, sets them, and updates its variable nodes and their hard
+ * decisions.  Only the checks of those variables can have new residuals, so
+ * only they are worked out again, and moved in the heap.  It stops early
+ * once checkDone() has a verdict.
+ * @param {LdpcDecoder *} dec the decoder context
+ * @param {int} start 1 on the first pass of a decode, to fill the heap
+ * @return {int} the number of updates made.  0 if no message would change
+ */
+static int residualPass(LdpcDecoder *dec, int start) {
+	int M = dec->code->M;
+	CheckNode **heap = dec->heap;
+	if (start) {
+		dec->updates = 0;
+		for (VariableNode *vnode = dec->activeVariables; vnode; vnode = vnode->nextActive) {
+			updateTanh(vnode);
+		}
+		for (CheckNode *cn = dec->checkNodes; cn; cn = cn->next) {
+			findResidual(cn);
+		}
+		for (int i = M / 2 - 1; i >= 0; i--) {
+			heapDown(heap, M, i);
+		}
+	}
+	for (int n = 0; n < M; n++) {
+		CheckNode *cn = heap[0];
+		if (cn->residual <= 0.0) {
+			return n;
+		}
+		for (QRNode *qr = cn->active; qr; qr = qr->nextActive) {
+			qr->r = qr->rNext;
+		}
+		cn->residual = 0.0;
+		heapDown(heap, M, 0);
+		for (QRNode *qr = cn->active; qr; qr = qr->nextActive) {
+			VariableNode *vnode = qr->vnode;
+			updateQ(vnode, 0);
+			updateTanh(vnode);
+			float LQi = vnode->ci;
+			for (Link *link = vnode->links; link; link = link->next) {
+				LQi += link->qr->r;
+			}
+			setHard(dec, vnode->index, vnode->links, LQi < 0.0 ? 1 : 0);
+			for (Link *link = vnode->links; link; link = link->next) {
+				CheckNode *other = link->checkNode;
+				if (other != cn) {
+					float old = other->residual;
+					findResidual(other);
+					if (other->residual > old) {
+						heapUp(heap, other->heapPos);
+					} else {
+						heapDown(heap, M, other->heapPos);
+					}
+				}
+			}
+		}
+		dec->updates++;
+		if (checkDone(dec)) {
+			return n + 1;
+		}
+	}
+	return M;
+}
+
+/**
+ * Check that the options set on the decoder go together, for the decode
+ * about to be run.  A decode with options that do not is refused, rather
+ * than run with some of them left off.  16-bit messages are only kept
+ * under the row schedule, and compressed ones only for min-sum under it.
+ * Self-correction is of min-sum's q, which the row schedule does not keep.
+ * The residual schedule is for sum-product only: greedy min-sum fails more
+ * words than flooding min-sum once past the waterfall.
+ * @param {LdpcDecoder *} dec the decoder context
+ * @param {int} minSum 1 for min-sum, 0 for sum-product
+ * @return {int} 1 if they do, else 0, with dec->status LDPC_BAD_OPTIONS
+ */
+static int checkOptions(LdpcDecoder *dec, int minSum) {
+	int layered = dec->schedule == LDPC_SCHEDULE_ROW;
+	int ok = layered || dec->messageFormat == LDPC_MESSAGES_FP32;
+	ok = ok && (!dec->compressed || (layered && minSum));
+	ok = ok && (!dec->selfCorrect || (!layered && minSum));
+	ok = ok && !(dec->schedule == LDPC_SCHEDULE_RESIDUAL && minSum);
+	if (ok) {
+		return 1;
+	}
+	dec->iterations = 0;
+	dec->updates = 0;
+	dec->fastPath = 0;
+	dec->status = LDPC_BAD_OPTIONS;
+	return 0;
+}
+
+/**
+ * Decode codeword bits to message bits by the Sum-Product algorithm,
+ * over the active part of the graph
+ * @param {LdpcDecoder *} dec the decoder context
+ * @param {float *} inBits message array of N values from -1 -> 1
  * @param {int} maxIter the maximum number of iterations before failing
  * @return decoded array of bits if successful, else null
  */
-uint8_t *ldpcDecodeSP(LdpcDecoder *dec, float *inBits, int nrBits, int maxIter) {
+static uint8_t *decodeSP(LdpcDecoder *dec, float *inBits, int maxIter) {
 	// localize some values
 	Code *code = dec->code;
-	Table *table = dec->table;
 
-	int M = code->M;
 	int N = code->N;
-	int **H = table->H;
 	CheckNode *checkNodes = dec->checkNodes;
 	VariableNode *variableNodes = dec->variableNodes;
+	VariableNode *activeVariables = dec->activeVariables;
+	int layered = dec->schedule == LDPC_SCHEDULE_ROW;
+	// a warm start needs an r per edge
+	int half = layered && dec->messageFormat != LDPC_MESSAGES_FP32 && !dec->warmStart;
+
+	float *warmStart = dec->warmStart;
+	dec->warmStart = (float *)0;
+	if (!checkOptions(dec, 0)) {
+		return (uint8_t *)0;
+	}
 
 	/**
-	 * Step 1.  Initialization of c(ij) and q(ij)
+	 * Step 0.  If the hard decisions already pass, we are done
 	 */
 	float variance = 1.0;
 	float weight = 2.0 / variance;
+	int verdict = checkHard(dec, inBits);
+	if (verdict) {
+		softFromInput(dec, inBits, weight);
+		return verdict > 0 ? dec->syndrome : (uint8_t *)0;
+	}
+
+	/**
+	 * Step 1.  Initialization of c(ij) and q(ij)
+	 */
 	VariableNode *vnode = variableNodes;
 	for (int i = 0 ; i < N ; i++) {
 		float b = inBits[i];
@@ -275,91 +1314,135 @@ uint8_t *ldpcDecodeSP(LdpcDecoder *dec, float *inBits, int nrBits, int maxIter)
 		}
 		vnode = vnode->next;
 	}
+	if (warmStart) {
+		loadMessages(dec, warmStart);
+	}
+	dec->messageStore = half ? STORE_HALF : STORE_EDGES;
 
 
+	float *app = dec->appOut;
+	float *ext = dec->extOut;
+	int best = dec->unsatisfied;
+	int since = 0;
 	for (int iter = 0; iter < maxIter; iter++) {
 
 		/**
-		 * Step 2. update r(ji)
+		 * Steps 2 and 3.  Update r(ji), then q(ij)
 		 */
-		for (CheckNode *checkNode = checkNodes; checkNode; checkNode = checkNode->next) {
-			QRNode *qrNodes = checkNode->qrNodes;
-			for (QRNode *qr = qrNodes; qr; qr = qr->next) {
-				/**
-				 * Sum and product for qr != v
-				 */
-				float prod = 1.0;
-				for (QRNode *v = qrNodes; v; v = v->next) {
-					if (v == qr) {
-						continue;
-					}
-					float q = v->q;
-					q = q < -20.0 ? -20.0 : q > 20.0 ? 20.0 : q;
-					// prod = prod * tanhf(0.5f * q);
-					prod *= -atanhCalc(q);
+		if (half) {
+			halfPass(dec, 0, iter == 0);
+		} else if (dec->schedule == LDPC_SCHEDULE_ROW) {
+			layeredPass(dec, checkSP, iter == 0);
+		} else if (dec->schedule == LDPC_SCHEDULE_RESIDUAL) {
+			if (!residualPass(dec, iter == 0)) {
+				// no message would change, so none ever will
+				dec->iterations = iter + 1;
+				dec->status = LDPC_STALLED;
+				return (uint8_t *)0;
+			}
+		} else if (dec->schedule == LDPC_SCHEDULE_COLUMN) {
+			for (VariableNode *vnode = activeVariables; vnode; vnode = vnode->nextActive) {
+				for (Link *link = vnode->links; link; link = link->next) {
+					link->qr->r = checkSP(link->checkNode->active, link->qr);
 				}
-				qr->r = logf((1 + prod) / (1 - prod));
+				updateQ(vnode, 0);
 			}
-		}
-
-		/**
-		 * Step 3.  Update qij
-		 */
-		for (VariableNode *vnode = variableNodes; vnode; vnode = vnode->next) {
-			for (Link *link = vnode->links; link; link = link->next) {
-				float sum = 0.0;
-				for (Link *c = vnode->links; c; c = c->next) {
-					if (c != link) {
-						sum += c->qr->r;
-					}
+		} else {
+			for (CheckNode *checkNode = checkNodes; checkNode; checkNode = checkNode->next) {
+				QRNode *qrNodes = checkNode->active;
+				for (QRNode *qr = qrNodes; qr; qr = qr->nextActive) {
+					qr->r = checkSP(qrNodes, qr);
 				}
-				link->qr->q = vnode->ci + sum;
+			}
+			for (VariableNode *vnode = activeVariables; vnode; vnode = vnode->nextActive) {
+				updateQ(vnode, 0);
 			}
 		}
 
 		/**
-		 * Step 4.  Check syndrome
+		 * Step 4.  Check syndrome, by the flips of the hard decisions
 		 */
-		uint8_t *c = dec->syndrome;
-		int i = 0;
-		for (VariableNode *vnode = variableNodes; vnode; vnode = vnode->next, i++) {
+		for (VariableNode *vnode = activeVariables; vnode; vnode = vnode->nextActive) {
+			int i = vnode->index;
 			float sum = 0.0;
-			for (Link *link = vnode->links; link; link = link->next) {
-				sum += link->qr->r;
+			float LQi;
+			if (layered) {
+				LQi = vnode->post;
+				sum = LQi - vnode->ci;
+			} else {
+				for (Link *link = vnode->links; link; link = link->next) {
+					sum += link->qr->r;
+				}
+				LQi = vnode->ci + sum;
+			}
+			if (app) {
+				app[i] = LQi;
+			}
+			if (ext) {
+				ext[i] = sum;
 			}
-			float LQi = vnode->ci + sum;
-			c[i] = LQi < 0.0 ? 1 : 0;
+			setHard(dec, i, vnode->links, LQi < 0.0 ? 1 : 0);
 		}
-		if (checkFast(H, M, c)) {
-			printf("OK!! %d\n", iter);
-			return c;
-		} else {
-			// printf("iter %d\n", iter);
+		verdict = checkDone(dec);
+		if (verdict) {
+			dec->iterations = iter + 1;
+			return verdict > 0 ? dec->syndrome : (uint8_t *)0;
+		}
+		if (checkStall(dec, &best, &since)) {
+			dec->iterations = iter + 1;
+			dec->status = LDPC_STALLED;
+			return (uint8_t *)0;
 		}
 
 	} // for iter
 
+	if (maxIter <= 0) {
+		softFromInput(dec, inBits, weight);
+	}
+	dec->iterations = maxIter;
+	dec->status = LDPC_MAX_ITER;
 	return (uint8_t *)0;
 }
 
 
 /**
- * Decode codeword bits to message bits by the Min-Sum algorithm
+ * Decode codeword bits to message bits by the Min-Sum algorithm,
+ * or by self-corrected min-sum if dec->selfCorrect is set,
+ * over the active part of the graph
  * @param {LdpcDecoder *} dec the decoder context
- * @param {float *} inBits message array of data from -1 -> 1
- * @param {int} nrBits the number of values in the array
+ * @param {float *} inBits message array of N values from -1 -> 1
  * @param {int} maxIter the maximum number of iterations before failing
  * @return decoded array of bits if successful, else null
  */
-uint8_t *ldpcDecodeMS(LdpcDecoder *dec, float *inBits, int nrBits, int maxIter) {
+static uint8_t *decodeMS(LdpcDecoder *dec, float *inBits, int maxIter) {
 	// localize some values
 	Code *code = dec->code;
-	Table *table = dec->table;
-	int M = code->M;
 	int N = code->N;
-	int **H = table->H;
 	CheckNode *checkNodes = dec->checkNodes;
 	VariableNode *variableNodes = dec->variableNodes;
+	VariableNode *activeVariables = dec->activeVariables;
+	int selfCorrect = dec->selfCorrect;
+	int layered = dec->schedule == LDPC_SCHEDULE_ROW;
+	// a warm start needs an r per edge
+	int compressed = dec->compressed && !dec->warmStart;
+	int half = layered && dec->messageFormat != LDPC_MESSAGES_FP32 && !dec->warmStart;
+	int specialized = layered && dec->specialized && dec->kernel && !compressed &&
+		!half && dec->pinStart == dec->pinEnd && !dec->warmStart;
+
+	float *warmStart = dec->warmStart;
+	dec->warmStart = (float *)0;
+	if (!checkOptions(dec, 1)) {
+		return (uint8_t *)0;
+	}
+
+	/**
+	 * Step 0.  If the hard decisions already pass, we are done
+	 */
+	int verdict = checkHard(dec, inBits);
+	if (verdict) {
+		softFromInput(dec, inBits, 1.0f);
+		return verdict > 0 ? dec->syndrome : (uint8_t *)0;
+	}
 
 	/**
 	 * Step 1.  Initialization of c(ij) and q(ij)
@@ -377,77 +1460,350 @@ uint8_t *ldpcDecodeMS(LdpcDecoder *dec, float *inBits, int nrBits, int maxIter)
 		}
 		vnode = vnode->next;
 	}
+	if (warmStart) {
+		loadMessages(dec, warmStart);
+	}
+	dec->messageStore = compressed ? STORE_COMPRESSED : specialized ? STORE_KERNEL :
+		half ? STORE_HALF : STORE_EDGES;
 
 
+	float *app = dec->appOut;
+	float *ext = dec->extOut;
+	int best = dec->unsatisfied;
+	int since = 0;
 	for (int iter = 0; iter < maxIter; iter++) {
 
 		/**
-		 * Step 2. update r(ji)
+		 * Steps 2 and 3.  Update r(ji), then q(ij)
 		 */
-		for (CheckNode *checkNode = checkNodes; checkNode; checkNode = checkNode->next) {
-			QRNode *qrNodes = checkNode->qrNodes;
-			for (QRNode *qr = qrNodes; qr; qr = qr->next) {
-				/**
-				 * Sum and product for qr != v
-				 */
-				float prod = 1000.0;
-				for (QRNode *v = qrNodes; v; v = v->next) {
-					if (v == qr) {
-						continue;
-					}
-					float q = v->q;
-					q = q < -20.0 ? -20.0 : q > 20.0 ? 20.0 : q;
-					float absProd = fabs(prod);
-					float absQ = fabs(q);
-					float sgnQ = q < 0.0 ? -1.0 : 1.0;
-					float sgnProd = prod < 0 ? -1.0 : 1.0;
-					float min = absQ < absProd ? absQ : absProd;
-					prod = sgnQ * sgnProd * min;
+		if (compressed) {
+			compressedPass(dec, iter == 0);
+		} else if (specialized) {
+			kernelPass(dec, iter == 0);
+		} else if (half) {
+			halfPass(dec, 1, iter == 0);
+		} else if (dec->schedule == LDPC_SCHEDULE_ROW) {
+			layeredPass(dec, checkMS, iter == 0);
+		} else if (dec->schedule == LDPC_SCHEDULE_COLUMN) {
+			for (VariableNode *vnode = activeVariables; vnode; vnode = vnode->nextActive) {
+				for (Link *link = vnode->links; link; link = link->next) {
+					link->qr->r = checkMS(link->checkNode->active, link->qr);
 				}
-				qr->r = prod;
+				updateQ(vnode, selfCorrect);
 			}
-		}
-
-		/**
-		 * Step 3.  Update qij
-		 */
-		for (VariableNode *vnode = variableNodes; vnode; vnode = vnode->next) {
-			for (Link *link = vnode->links; link; link = link->next) {
-				float sum = 0.0;
-				for (Link *c = vnode->links; c; c = c->next) {
-					if (c != link) {
-						sum += c->qr->r;
-					}
+		} else {
+			for (CheckNode *checkNode = checkNodes; checkNode; checkNode = checkNode->next) {
+				QRNode *qrNodes = checkNode->active;
+				for (QRNode *qr = qrNodes; qr; qr = qr->nextActive) {
+					qr->r = checkMS(qrNodes, qr);
 				}
-				link->qr->q = vnode->ci + sum;
+			}
+			for (VariableNode *vnode = activeVariables; vnode; vnode = vnode->nextActive) {
+				updateQ(vnode, selfCorrect);
 			}
 		}
 
 		/**
-		 * Step 4.  Check syndrome
+		 * Step 4.  Check syndrome, by the flips of the hard decisions
 		 */
-		uint8_t *c = dec->syndrome;
-		int i = 0;
-		for (VariableNode *vnode = variableNodes; vnode; vnode = vnode->next, i++) {
+		for (VariableNode *vnode = activeVariables; vnode; vnode = vnode->nextActive) {
+			int i = vnode->index;
 			float sum = 0.0;
-			for (Link *link = vnode->links; link; link = link->next) {
-				sum += link->qr->r;
+			float LQi;
+			if (layered) {
+				// the layers keep the posterior up to date, even with no r per edge
+				LQi = vnode->post;
+				sum = LQi - vnode->ci;
+			} else {
+				for (Link *link = vnode->links; link; link = link->next) {
+					sum += link->qr->r;
+				}
+				LQi = vnode->ci + sum;
 			}
-			float LQi = vnode->ci + sum;
-			c[i] = LQi < 0.0 ? 1 : 0;
+			if (app) {
+				app[i] = LQi;
+			}
+			if (ext) {
+				ext[i] = sum;
+			}
+			setHard(dec, i, vnode->links, LQi < 0.0 ? 1 : 0);
 		}
-		if (checkFast(H, M, c)) {
-			printf("OK!! %d\n", iter);
-			return c;
-		} else {
-			// printf("ms iter %d\n", iter);
+		verdict = checkDone(dec);
+		if (verdict) {
+			dec->iterations = iter + 1;
+			return verdict > 0 ? dec->syndrome : (uint8_t *)0;
+		}
+		if (checkStall(dec, &best, &since)) {
+			dec->iterations = iter + 1;
+			dec->status = LDPC_STALLED;
+			return (uint8_t *)0;
 		}
 
 	} // for iter
 
+	if (maxIter <= 0) {
+		softFromInput(dec, inBits, 1.0f);
+	}
+	dec->iterations = maxIter;
+	dec->status = LDPC_MAX_ITER;
 	return (uint8_t *)0;
 }
 
+/**
+ * Decode codeword bits to message bits by the Sum-Product algorithm
+ */
+uint8_t *ldpcDecodeSP(LdpcDecoder *dec, float *inBits, int nrBits, int maxIter) {
+	setPinned(dec, 0, 0);
+	return decodeSP(dec, inBits, maxIter);
+}
+
+/**
+ * Decode codeword bits to message bits by the Min-Sum algorithm
+ */
+uint8_t *ldpcDecodeMS(LdpcDecoder *dec, float *inBits, int nrBits, int maxIter) {
+	setPinned(dec, 0, 0);
+	return decodeMS(dec, inBits, maxIter);
+}
+
+/**
+ * Expand a shortened word to N values, with the shortened bits as
+ * certain zeros, and pin them
+ * @return {float *} the expanded word, or null if nrShortened is too big
+ */
+static float *expandShortened(LdpcDecoder *dec, float *received, int nrShortened) {
+	Code *code = dec->code;
+	int end = code->messageBits;
+	int start = end - nrShortened;
+	if (nrShortened < 0 || start < 0) {
+		return (float *)0;
+	}
+	float *word = dec->expanded;
+	memcpy(word, received, start * sizeof(float));
+	for (int i = start; i < end; i++) {
+		word[i] = KNOWN_ZERO;
+	}
+	memcpy(word + end, received + start, (code->N - end) * sizeof(float));
+	setPinned(dec, start, end);
+	return word;
+}
+
+/**
+ * Decode a shortened word by sum-product
+ */
+uint8_t *ldpcDecodeShortenedSP(LdpcDecoder *dec, float *received, int nrShortened, int maxIter) {
+	float *word = expandShortened(dec, received, nrShortened);
+	if (!word) {
+		return (uint8_t *)0;
+	}
+	return decodeSP(dec, word, maxIter);
+}
+
+/**
+ * Decode a shortened word by min-sum
+ */
+uint8_t *ldpcDecodeShortenedMS(LdpcDecoder *dec, float *received, int nrShortened, int maxIter) {
+	float *word = expandShortened(dec, received, nrShortened);
+	if (!word) {
+		return (uint8_t *)0;
+	}
+	return decodeMS(dec, word, maxIter);
+}
+
+/**
+ * Decode by gradient descent bit flipping (GDBF).  With x the hard
+ * decisions as +1 for a 0 and -1 for a 1, y the input, and s(m) the
+ * checks as +1 when satisfied, the inversion function of bit i is
+ *     x(i)y(i) + sum over the checks m of i of s(m)
+ * and the bit with the lowest is flipped.  A flip changes the sign of the
+ * bit's own term, and of s(m) for each of its checks, which moves the
+ * function of every bit of those checks by 2.  So it is kept up to date
+ * by the H rows of the checks that change, using the columns in table->S.
+ */
+uint8_t *ldpcDecodeBF(LdpcDecoder *dec, float *inBits, int nrBits, int maxFlips) {
+	Code *code = dec->code;
+	Table *table = dec->table;
+	int N = code->N;
+	setPinned(dec, 0, 0);
+	dec->flips = 0;
+	int verdict = checkHard(dec, inBits);
+	if (verdict) {
+		return verdict > 0 ? dec->syndrome : (uint8_t *)0;
+	}
+
+	uint8_t *c = dec->syndrome;
+	uint8_t *parity = dec->parity;
+	float *metric = dec->flipMetric;
+	for (int i = 0; i < N; i++) {
+		float xy = c[i] ? -inBits[i] : inBits[i];
+		int *checks = table->S[i];
+		int sum = 0;
+		for (int j = 1; j <= checks[0]; j++) {
+			sum += parity[checks[j]] ? -1 : 1;
+		}
+		metric[i] = xy + sum;
+	}
+
+	for (int flip = 0; flip < maxFlips; flip++) {
+		int worst = 0;
+		for (int i = 1; i < N; i++) {
+			if (metric[i] < metric[worst]) {
+				worst = i;
+			}
+		}
+		c[worst] ^= 1;
+		flipCrc(dec, worst);
+		// x(i)y(i) changed sign, so moved by twice its new value
+		metric[worst] += 2.0f * (c[worst] ? -inBits[worst] : inBits[worst]);
+		int *checks = table->S[worst];
+		for (int j = 1; j <= checks[0]; j++) {
+			int check = checks[j];
+			parity[check] ^= 1;
+			dec->unsatisfied += parity[check] ? 1 : -1;
+			// s(m) went from +1 to -1 or back
+			float delta = parity[check] ? -2.0f : 2.0f;
+			int *row = table->H[check];
+			for (int k = 1; k <= row[0]; k++) {
+				metric[row[k]] += delta;
+			}
+		}
+		dec->flips = flip + 1;
+		verdict = checkDone(dec);
+		if (verdict) {
+			return verdict > 0 ? c : (uint8_t *)0;
+		}
+	}
+	dec->status = LDPC_MAX_ITER;
+	return (uint8_t *)0;
+}
+
+/**
+ * Run ordered statistics on the soft output of a failed decode, left in
+ * dec->osd->llr.  Its result is a codeword, but with a CRC set, it must
+ * pass that too.  A result from a search cut short by the budget is taken
+ * as any other: with no CRC set, it is accepted as it is.
+ * @return the bits if accepted, else null
+ */
+static uint8_t *decodeOsd(LdpcDecoder *dec) {
+	int N = dec->code->N;
+	uint8_t *bits = ldpcOsdDecode(dec->osd, dec->osd->llr, N);
+	if (!bits) {
+		return (uint8_t *)0;
+	}
+	memcpy(dec->syndrome, bits, N);
+	loadCrc(dec);
+	if (dec->crcPos && dec->crcCalc != dec->crcGiven) {
+		dec->status = LDPC_BAD_CRC;
+		return (uint8_t *)0;
+	}
+	dec->status = LDPC_OK;
+	return dec->syndrome;
+}
+
+/**
+ * Decode by the cheapest stage that works
+ */
+uint8_t *ldpcDecode(LdpcDecoder *dec, float *inBits, int nrBits, int maxIter) {
+	// before bit flipping, which would hide them on the words that it fixes
+	if (dec->bfFallback && !checkOptions(dec, 1)) {
+		dec->stage = LDPC_STAGE_FAILED;
+		dec->stageCounts[dec->stage]++;
+		return (uint8_t *)0;
+	}
+	uint8_t *bits = ldpcDecodeBF(dec, inBits, nrBits, dec->bfMaxFlips);
+	if (bits) {
+		dec->stage = dec->fastPath ? LDPC_STAGE_HARD : LDPC_STAGE_BF;
+	} else if (dec->bfFallback) {
+		// even from a codeword with a bad CRC, as min-sum starts again from
+		// the channel, and may come to the right one
+		float *app = dec->osd ? dec->osd->llr : (float *)0;
+		bits = ldpcDecodeSoftMS(dec, inBits, nrBits, maxIter, app, (float *)0);
+		dec->stage = bits ? LDPC_STAGE_MS : LDPC_STAGE_FAILED;
+		if (!bits && app) {
+			bits = decodeOsd(dec);
+			dec->stage = bits ? LDPC_STAGE_OSD : LDPC_STAGE_FAILED;
+		}
+	} else {
+		dec->stage = LDPC_STAGE_FAILED;
+	}
+	dec->stageCounts[dec->stage]++;
+	return bits;
+}
+
+/**
+ * Decode by sum-product, and give the soft output as well as the hard bits.
+ * The output is written by the decoder's own last pass over the variable
+ * nodes, so it costs nothing extra.
+ */
+uint8_t *ldpcDecodeSoftSP(LdpcDecoder *dec, float *inBits, int nrBits, int maxIter,
+		float *app, float *ext) {
+	dec->appOut = app;
+	dec->extOut = ext;
+	uint8_t *bits = ldpcDecodeSP(dec, inBits, nrBits, maxIter);
+	dec->appOut = (float *)0;
+	dec->extOut = (float *)0;
+	return bits;
+}
+
+/**
+ * Decode by min-sum, and give the soft output as well as the hard bits
+ */
+uint8_t *ldpcDecodeSoftMS(LdpcDecoder *dec, float *inBits, int nrBits, int maxIter,
+		float *app, float *ext) {
+	dec->appOut = app;
+	dec->extOut = ext;
+	uint8_t *bits = ldpcDecodeMS(dec, inBits, nrBits, maxIter);
+	dec->appOut = (float *)0;
+	dec->extOut = (float *)0;
+	return bits;
+}
+
+/**
+ * Expand a punctured or erased word to N values, with 0 for the
+ * bits that were not received
+ */
+float *ldpcDecoderExpand(LdpcDecoder *dec, float *received, int nrReceived, uint8_t *erased) {
+	int N = dec->code->N;
+	float *out = dec->expanded;
+	float *end = received + nrReceived;
+	for (int i = 0; i < N; i++) {
+		if (erased[i]) {
+			out[i] = 0.0f;
+		} else if (received < end) {
+			out[i] = *received++;
+		} else {
+			return (float *)0;
+		}
+	}
+	if (received != end) {
+		return (float *)0;
+	}
+	return out;
+}
+
+/**
+ * Decode a punctured word by sum-product
+ */
+uint8_t *ldpcDecodePuncturedSP(LdpcDecoder *dec, float *received, int nrReceived,
+		uint8_t *erased, int maxIter) {
+	float *word = ldpcDecoderExpand(dec, received, nrReceived, erased);
+	if (!word) {
+		return (uint8_t *)0;
+	}
+	return ldpcDecodeSP(dec, word, dec->code->N, maxIter);
+}
+
+/**
+ * Decode a punctured word by min-sum
+ */
+uint8_t *ldpcDecodePuncturedMS(LdpcDecoder *dec, float *received, int nrReceived,
+		uint8_t *erased, int maxIter) {
+	float *word = ldpcDecoderExpand(dec, received, nrReceived, erased);
+	if (!word) {
+		return (uint8_t *)0;
+	}
+	return ldpcDecodeMS(dec, word, dec->code->N, maxIter);
+}
+
 /**
  * Decode codeword bits into bytes. Assumes that codeword length is a multiple of 8
  * @param {LdpcDecoder} dec the decoder context
@@ -5,13 +5,13 @@
 
 #include "ldpcEncoder.h"
 #include "802-tables.h"
+#include "crc32.h"
 #include "util.h"
+#include "workers.h"
 
 
 void add(uint8_t *out, uint8_t *a, uint8_t *b, int len) {
-	while (len--) {
-		*out++ = *a++ ^ *b++;
-	}
+	xorBytes(out, a, b, len);
 }
 
 
@@ -33,26 +33,45 @@ LdpcEncoder *ldpcEncoderCreate(Code *code) {
 
 	enc->code = code;
 	enc->table = table;
+	enc->ownsTable = 1;
 	enc->msgLen = 0;
 	return enc;
 }
 
+/**
+ * Create a new encoder context with its own scratch buffers, sharing the
+ * read-only tables of another
+ */
+LdpcEncoder *ldpcEncoderClone(LdpcEncoder *enc) {
+	LdpcEncoder *clone = (LdpcEncoder *) malloc(sizeof(LdpcEncoder));
+	if (!clone) {
+		return (LdpcEncoder *)0;
+	}
+	clone->code = enc->code;
+	clone->table = enc->table;
+	clone->ownsTable = 0;
+	clone->msgLen = 0;
+	return clone;
+}
+
 void ldpcEncoderDestroy(LdpcEncoder *enc) {
 	if (!enc) {
 		return;
 	}
-	tableDestroy(enc->table);
+	if (enc->ownsTable) {
+		tableDestroy(enc->table);
+	}
 	free(enc);
 }
 
 
-static uint8_t *doEncode(LdpcEncoder *enc) {
+/**
+ * Steps 2 to 5, once Ast and Cst are known
+ */
+static uint8_t *encodeParity(LdpcEncoder *enc) {
 	Table *table = enc->table;
 	Code *code = enc->code;
 
-	// step 1
-	multiplySparse(enc->Ast, table->A, table->Alen, enc->x);
-	multiplySparse(enc->Cst, table->C, table->Clen, enc->x);
 	// step 2
 	substituteSparse(enc->TinvAst, table->T, table->Tlen, enc->Ast);
 	multiplySparse(enc->ETinvAst, table->E, table->Elen, enc->TinvAst);
@@ -77,6 +96,43 @@ static uint8_t *doEncode(LdpcEncoder *enc) {
 	return enc->x;
 }
 
+static uint8_t *doEncode(LdpcEncoder *enc) {
+	Code *code = enc->code;
+	int nb = code->nb;
+	int mb = code->mb;
+	int kb = code->kb;
+	int z = code->z;
+	// step 1, by rotating whole cells of Hb rather than by the rows of A and C
+	multiplyQc(enc->Ast, code->Hb, nb, 0, 0, kb, mb - 1, z, enc->x);
+	multiplyQc(enc->Cst, code->Hb, nb, 0, mb - 1, kb, 1, z, enc->x);
+	return encodeParity(enc);
+}
+
+/**
+ * Expand a message byte into x, and add its 1's into Ast and Cst by
+ * the columns of A and C, so that step 1 is done as the bits arrive
+ */
+static inline void addByte(LdpcEncoder *enc, uint8_t *x, uint8_t b, int col) {
+	Table *table = enc->table;
+	int Alen = table->Alen;
+	for (int shift = 7; shift >= 0; shift--, col++) {
+		int bit = (b >> shift) & 1;
+		*x++ = bit;
+		if (bit) {
+			int *rows = table->S[col];
+			int len = rows[0];
+			for (int j = 1; j <= len; j++) {
+				int r = rows[j];
+				if (r < Alen) {
+					enc->Ast[r] ^= 1;
+				} else {
+					enc->Cst[r - Alen] ^= 1;
+				}
+			}
+		}
+	}
+}
+
 /**
  * @param {array} s array of bits, size code->messageBits
  * @return {array} array of encoded bits, size N
@@ -88,8 +144,13 @@ uint8_t *ldpcEncode(LdpcEncoder *enc, uint8_t *s, int len) {
 		return (uint8_t *)0;
 	}
 	uint8_t *dest = enc->x;
-	while (len--) {
-		*dest++ = *s++;
+	int i = 0;
+	while (i < len) {
+		dest[i++] = *s++;
+	}
+	// zero the rest of the message, for shortening
+	while (i < messageBits) {
+		dest[i++] = 0;
 	}
 	return doEncode(enc);
 }
@@ -106,7 +167,135 @@ uint8_t *ldpcEncodeBytes(LdpcEncoder *enc, uint8_t *bytes, int nrBytes) {
 		return (uint8_t *)0;
 	}
 	bytesToBitsBE(enc->x, bytes, nrBytes);
+	// zero the rest of the message, for shortening
+	uint8_t *dest = enc->x + len;
+	while (len++ < messageBits) {
+		*dest++ = 0;
+	}
 	return doEncode(enc);
 }
 
+/**
+ * Encode a message array of bytes with its CRC32 appended, bigendian, in
+ * a single pass.  The CRC, the bit expansion and step 1 of the encoding
+ * are all done as each byte is read.
+ * @param {LdpcEncoder *} enc the encoder context
+ * @param {uint8_t *} bytes the message bytes, without the CRC
+ * @param {int} nrBytes the number of message bytes
+ * @param {uint8_t *} crcBytes output for the 4 CRC bytes, or null
+ * @return {array} array of encoded bits, size N
+ */
+uint8_t *ldpcEncodeBytesCrc(LdpcEncoder *enc, uint8_t *bytes, int nrBytes, uint8_t *crcBytes) {
+	Table *table = enc->table;
+	int messageBits = enc->code->messageBits;
+	int len = (nrBytes + 4) * 8;
+	if (len > messageBits) {
+		printf("message size too large: %d > %d", len, messageBits);
+		return (uint8_t *)0;
+	}
+	for (int i = 0; i < table->Alen; i++) {
+		enc->Ast[i] = 0;
+	}
+	for (int i = 0; i < table->Clen; i++) {
+		enc->Cst[i] = 0;
+	}
+	uint8_t *x = enc->x;
+	uint32_t crc = 0xffffffff;
+	int col = 0;
+	for (int i = 0; i < nrBytes; i++, col += 8) {
+		uint8_t b = bytes[i];
+		crc = Crc32Step(crc, b);
+		addByte(enc, x + col, b, col);
+	}
+	crc ^= 0xffffffff;
+	for (int shift = 24; shift >= 0; shift -= 8, col += 8) {
+		uint8_t b = (uint8_t)(crc >> shift);
+		if (crcBytes) {
+			*crcBytes++ = b;
+		}
+		addByte(enc, x + col, b, col);
+	}
+	// zero the rest of the message, for shortening
+	while (col < messageBits) {
+		x[col++] = 0;
+	}
+	return encodeParity(enc);
+}
+
+
+/**
+ * Shared state for the threads of one ldpcEncodeBatch() call
+ */
+typedef struct {
+	LdpcEncoder **encoders;
+	uint8_t *bytes;
+	int nrBytes;
+	uint8_t *out;
+	int outBytes;
+} EncodeBatch;
+
+static void encodeBatchSlice(void *ctx, int worker, int start, int end) {
+	EncodeBatch *batch = (EncodeBatch *) ctx;
+	LdpcEncoder *enc = batch->encoders[worker];
+	int N = enc->code->N;
+	int nrBytes = batch->nrBytes;
+	uint8_t *in = batch->bytes + (size_t) start * nrBytes;
+	uint8_t *out = batch->out + (size_t) start * batch->outBytes;
+	for (int i = start; i < end; i++) {
+		uint8_t *x = ldpcEncodeBytes(enc, in, nrBytes);
+		bitsToBytesBE(out, x, N);
+		in += nrBytes;
+		out += batch->outBytes;
+	}
+}
+
+/**
+ * Encode a buffer of messages, spreading the codewords across a number of
+ * threads.  Each thread gets its own clone of enc.
+ * @param {LdpcEncoder *} enc the encoder context
+ * @param {uint8_t *} bytes nrWords messages of nrBytes each, end to end
+ * @param {int} nrBytes the size of each message in bytes
+ * @param {int} nrWords the number of messages
+ * @param {uint8_t *} out output for nrWords packed codewords of N/8 bytes each
+ * @param {int} nrThreads the number of threads, <= 0 for one per processor
+ * @return {int} 1 if successful, else 0
+ */
+int ldpcEncodeBatch(LdpcEncoder *enc, uint8_t *bytes, int nrBytes, int nrWords,
+		uint8_t *out, int nrThreads) {
+	if (nrBytes * 8 > enc->code->messageBits) {
+		printf("message size too large: %d > %d", nrBytes * 8, enc->code->messageBits);
+		return 0;
+	}
+	if (nrWords <= 0) {
+		return 1;
+	}
+	if (nrThreads <= 0) {
+		nrThreads = workersCount();
+	}
+	if (nrThreads > nrWords) {
+		nrThreads = nrWords;
+	}
+	LdpcEncoder *encoders[nrThreads];
+	encoders[0] = enc;
+	for (int i = 1; i < nrThreads; i++) {
+		encoders[i] = ldpcEncoderClone(enc);
+		if (!encoders[i]) {
+			// fall back to the threads we already have
+			nrThreads = i;
+			break;
+		}
+	}
+	EncodeBatch batch;
+	batch.encoders = encoders;
+	batch.bytes = bytes;
+	batch.nrBytes = nrBytes;
+	batch.out = out;
+	batch.outBytes = enc->code->N / 8;
+	workersRun(encodeBatchSlice, &batch, nrWords, nrThreads);
+	for (int i = 1; i < nrThreads; i++) {
+		ldpcEncoderDestroy(encoders[i]);
+	}
+	return 1;
+}
+
 
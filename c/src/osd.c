@@ -0,0 +1,327 @@
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <time.h>
+
+#include "osd.h"
+
+#define DEFAULT_ORDER 2
+#define DEFAULT_MAX_CANDIDATES 4096
+
+// test patterns between looks at the clock
+#define CLOCK_EVERY 64
+
+/**
+ * Create a new ordered statistics decoder
+ */
+LdpcOsd *ldpcOsdCreate(Code *code) {
+	LdpcOsd *osd = (LdpcOsd *) calloc(1, sizeof(LdpcOsd));
+	if (!osd) {
+		return osd;
+	}
+	int N = code->N;
+	int M = code->M;
+	osd->code = code;
+	osd->order = DEFAULT_ORDER;
+	osd->maxCandidates = DEFAULT_MAX_CANDIDATES;
+	osd->budgetUs = 0;
+	osd->rowWords = (N + 63) / 64;
+	osd->colWords = (M + 63) / 64;
+	osd->table = tableCreate(code);
+	osd->llr = (float *) malloc(N * sizeof(float));
+	osd->rows = (uint64_t *) malloc(M * osd->rowWords * sizeof(uint64_t));
+	osd->rowPtr = (uint64_t **) malloc(M * sizeof(uint64_t *));
+	osd->pivots = (int *) malloc(M * sizeof(int));
+	osd->basis = (int *) malloc(N * sizeof(int));
+	osd->cols = (uint64_t *) malloc(N * osd->colWords * sizeof(uint64_t));
+	osd->base = (uint64_t *) malloc(osd->colWords * sizeof(uint64_t));
+	osd->diff = (uint64_t *) malloc(osd->colWords * sizeof(uint64_t));
+	osd->rel = (float *) malloc(N * sizeof(float));
+	osd->hard = (uint8_t *) malloc(N * sizeof(uint8_t));
+	osd->sorted = (OsdBit *) malloc(N * sizeof(OsdBit));
+	osd->out = (uint8_t *) malloc(N * sizeof(uint8_t));
+	if (!osd->table || !osd->llr || !osd->rows || !osd->rowPtr || !osd->pivots ||
+			!osd->basis || !osd->cols || !osd->base || !osd->diff || !osd->rel ||
+			!osd->hard || !osd->sorted || !osd->out) {
+		ldpcOsdDestroy(osd);
+		return (LdpcOsd *)0;
+	}
+	return osd;
+}
+
+/**
+ * Clean up an ordered statistics decoder
+ */
+void ldpcOsdDestroy(LdpcOsd *osd) {
+	if (!osd) {
+		return;
+	}
+	if (osd->table) {
+		tableDestroy(osd->table);
+	}
+	free(osd->llr);
+	free(osd->rows);
+	free(osd->rowPtr);
+	free(osd->pivots);
+	free(osd->basis);
+	free(osd->cols);
+	free(osd->base);
+	free(osd->diff);
+	free(osd->rel);
+	free(osd->hard);
+	free(osd->sorted);
+	free(osd->out);
+	free(osd);
+}
+
+static int compareBits(const void *a, const void *b) {
+	float x = ((const OsdBit *)a)->rel;
+	float y = ((const OsdBit *)b)->rel;
+	return x < y ? -1 : x > y ? 1 : 0;
+}
+
+/**
+ * Thread CPU time in microseconds, so that time spent waiting on
+ * higher priority threads does not count against the budget
+ */
+static long long cpuMicros(void) {
+	struct timespec ts;
+	clock_gettime(CLOCK_THREAD_CPUTIME_ID, &ts);
+	return (long long)ts.tv_sec * 1000000LL + ts.tv_nsec / 1000;
+}
+
+static int overBudget(LdpcOsd *osd, long long start) {
+	if (osd->budgetUs > 0 && cpuMicros() - start > osd->budgetUs) {
+		osd->timedOut = 1;
+		return 1;
+	}
+	return 0;
+}
+
+static inline int getBit(uint64_t *row, int i) {
+	return (row[i >> 6] >> (i & 63)) & 1;
+}
+
+/**
+ * Reduce H by Gaussian elimination, taking pivots on the least reliable
+ * columns first.  The columns left over make up the most reliable basis.
+ */
+static void reduce(LdpcOsd *osd) {
+	int M = osd->code->M;
+	int N = osd->code->N;
+	int words = osd->rowWords;
+	Table *table = osd->table;
+	memset(osd->rows, 0, M * words * sizeof(uint64_t));
+	for (int r = 0; r < M; r++) {
+		uint64_t *row = osd->rows + r * words;
+		int *cols = table->H[r];
+		for (int j = 1; j <= cols[0]; j++) {
+			row[cols[j] >> 6] |= 1ULL << (cols[j] & 63);
+		}
+		osd->rowPtr[r] = row;
+	}
+
+	uint64_t **rowPtr = osd->rowPtr;
+	int rank = 0;
+	int nrBasis = 0;
+	for (int k = 0; k < N; k++) {
+		int col = osd->sorted[k].index;
+		int found = -1;
+		if (rank < M) {
+			for (int r = rank; r < M; r++) {
+				if (getBit(rowPtr[r], col)) {
+					found = r;
+					break;
+				}
+			}
+		}
+		if (found < 0) {
+			osd->basis[nrBasis++] = col;
+			continue;
+		}
+		uint64_t *pivot = rowPtr[found];
+		rowPtr[found] = rowPtr[rank];
+		rowPtr[rank] = pivot;
+		for (int r = 0; r < M; r++) {
+			uint64_t *row = rowPtr[r];
+			if (r != rank && getBit(row, col)) {
+				for (int w = 0; w < words; w++) {
+					row[w] ^= pivot[w];
+				}
+			}
+		}
+		osd->pivots[rank++] = col;
+	}
+	osd->rank = rank;
+	osd->nrBasis = nrBasis;
+
+	// the pivots that each basis bit feeds
+	int colWords = osd->colWords;
+	memset(osd->cols, 0, nrBasis * colWords * sizeof(uint64_t));
+	for (int r = 0; r < rank; r++) {
+		uint64_t *row = rowPtr[r];
+		for (int t = 0; t < nrBasis; t++) {
+			if (getBit(row, osd->basis[t])) {
+				osd->cols[t * colWords + (r >> 6)] |= 1ULL << (r & 63);
+			}
+		}
+	}
+}
+
+/**
+ * Sum the reliabilities of the pivots that differ from the hard decisions,
+ * stopping once the sum passes the bound
+ */
+static float pivotCost(LdpcOsd *osd, uint64_t *diff, float bound) {
+	float cost = 0.0f;
+	for (int w = 0; w < osd->colWords; w++) {
+		uint64_t bits = diff[w];
+		while (bits) {
+			int r = (w << 6) + __builtin_ctzll(bits);
+			bits &= bits - 1;
+			cost += osd->rel[osd->pivots[r]];
+		}
+		if (cost >= bound) {
+			break;
+		}
+	}
+	return cost;
+}
+
+/**
+ * Flip basis bit t1, and t2 if it is not -1, and find the cost of the
+ * codeword that results, as far as the bound
+ */
+static float tryPattern(LdpcOsd *osd, int t1, int t2, float bound) {
+	int colWords = osd->colWords;
+	float cost = osd->rel[osd->basis[t1]];
+	if (t2 >= 0) {
+		cost += osd->rel[osd->basis[t2]];
+	}
+	if (cost >= bound) {
+		return cost;
+	}
+	uint64_t *base = osd->base;
+	uint64_t *diff = osd->diff;
+	uint64_t *col1 = osd->cols + t1 * colWords;
+	if (t2 < 0) {
+		for (int w = 0; w < colWords; w++) {
+			diff[w] = base[w] ^ col1[w];
+		}
+	} else {
+		uint64_t *col2 = osd->cols + t2 * colWords;
+		for (int w = 0; w < colWords; w++) {
+			diff[w] = base[w] ^ col1[w] ^ col2[w];
+		}
+	}
+	return cost + pivotCost(osd, diff, bound - cost);
+}
+
+/**
+ * Find the nearest codeword within the test patterns allowed
+ */
+uint8_t *ldpcOsdDecode(LdpcOsd *osd, float *llr, int nrBits) {
+	int N = osd->code->N;
+	if (nrBits != N) {
+		return (uint8_t *)0;
+	}
+	long long start = cpuMicros();
+	osd->candidates = 0;
+	osd->timedOut = 0;
+	for (int i = 0; i < N; i++) {
+		osd->hard[i] = llr[i] < 0.0f ? 1 : 0;
+		osd->rel[i] = fabsf(llr[i]);
+		osd->sorted[i].rel = osd->rel[i];
+		osd->sorted[i].index = i;
+	}
+	qsort(osd->sorted, N, sizeof(OsdBit), compareBits);
+	reduce(osd);
+	if (overBudget(osd, start)) {
+		return (uint8_t *)0;
+	}
+
+	/**
+	 * Order 0.  The basis as hard decided, and where its pivots
+	 * differ from the hard decisions
+	 */
+	int colWords = osd->colWords;
+	uint64_t *base = osd->base;
+	uint64_t *diff = osd->diff;
+	int *basis = osd->basis;
+	int nrBasis = osd->nrBasis;
+	memset(base, 0, colWords * sizeof(uint64_t));
+	for (int t = 0; t < nrBasis; t++) {
+		if (osd->hard[basis[t]]) {
+			uint64_t *col = osd->cols + t * colWords;
+			for (int w = 0; w < colWords; w++) {
+				base[w] ^= col[w];
+			}
+		}
+	}
+	for (int r = 0; r < osd->rank; r++) {
+		if (osd->hard[osd->pivots[r]]) {
+			base[r >> 6] ^= 1ULL << (r & 63);
+		}
+	}
+	float best = pivotCost(osd, base, INFINITY);
+	int best1 = -1;
+	int best2 = -1;
+	osd->candidates = 1;
+
+	/**
+	 * Orders 1, then 2.  The least reliable basis bits come first, as the
+	 * most likely to be wrong, and pairs go by the sum of their ranks
+	 */
+	int maxCandidates = osd->maxCandidates;
+	int order = osd->order < nrBasis ? osd->order : nrBasis;
+	for (int k = 1; k <= order; k++) {
+		int last = k == 1 ? nrBasis - 1 : 2 * nrBasis - 3;
+		for (int sum = k - 1; sum <= last; sum++) {
+			int lo = k == 1 ? sum : sum - (nrBasis - 1) > 0 ? sum - (nrBasis - 1) : 0;
+			int hi = k == 1 ? sum : (sum - 1) / 2;
+			for (int t1 = lo; t1 <= hi; t1++) {
+				if (maxCandidates > 0 && osd->candidates >= maxCandidates) {
+					goto build;
+				}
+				if (osd->candidates % CLOCK_EVERY == 0 && overBudget(osd, start)) {
+					goto build;
+				}
+				int t2 = k == 1 ? -1 : sum - t1;
+				osd->candidates++;
+				float cost = tryPattern(osd, t1, t2, best);
+				if (cost < best) {
+					best = cost;
+					best1 = t1;
+					best2 = t2;
+				}
+			}
+		}
+	}
+
+build:
+	/**
+	 * Build the codeword from the best pattern
+	 */
+	uint8_t *out = osd->out;
+	memcpy(out, osd->hard, N);
+	memcpy(diff, base, colWords * sizeof(uint64_t));
+	int flips[2] = { best1, best2 };
+	for (int f = 0; f < 2; f++) {
+		int t = flips[f];
+		if (t < 0) {
+			continue;
+		}
+		out[basis[t]] ^= 1;
+		uint64_t *col = osd->cols + t * colWords;
+		for (int w = 0; w < colWords; w++) {
+			diff[w] ^= col[w];
+		}
+	}
+	for (int r = 0; r < osd->rank; r++) {
+		if (getBit(diff, r)) {
+			out[osd->pivots[r]] ^= 1;
+		}
+	}
+	osd->discrepancy = best;
+	return out;
+}
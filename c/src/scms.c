@@ -0,0 +1,114 @@
+#include "scms.h"
+#include "isa.h"
+
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+#ifdef ISA_X86
+#include <immintrin.h>
+#endif
+
+
+/**
+ * The posterior, summed in edge order for both forms
+ */
+static inline float posterior(float ci, float *r, int n) {
+	float sum = ci;
+	for (int k = 0; k < n; k++) {
+		sum += r[k];
+	}
+	return sum;
+}
+
+static inline float correctOne(float total, float r, float old) {
+	float q = total - r;
+	if (old != 0.0f && (q < 0.0f) != (old < 0.0f)) {
+		q = 0.0f;
+	}
+	return q;
+}
+
+/**
+ * scmsUpdate() one edge at a time
+ */
+float scmsUpdateScalar(float ci, float *r, float *q, int n) {
+	float total = posterior(ci, r, n);
+	for (int k = 0; k < n; k++) {
+		q[k] = correctOne(total, r[k], q[k]);
+	}
+	return total;
+}
+
+/**
+ * scmsUpdate() four edges at a time
+ */
+float scmsUpdateVector(float ci, float *r, float *q, int n) {
+#ifdef __SSE2__
+	float total = posterior(ci, r, n);
+	__m128 vTotal = _mm_set1_ps(total);
+	__m128 zero = _mm_setzero_ps();
+	int k = 0;
+	for (; k + 4 <= n; k += 4) {
+		__m128 old = _mm_loadu_ps(q + k);
+		__m128 next = _mm_sub_ps(vTotal, _mm_loadu_ps(r + k));
+		__m128 flipped = _mm_xor_ps(_mm_cmplt_ps(next, zero), _mm_cmplt_ps(old, zero));
+		__m128 erase = _mm_and_ps(flipped, _mm_cmpneq_ps(old, zero));
+		_mm_storeu_ps(q + k, _mm_andnot_ps(erase, next));
+	}
+	for (; k < n; k++) {
+		q[k] = correctOne(total, r[k], q[k]);
+	}
+	return total;
+#else
+	return scmsUpdateScalar(ci, r, q, n);
+#endif
+}
+
+#ifdef ISA_X86
+__attribute__((target("avx2")))
+static float updateAvx2(float ci, float *r, float *q, int n) {
+	float total = posterior(ci, r, n);
+	__m256 vTotal = _mm256_set1_ps(total);
+	__m256 zero = _mm256_setzero_ps();
+	int k = 0;
+	for (; k + 8 <= n; k += 8) {
+		__m256 old = _mm256_loadu_ps(q + k);
+		__m256 next = _mm256_sub_ps(vTotal, _mm256_loadu_ps(r + k));
+		__m256 flipped = _mm256_xor_ps(_mm256_cmp_ps(next, zero, _CMP_LT_OS),
+			_mm256_cmp_ps(old, zero, _CMP_LT_OS));
+		__m256 erase = _mm256_and_ps(flipped, _mm256_cmp_ps(old, zero, _CMP_NEQ_UQ));
+		_mm256_storeu_ps(q + k, _mm256_andnot_ps(erase, next));
+	}
+	for (; k < n; k++) {
+		q[k] = correctOne(total, r[k], q[k]);
+	}
+	return total;
+}
+#endif
+
+/**
+ * scmsUpdate() eight edges at a time
+ */
+float scmsUpdateAvx2(float ci, float *r, float *q, int n) {
+#ifdef ISA_X86
+	if (isaLevel() >= ISA_AVX2) {
+		return updateAvx2(ci, r, q, n);
+	}
+#endif
+	return scmsUpdateVector(ci, r, q, n);
+}
+
+/**
+ * Self-corrected min-sum update of the messages out of one variable node,
+ * by the best form that isaLevel() allows
+ */
+float scmsUpdate(float ci, float *r, float *q, int n) {
+	IsaLevel level = isaLevel();
+	if (level >= ISA_AVX2) {
+		return scmsUpdateAvx2(ci, r, q, n);
+	}
+	if (level >= ISA_SSE42) {
+		return scmsUpdateVector(ci, r, q, n);
+	}
+	return scmsUpdateScalar(ci, r, q, n);
+}
@@ -0,0 +1,130 @@
+#include <stdlib.h>
+#include <string.h>
+
+#include "scrambler.h"
+
+
+/**
+ * Reverse the bits within each byte of a word
+ */
+static inline uint64_t reverseBytes(uint64_t x) {
+	x = ((x >> 1) & 0x5555555555555555ULL) | ((x & 0x5555555555555555ULL) << 1);
+	x = ((x >> 2) & 0x3333333333333333ULL) | ((x & 0x3333333333333333ULL) << 2);
+	x = ((x >> 4) & 0x0f0f0f0f0f0f0f0fULL) | ((x & 0x0f0f0f0f0f0f0f0fULL) << 4);
+	return x;
+}
+
+/**
+ * Run the shift register for 8 periods, and pack the output
+ * into bytes, first bit in the MSB
+ */
+static void generateMasks(Scrambler *s) {
+	int x[7];
+	// x[0] is x7, x[3] is x4
+	for (int i = 0; i < 7; i++) {
+		x[i] = (s->seed >> i) & 1;
+	}
+	for (int i = 0; i < 127; i++) {
+		uint8_t b = 0;
+		for (int j = 0; j < 8; j++) {
+			int out = x[0] ^ x[3];
+			for (int k = 0; k < 6; k++) {
+				x[k] = x[k + 1];
+			}
+			x[6] = out;
+			b = (b << 1) | out;
+		}
+		s->txMask[i] = b;
+	}
+	memcpy(s->txMask + 127, s->txMask, 8);
+	for (int i = 0; i < 127 + 8; i++) {
+		s->rxMask[i] = (uint8_t) reverseBytes(s->txMask[i]);
+	}
+}
+
+/**
+ * Create a new scrambler
+ */
+Scrambler *scramblerCreate(int seed) {
+	if (seed < 1 || seed > 127) {
+		return (Scrambler *)0;
+	}
+	Scrambler *s = (Scrambler *) malloc(sizeof(Scrambler));
+	if (!s) {
+		return (Scrambler *)0;
+	}
+	s->seed = seed;
+	s->pos = 0;
+	generateMasks(s);
+	return s;
+}
+
+/**
+ * Clean up a scrambler
+ */
+void scramblerDestroy(Scrambler *s) {
+	if (s) {
+		free(s);
+	}
+}
+
+/**
+ * Start the sequence over from the seed
+ */
+void scramblerReset(Scrambler *s) {
+	s->pos = 0;
+}
+
+/**
+ * Move the sequence along without scrambling anything
+ */
+void scramblerSkip(Scrambler *s, int len) {
+	s->pos = (s->pos + len) % 127;
+}
+
+/**
+ * Both directions are a byte reversal and an XOR, 8 bytes at a time.
+ * Only the order differs, which is covered by using the reversed mask
+ * on receive: rev(in ^ m) == rev(in) ^ rev(m)
+ */
+static void apply(Scrambler *s, uint8_t *mask, uint8_t *out, uint8_t *in, int len) {
+	int pos = s->pos;
+	uint64_t w;
+	uint64_t m;
+	while (len >= 8) {
+		memcpy(&w, in, 8);
+		memcpy(&m, mask + pos, 8);
+		w = reverseBytes(w) ^ m;
+		memcpy(out, &w, 8);
+		in += 8;
+		out += 8;
+		len -= 8;
+		pos += 8;
+		if (pos >= 127) {
+			pos -= 127;
+		}
+	}
+	if (len) {
+		w = 0;
+		memcpy(&w, in, len);
+		memcpy(&m, mask + pos, 8);
+		w = reverseBytes(w) ^ m;
+		memcpy(out, &w, len);
+		pos = (pos + len) % 127;
+	}
+	s->pos = pos;
+}
+
+/**
+ * Scramble bytes for transmission
+ */
+void scramblerScramble(Scrambler *s, uint8_t *out, uint8_t *in, int len) {
+	apply(s, s->txMask, out, in, len);
+}
+
+/**
+ * Undo scramblerScramble() on received bytes
+ */
+void scramblerDescramble(Scrambler *s, uint8_t *out, uint8_t *in, int len) {
+	apply(s, s->rxMask, out, in, len);
+}
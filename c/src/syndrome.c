@@ -0,0 +1,252 @@
+#include <stdint.h>
+#include <string.h>
+
+#include "syndrome.h"
+#include "isa.h"
+
+#ifdef ISA_X86
+#include <immintrin.h>
+#endif
+
+
+/**
+ * Rotate a z-bit word right by s.  Row i of a cell with shift s has its 1
+ * in column (i + s) % z, so this lines up the cell's columns with its rows.
+ */
+static inline QcWord rotate(QcWord x, int s, int z, QcWord mask) {
+	if (!s) {
+		return x;
+	}
+	return ((x >> s) | (x << (z - s))) & mask;
+}
+
+static inline int popcount(QcWord x) {
+	return __builtin_popcountll((uint64_t) x) +
+		__builtin_popcountll((uint64_t)(x >> 64));
+}
+
+/**
+ * Pack an array of hard bits into one word per block column
+ */
+void syndromePack(QcWord *words, Code *code, uint8_t *bits) {
+	int z = code->z;
+	int nb = code->nb;
+	for (int c = 0; c < nb; c++) {
+		QcWord w = 0;
+		for (int k = z - 1; k >= 0; k--) {
+			w = (w << 1) | bits[k];
+		}
+		words[c] = w;
+		bits += z;
+	}
+}
+
+/**
+ * Slice values k to z of one block column, one at a time, into w
+ */
+static inline QcWord sliceRest(QcWord w, float *soft, uint8_t *bits, int k, int z) {
+	for (; k < z; k++) {
+		uint8_t bit = soft[k] < 0.0f ? 1 : 0;
+		if (bits) {
+			bits[k] = bit;
+		}
+		w |= (QcWord) bit << k;
+	}
+	return w;
+}
+
+static void packSoftGeneric(QcWord *words, Code *code, float *soft, uint8_t *bits) {
+	int z = code->z;
+	int nb = code->nb;
+	for (int c = 0; c < nb; c++) {
+		words[c] = sliceRest(0, soft, bits, 0, z);
+		soft += z;
+		if (bits) {
+			bits += z;
+		}
+	}
+}
+
+#ifdef ISA_X86
+/**
+ * Four values at a time, by their sign masks
+ */
+__attribute__((target("sse4.2")))
+static void packSoftSse42(QcWord *words, Code *code, float *soft, uint8_t *bits) {
+	int z = code->z;
+	int nb = code->nb;
+	__m128 zero = _mm_setzero_ps();
+	for (int c = 0; c < nb; c++) {
+		QcWord w = 0;
+		int k = 0;
+		for (; k + 4 <= z; k += 4) {
+			uint32_t m = _mm_movemask_ps(_mm_cmplt_ps(_mm_loadu_ps(soft + k), zero));
+			w |= (QcWord) m << k;
+			if (bits) {
+				uint32_t spread = (m & 1) | ((m & 2) << 7) | ((m & 4) << 14) | ((m & 8) << 21);
+				memcpy(bits + k, &spread, 4);
+			}
+		}
+		words[c] = sliceRest(w, soft, bits, k, z);
+		soft += z;
+		if (bits) {
+			bits += z;
+		}
+	}
+}
+
+/**
+ * Eight values at a time, with the bits spread to bytes by BMI2
+ */
+__attribute__((target("avx2,bmi2")))
+static void packSoftAvx2(QcWord *words, Code *code, float *soft, uint8_t *bits) {
+	int z = code->z;
+	int nb = code->nb;
+	__m256 zero = _mm256_setzero_ps();
+	for (int c = 0; c < nb; c++) {
+		QcWord w = 0;
+		int k = 0;
+		for (; k + 8 <= z; k += 8) {
+			__m256 lt = _mm256_cmp_ps(_mm256_loadu_ps(soft + k), zero, _CMP_LT_OQ);
+			uint32_t m = _mm256_movemask_ps(lt);
+			w |= (QcWord) m << k;
+			if (bits) {
+				uint64_t spread = _pdep_u64(m, 0x0101010101010101ULL);
+				memcpy(bits + k, &spread, 8);
+			}
+		}
+		words[c] = sliceRest(w, soft, bits, k, z);
+		soft += z;
+		if (bits) {
+			bits += z;
+		}
+	}
+}
+
+/**
+ * Sixteen values at a time, by compare to a mask
+ */
+__attribute__((target("avx512f,avx512bw,avx512vl")))
+static void packSoftAvx512(QcWord *words, Code *code, float *soft, uint8_t *bits) {
+	int z = code->z;
+	int nb = code->nb;
+	__m512 zero = _mm512_setzero_ps();
+	__m128i one = _mm_set1_epi8(1);
+	for (int c = 0; c < nb; c++) {
+		QcWord w = 0;
+		int k = 0;
+		for (; k + 16 <= z; k += 16) {
+			__mmask16 m = _mm512_cmp_ps_mask(_mm512_loadu_ps(soft + k), zero, _CMP_LT_OQ);
+			w |= (QcWord) m << k;
+			if (bits) {
+				_mm_storeu_si128((__m128i *)(bits + k), _mm_maskz_mov_epi8(m, one));
+			}
+		}
+		words[c] = sliceRest(w, soft, bits, k, z);
+		soft += z;
+		if (bits) {
+			bits += z;
+		}
+	}
+}
+#endif
+
+/**
+ * Slice soft values to hard bits, and pack them, by the best form that
+ * isaLevel() allows
+ */
+void syndromePackSoft(QcWord *words, Code *code, float *soft, uint8_t *bits) {
+#ifdef ISA_X86
+	IsaLevel level = isaLevel();
+	if (level >= ISA_AVX512) {
+		packSoftAvx512(words, code, soft, bits);
+		return;
+	}
+	if (level >= ISA_AVX2) {
+		packSoftAvx2(words, code, soft, bits);
+		return;
+	}
+	if (level >= ISA_SSE42) {
+		packSoftSse42(words, code, soft, bits);
+		return;
+	}
+#endif
+	packSoftGeneric(words, code, soft, bits);
+}
+
+/**
+ * Get the syndrome of one block row, bit i for row i of the block
+ */
+static inline QcWord blockRow(Code *code, QcWord *words, int r, QcWord mask) {
+	int z = code->z;
+	int nb = code->nb;
+	int *row = code->Hb + r * nb;
+	QcWord s = 0;
+	for (int c = 0; c < nb; c++) {
+		int rot = row[c];
+		if (rot >= 0) {
+			s ^= rotate(words[c], rot % z, z, mask);
+		}
+	}
+	return s;
+}
+
+/**
+ * Check a packed word against H, a whole block row at a time
+ */
+int syndromeCheck(Code *code, QcWord *words) {
+	QcWord mask = ((QcWord) 1 << code->z) - 1;
+	for (int r = 0; r < code->mb; r++) {
+		if (blockRow(code, words, r, mask)) {
+			return 0;
+		}
+	}
+	return 1;
+}
+
+/**
+ * Count the unsatisfied checks of a packed word
+ */
+int syndromeCount(Code *code, QcWord *words) {
+	QcWord mask = ((QcWord) 1 << code->z) - 1;
+	int count = 0;
+	for (int r = 0; r < code->mb; r++) {
+		count += popcount(blockRow(code, words, r, mask));
+	}
+	return count;
+}
+
+/**
+ * Get the parity of every check of a packed word
+ */
+int syndromeRows(Code *code, QcWord *words, uint8_t *parity) {
+	int z = code->z;
+	QcWord mask = ((QcWord) 1 << z) - 1;
+	int count = 0;
+	for (int r = 0; r < code->mb; r++) {
+		QcWord s = blockRow(code, words, r, mask);
+		count += popcount(s);
+		for (int i = 0; i < z; i++) {
+			*parity++ = (uint8_t)(s >> i) & 1;
+		}
+	}
+	return count;
+}
+
+/**
+ * Pack an array of hard bits and check it
+ */
+int syndromeCheckBits(Code *code, uint8_t *bits) {
+	QcWord words[SYNDROME_MAX_NB];
+	syndromePack(words, code, bits);
+	return syndromeCheck(code, words);
+}
+
+/**
+ * Pack an array of hard bits and count its unsatisfied checks
+ */
+int syndromeCountBits(Code *code, uint8_t *bits) {
+	QcWord words[SYNDROME_MAX_NB];
+	syndromePack(words, code, bits);
+	return syndromeCount(code, words);
+}
@@ -1,7 +1,15 @@
 
 #include <stdint.h>
+#include <string.h>
 
 #include "util.h"
+#include "isa.h"
+
+#ifdef ISA_X86
+#include <immintrin.h>
+#endif
+
+#define BYTE_LSBS 0x0101010101010101ULL
 
 /**
  * Multiply a sparse binary matrix with a normal binary array
@@ -42,7 +50,11 @@ void substituteSparse(uint8_t *out, int **sparseMatrix, int len, uint8_t *arr) {
 		int sum = 0;
 		int rlen = row[0];
 		for (int j = 1; j <= rlen ; j++) {
-			sum ^= y[row[j]];
+			int idx = row[j];
+			// the diagonal entry is y[i] itself, which we are solving for
+			if (idx < i) {
+				sum ^= y[idx];
+			}
 		}
 		y[i] = sum ^ arr[i];
 	}
@@ -55,7 +67,42 @@ void substituteSparse(uint8_t *out, int **sparseMatrix, int len, uint8_t *arr) {
  * @param {uint8_t *} bytes inpuyt array of bytes
  * @param {int} len number of bytes
  */
+#ifdef ISA_X86
+/**
+ * Deposit each bit of a byte into the low bit of a byte of a word, the
+ * top bit first in memory
+ */
+__attribute__((target("bmi2")))
+static void bytesToBitsBmi2(uint8_t *bits, uint8_t *bytes, int len) {
+	while (len--) {
+		uint64_t spread = __builtin_bswap64(_pdep_u64(*bytes++, BYTE_LSBS));
+		memcpy(bits, &spread, 8);
+		bits += 8;
+	}
+}
+
+/**
+ * Gather the low bits of eight bytes into a byte, the first in memory on top
+ */
+__attribute__((target("bmi2")))
+static int bitsToBytesBmi2(uint8_t *bytes, uint8_t *bits, int len) {
+	int done = 0;
+	for (; done + 8 <= len; done += 8) {
+		uint64_t x;
+		memcpy(&x, bits + done, 8);
+		*bytes++ = (uint8_t) _pext_u64(__builtin_bswap64(x), BYTE_LSBS);
+	}
+	return done;
+}
+#endif
+
 void bytesToBitsBE(uint8_t *bits, uint8_t *bytes, int len) {
+#ifdef ISA_X86
+	if (isaLevel() >= ISA_AVX2) {
+		bytesToBitsBmi2(bits, bytes, len);
+		return;
+	}
+#endif
 	while (len--) {
 		uint8_t b = *bytes++;
 		*bits++ = ((b >> 7) & 1);
@@ -69,13 +116,52 @@ void bytesToBitsBE(uint8_t *bits, uint8_t *bytes, int len) {
 	}
 }
 
+/**
+ * Convert a range of bits within an array of bytes to an array of bits.
+ * Bigendian.  The range need not start or end on a byte boundary.
+ * @param {uint8_t *} bits output buffer for nrBits bits
+ * @param {uint8_t *} bytes array of bytes
+ * @param {int} bitOffset index of the first bit to take
+ * @param {int} nrBits number of bits to take
+ */
+void extractBitsBE(uint8_t *bits, uint8_t *bytes, int bitOffset, int nrBits) {
+	bytes += bitOffset >> 3;
+	int shift = 7 - (bitOffset & 7);
+	// up to the first byte boundary
+	while (nrBits && shift != 7) {
+		*bits++ = (*bytes >> shift--) & 1;
+		nrBits--;
+		if (shift < 0) {
+			shift = 7;
+			bytes++;
+		}
+	}
+	int whole = nrBits >> 3;
+	bytesToBitsBE(bits, bytes, whole);
+	bits += whole << 3;
+	bytes += whole;
+	nrBits &= 7;
+	for (shift = 7; nrBits--; shift--) {
+		*bits++ = (*bytes >> shift) & 1;
+	}
+}
+
 /** 
- * Assumes bits length is multiple of 8
+ * Convert an array of bits to an array of bytes.  Bigendian.
+ * If len is not a multiple of 8, the last bits go in the top of the last byte.
  * @param {uint8_t *} output buffer for bytes
  * @param {uint8_t *} bits array of bits
  * @param {int} len number of bits
  */
 void bitsToBytesBE(uint8_t *bytes, uint8_t *bits, int len) {
+#ifdef ISA_X86
+	if (isaLevel() >= ISA_AVX2) {
+		int done = bitsToBytesBmi2(bytes, bits, len);
+		bytes += done >> 3;
+		bits += done;
+		len -= done;
+	}
+#endif
 	uint8_t b = 0;
 	int column = 0;
 	while (len--) {
@@ -87,11 +173,197 @@ void bitsToBytesBE(uint8_t *bytes, uint8_t *bits, int len) {
 		}
 	}
 	if (column) {
-		*bytes = b;
+		*bytes = b << (8 - column);
+	}
+}
+
+#ifdef ISA_X86
+__attribute__((target("sse4.2")))
+static int xorSse42(uint8_t *out, uint8_t *a, uint8_t *b, int len) {
+	int k = 0;
+	for (; k + 16 <= len; k += 16) {
+		__m128i x = _mm_xor_si128(_mm_loadu_si128((__m128i *)(a + k)),
+			_mm_loadu_si128((__m128i *)(b + k)));
+		_mm_storeu_si128((__m128i *)(out + k), x);
+	}
+	return k;
+}
+
+/**
+ * The wider forms finish with narrower vectors themselves, so that a short
+ * run is still one call
+ */
+__attribute__((target("avx2")))
+static int xorAvx2(uint8_t *out, uint8_t *a, uint8_t *b, int len) {
+	int k = 0;
+	for (; k + 32 <= len; k += 32) {
+		__m256i x = _mm256_xor_si256(_mm256_loadu_si256((__m256i *)(a + k)),
+			_mm256_loadu_si256((__m256i *)(b + k)));
+		_mm256_storeu_si256((__m256i *)(out + k), x);
+	}
+	if (k + 16 <= len) {
+		__m128i x = _mm_xor_si128(_mm_loadu_si128((__m128i *)(a + k)),
+			_mm_loadu_si128((__m128i *)(b + k)));
+		_mm_storeu_si128((__m128i *)(out + k), x);
+		k += 16;
 	}
+	return k;
 }
 
+__attribute__((target("avx512f")))
+static int xorAvx512(uint8_t *out, uint8_t *a, uint8_t *b, int len) {
+	int k = 0;
+	for (; k + 64 <= len; k += 64) {
+		__m512i x = _mm512_xor_si512(_mm512_loadu_si512(a + k), _mm512_loadu_si512(b + k));
+		_mm512_storeu_si512(out + k, x);
+	}
+	if (k + 32 <= len) {
+		__m256i x = _mm256_xor_si256(_mm256_loadu_si256((__m256i *)(a + k)),
+			_mm256_loadu_si256((__m256i *)(b + k)));
+		_mm256_storeu_si256((__m256i *)(out + k), x);
+		k += 32;
+	}
+	if (k + 16 <= len) {
+		__m128i x = _mm_xor_si128(_mm_loadu_si128((__m128i *)(a + k)),
+			_mm_loadu_si128((__m128i *)(b + k)));
+		_mm_storeu_si128((__m128i *)(out + k), x);
+		k += 16;
+	}
+	return k;
+}
+#endif
 
+/**
+ * Exclusive-or what the vectors left, from byte k on, by 64-bit words
+ */
+static inline void xorWords(uint8_t *out, uint8_t *a, uint8_t *b, int k, int len) {
+	for (; k + 8 <= len; k += 8) {
+		uint64_t x;
+		uint64_t y;
+		memcpy(&x, a + k, 8);
+		memcpy(&y, b + k, 8);
+		x ^= y;
+		memcpy(out + k, &x, 8);
+	}
+	for (; k < len; k++) {
+		out[k] = a[k] ^ b[k];
+	}
+}
+
+/**
+ * Exclusive-or two byte arrays, by the widest vectors that isaLevel() allows,
+ * then by 64-bit words
+ */
+void xorBytes(uint8_t *out, uint8_t *a, uint8_t *b, int len) {
+	int k = 0;
+#ifdef ISA_X86
+	IsaLevel level = isaLevel();
+	if (level >= ISA_AVX512) {
+		k = xorAvx512(out, a, b, len);
+	} else if (level >= ISA_AVX2) {
+		k = xorAvx2(out, a, b, len);
+	} else if (level >= ISA_SSE42) {
+		k = xorSse42(out, a, b, len);
+	}
+#endif
+	xorWords(out, a, b, k, len);
+}
+
+/**
+ * Add a rotated block into another, out[r] ^= in[(r + shift) % z], as the
+ * two runs that the rotation splits it into
+ */
+typedef void (*RotateFunc)(uint8_t *out, uint8_t *in, int shift, int z);
+
+static void xorRotateWords(uint8_t *out, uint8_t *in, int shift, int z) {
+	xorWords(out, out, in + shift, 0, z - shift);
+	xorWords(out + z - shift, out + z - shift, in, 0, shift);
+}
+
+#ifdef ISA_X86
+/**
+ * The runs of a cell are short, 27 to 81 bytes, so the vector forms take
+ * a whole cell in one call rather than a call per run
+ */
+__attribute__((target("sse4.2")))
+static void xorRotateSse42(uint8_t *out, uint8_t *in, int shift, int z) {
+	uint8_t *tail = out + z - shift;
+	xorWords(out, out, in + shift, xorSse42(out, out, in + shift, z - shift), z - shift);
+	xorWords(tail, tail, in, xorSse42(tail, tail, in, shift), shift);
+}
+
+__attribute__((target("avx2")))
+static void xorRotateAvx2(uint8_t *out, uint8_t *in, int shift, int z) {
+	uint8_t *tail = out + z - shift;
+	xorWords(out, out, in + shift, xorAvx2(out, out, in + shift, z - shift), z - shift);
+	xorWords(tail, tail, in, xorAvx2(tail, tail, in, shift), shift);
+}
+
+__attribute__((target("avx512f")))
+static void xorRotateAvx512(uint8_t *out, uint8_t *in, int shift, int z) {
+	uint8_t *tail = out + z - shift;
+	xorWords(out, out, in + shift, xorAvx512(out, out, in + shift, z - shift), z - shift);
+	xorWords(tail, tail, in, xorAvx512(tail, tail, in, shift), shift);
+}
+#endif
+
+/**
+ * The form of xorRotate() for isaLevel()
+ */
+static RotateFunc rotateFunc(void) {
+#ifdef ISA_X86
+	IsaLevel level = isaLevel();
+	if (level >= ISA_AVX512) {
+		return xorRotateAvx512;
+	} else if (level >= ISA_AVX2) {
+		return xorRotateAvx2;
+	} else if (level >= ISA_SSE42) {
+		return xorRotateSse42;
+	}
+#endif
+	return xorRotateWords;
+}
+
+/**
+ * Add a rotated block into another, as for one cell of a quasi-cyclic
+ * matrix: out[r] ^= in[(r + shift) % z], by the widest vectors that
+ * isaLevel() allows.
+ * @param {uint8_t *} out output block of z bytes
+ * @param {uint8_t *} in input block of z bytes
+ * @param {int} shift the rotation of the cell, 0 to z - 1
+ * @param {int} z the size of a qc cell
+ */
+void xorRotate(uint8_t *out, uint8_t *in, int shift, int z) {
+	rotateFunc()(out, in, shift, z);
+}
+
+/**
+ * Multiply a subblock of a quasi-cyclic matrix with a binary array, a cell
+ * at a time.  Gives the same as multiplySparse() with the rows that
+ * qcToSparse() makes of the subblock.
+ * @param {uint8_t *} out output for height * z bytes
+ * @param {int *} qc the source quasi-cyclic matrices in a single array
+ * @param {int} qcWidth the width of a qc row of the qc table
+ * @param {int} xoff the x-offset of the subblock in the qc table
+ * @param {int} yoff the y-offset of the subblock in the qc table
+ * @param {int} width the width of the subblock in the qc table
+ * @param {int} height the height of the subblock in the qc table
+ * @param {int} z the size of a qc cell
+ * @param {uint8_t *} arr column vector of width * z bytes
+ */
+void multiplyQc(uint8_t *out, int *qc, int qcWidth, int xoff, int yoff,
+		int width, int height, int z, uint8_t *arr) {
+	RotateFunc rotate = rotateFunc();
+	memset(out, 0, height * z);
+	for (int row = 0; row < height; row++) {
+		int *cells = qc + (row + yoff) * qcWidth + xoff;
+		for (int col = 0; col < width; col++) {
+			if (cells[col] >= 0) {
+				rotate(out + row * z, arr + col * z, cells[col], z);
+			}
+		}
+	}
+}
 
 
 /**
@@ -0,0 +1,74 @@
+#include <stdlib.h>
+#include <unistd.h>
+#include <pthread.h>
+
+#include "workers.h"
+
+/**
+ * The arguments for one slice of work
+ */
+typedef struct {
+	WorkerFunc func;
+	void *ctx;
+	int worker;
+	int start;
+	int end;
+} WorkerSlice;
+
+static void *workerMain(void *arg) {
+	WorkerSlice *slice = (WorkerSlice *) arg;
+	slice->func(slice->ctx, slice->worker, slice->start, slice->end);
+	return (void *)0;
+}
+
+/**
+ * Get the number of workers to use when the caller does not say
+ * @return {int} the number of online processors, at least 1
+ */
+int workersCount(void) {
+	long n = sysconf(_SC_NPROCESSORS_ONLN);
+	return n < 1 ? 1 : (int) n;
+}
+
+/**
+ * Split the jobs 0 to nrJobs-1 into nrWorkers contiguous slices, and run
+ * each slice on its own thread.  The calling thread runs the first slice
+ * itself, and returns when all of the slices are done.
+ * @param {WorkerFunc} func the function to run for each slice
+ * @param {void *} ctx context passed to each call of func
+ * @param {int} nrJobs the number of jobs
+ * @param {int} nrWorkers the number of slices.  Must be 1 to nrJobs
+ */
+void workersRun(WorkerFunc func, void *ctx, int nrJobs, int nrWorkers) {
+	if (nrWorkers <= 1) {
+		func(ctx, 0, 0, nrJobs);
+		return;
+	}
+	WorkerSlice slices[nrWorkers];
+	pthread_t threads[nrWorkers];
+	int started[nrWorkers];
+	int per = nrJobs / nrWorkers;
+	int extra = nrJobs % nrWorkers;
+	int start = 0;
+	for (int i = 0; i < nrWorkers; i++) {
+		int len = per + (i < extra ? 1 : 0);
+		WorkerSlice *slice = &slices[i];
+		slice->func = func;
+		slice->ctx = ctx;
+		slice->worker = i;
+		slice->start = start;
+		slice->end = start + len;
+		start += len;
+	}
+	for (int i = 1; i < nrWorkers; i++) {
+		started[i] = pthread_create(&threads[i], NULL, workerMain, &slices[i]) == 0;
+	}
+	workerMain(&slices[0]);
+	for (int i = 1; i < nrWorkers; i++) {
+		if (started[i]) {
+			pthread_join(threads[i], NULL);
+		} else {
+			workerMain(&slices[i]);
+		}
+	}
+}
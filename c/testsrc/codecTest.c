@@ -0,0 +1,149 @@
+#include <stdlib.h>
+#include <stdint.h>
+#include <CUnit/Basic.h>
+
+#include "ldpc802.h"
+#include "util.h"
+
+
+static uint8_t *makeBytes(int len) {
+	uint8_t *bytes = (uint8_t *) malloc(len * sizeof(uint8_t));
+	for (int i = 0; i < len; i++) {
+		bytes[i] = (uint8_t)(i * 29 + 11);
+	}
+	return bytes;
+}
+
+/**
+ * Turn frame bytes into soft bits, 1 -> -1.0, 0 -> 1.0
+ */
+static float *makeSignal(uint8_t *bytes, int len) {
+	uint8_t *bits = (uint8_t *) malloc(len * 8 * sizeof(uint8_t));
+	bytesToBitsBE(bits, bytes, len);
+	float *signal = (float *) malloc(len * 8 * sizeof(float));
+	for (int i = 0; i < len * 8; i++) {
+		signal[i] = bits[i] ? -1.0 : 1.0;
+	}
+	free(bits);
+	return signal;
+}
+
+/**
+ * Push a stream through both sides, in pieces that do not line
+ * up with the chunks or frames
+ * @return the number of bytes received
+ */
+static int roundTrip(LdpcCodec *tx, LdpcCodec *rx, uint8_t *bytes, int len,
+		uint8_t *out, int nrFlips) {
+	int encLen = ldpcCodecEncodeSize(tx, len) + tx->frameBytes;
+	uint8_t *enc = (uint8_t *) malloc(encLen * sizeof(uint8_t));
+	int encoded = 0;
+	for (int i = 0; i < len; i += 17) {
+		int n = len - i < 17 ? len - i : 17;
+		int res = ldpcCodecEncode(tx, bytes + i, n, enc + encoded, encLen - encoded);
+		CU_ASSERT(res >= 0);
+		encoded += res;
+	}
+	encoded += ldpcCodecEncodeFlush(tx, enc + encoded, encLen - encoded);
+
+	float *signal = makeSignal(enc, encoded);
+	int nrSamples = encoded * 8;
+	// flip a few bits of each frame
+	for (int i = 0; i < nrSamples; i += tx->frameBytes * 8) {
+		for (int j = 0; j < nrFlips; j++) {
+			int idx = i + 3 + j * 37;
+			if (idx < nrSamples) {
+				signal[idx] = -signal[idx];
+			}
+		}
+	}
+	int decoded = 0;
+	for (int i = 0; i < nrSamples; i += 100) {
+		int n = nrSamples - i < 100 ? nrSamples - i : 100;
+		int res = ldpcCodecDecode(rx, signal + i, n, out + decoded, len - decoded);
+		CU_ASSERT(res >= 0);
+		decoded += res;
+	}
+	decoded += ldpcCodecDecodeFlush(rx, out + decoded, rx->chunkBytes);
+	free(enc);
+	free(signal);
+	return decoded;
+}
+
+static void testConstruct(void) {
+	LdpcCodec *codec = ldpcCodecCreate(&c12_648, 1);
+	CU_ASSERT_PTR_NOT_NULL_FATAL(codec);
+	CU_ASSERT_EQUAL(codec->chunkBytes, 36);
+	CU_ASSERT_EQUAL(codec->parityBytes, 41);
+	CU_ASSERT_EQUAL(codec->frameBytes, 81);
+	ldpcCodecDestroy(codec);
+}
+
+static void testRoundTrip(void) {
+	int len = 1000;
+	uint8_t *bytes = makeBytes(len);
+	uint8_t *out = (uint8_t *) malloc(len * sizeof(uint8_t));
+	LdpcCodec *tx = ldpcCodecCreate(&c12_648, 1);
+	LdpcCodec *rx = ldpcCodecCreate(&c12_648, 1);
+	int res = roundTrip(tx, rx, bytes, len, out, 0);
+	CU_ASSERT_EQUAL_FATAL(res, len);
+	for (int i = 0; i < len; i++) {
+		CU_ASSERT_EQUAL(out[i], bytes[i]);
+	}
+	CU_ASSERT_EQUAL(rx->frames, 28);
+	CU_ASSERT_EQUAL(rx->crcErrors, 0);
+	ldpcCodecDestroy(tx);
+	ldpcCodecDestroy(rx);
+	free(bytes);
+	free(out);
+}
+
+static void testErrorsAndScrambler(void) {
+	int len = 500;
+	uint8_t *bytes = makeBytes(len);
+	uint8_t *out = (uint8_t *) malloc(len * sizeof(uint8_t));
+	LdpcCodec *tx = ldpcCodecCreate(&c34_1944, 1);
+	LdpcCodec *rx = ldpcCodecCreate(&c34_1944, 1);
+	ldpcCodecSetScrambler(tx, 0x5d);
+	ldpcCodecSetScrambler(rx, 0x5d);
+	int res = roundTrip(tx, rx, bytes, len, out, 3);
+	CU_ASSERT_EQUAL_FATAL(res, len);
+	for (int i = 0; i < len; i++) {
+		CU_ASSERT_EQUAL(out[i], bytes[i]);
+	}
+	ldpcCodecDestroy(tx);
+	ldpcCodecDestroy(rx);
+	free(bytes);
+	free(out);
+}
+
+static void testOutputTooSmall(void) {
+	uint8_t *bytes = makeBytes(100);
+	uint8_t out[100];
+	LdpcCodec *tx = ldpcCodecCreate(&c12_648, 1);
+	int res = ldpcCodecEncode(tx, bytes, 100, out, 100);
+	CU_ASSERT_EQUAL(res, -1);
+	CU_ASSERT_EQUAL(tx->txLen, 0);
+	ldpcCodecDestroy(tx);
+	free(bytes);
+}
+
+
+int codecSuiteSetup(void)
+{
+	CU_pSuite pSuite = CU_add_suite("LDPC Codec Spec", NULL, NULL);
+	if (!pSuite) {
+		return CU_FALSE;
+	}
+
+	if (
+		(!CU_add_test(pSuite, "should construct properly", testConstruct)) ||
+		(!CU_add_test(pSuite, "should decode what it encodes", testRoundTrip)) ||
+		(!CU_add_test(pSuite, "should handle errors and scrambling", testErrorsAndScrambler)) ||
+		(!CU_add_test(pSuite, "should not overrun the output", testOutputTooSmall))
+		) {
+		return CU_FALSE;
+	}
+
+	return CU_TRUE;
+}
@@ -12,6 +12,36 @@ static void testCorrectValue(void) {
 	uint8_t * bytes = (uint8_t *) str;
     uint32_t res = Crc32ofBytes(bytes, len);
 	CU_ASSERT(res == 0x414fa339);
+	CU_ASSERT(Crc32ofBytesTable(bytes, len) == 0x414fa339);
+	CU_ASSERT(Crc32ofBytesSlice8(bytes, len) == 0x414fa339);
+	CU_ASSERT(Crc32ofBytesSlice16(bytes, len) == 0x414fa339);
+	CU_ASSERT(Crc32ofBytesClmul(bytes, len) == 0x414fa339);
+}
+
+/**
+ * Every form should agree with the byte at a time one, for any length
+ * and alignment
+ */
+static void testForms(void) {
+	int size = 4096 + 16;
+	uint8_t *buf = (uint8_t *) malloc(size);
+	uint32_t seed = 12345;
+	for (int i = 0; i < size; i++) {
+		seed = seed * 1664525 + 1013904223;
+		buf[i] = seed >> 24;
+	}
+	for (int len = 0; len <= 300; len++) {
+		uint8_t *p = buf + len % 7;
+		uint32_t want = Crc32ofBytesTable(p, len);
+		CU_ASSERT_EQUAL(Crc32ofBytesSlice8(p, len), want);
+		CU_ASSERT_EQUAL(Crc32ofBytesSlice16(p, len), want);
+		CU_ASSERT_EQUAL(Crc32ofBytesClmul(p, len), want);
+		CU_ASSERT_EQUAL(Crc32ofBytes(p, len), want);
+	}
+	uint32_t want = Crc32ofBytesTable(buf + 3, 4096);
+	CU_ASSERT_EQUAL(Crc32ofBytesSlice16(buf + 3, 4096), want);
+	CU_ASSERT_EQUAL(Crc32ofBytesClmul(buf + 3, 4096), want);
+	free(buf);
 }
 
 
@@ -22,9 +52,10 @@ int crcSuiteSetup(void)
 		return CU_FALSE;
 	}
 
-	if ((NULL == CU_add_test(pSuite, "test of correct value", testCorrectValue))) {
+	if ((NULL == CU_add_test(pSuite, "test of correct value", testCorrectValue)) ||
+		(NULL == CU_add_test(pSuite, "should agree in every form", testForms))) {
 		return CU_FALSE;
 	}
 
 	return CU_TRUE;
-}
\ No newline at end of file
+}
\ No newline at end of file
@@ -0,0 +1,129 @@
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <math.h>
+#include <CUnit/Basic.h>
+
+#include "half.h"
+
+
+static uint32_t seed = 4321;
+
+static uint32_t rand32(void) {
+	seed = seed * 1664525 + 1013904223;
+	return seed;
+}
+
+static float fromBits(uint32_t x) {
+	float f;
+	memcpy(&f, &x, sizeof(f));
+	return f;
+}
+
+static void testKnownValues(void) {
+	CU_ASSERT_EQUAL(halfFromFloat(1.0f), 0x3c00);
+	CU_ASSERT_EQUAL(halfFromFloat(-2.0f), 0xc000);
+	CU_ASSERT_EQUAL(halfFromFloat(0.1f), 0x2e66);
+	CU_ASSERT_EQUAL(halfFromFloat(65504.0f), 0x7bff);
+	CU_ASSERT_EQUAL(halfFromFloat(65519.0f), 0x7bff);
+	CU_ASSERT_EQUAL(halfFromFloat(65520.0f), 0x7c00);
+	CU_ASSERT_EQUAL(halfFromFloat(ldexpf(1.0f, -24)), 0x0001);
+	CU_ASSERT_EQUAL(halfFromFloat(ldexpf(1.0f, -25)), 0x0000);
+	CU_ASSERT_EQUAL(halfFromFloat(-0.0f), 0x8000);
+	CU_ASSERT_EQUAL(halfFromFloat(INFINITY), 0x7c00);
+	CU_ASSERT_EQUAL(halfToFloat(0x3555), 0.333251953125f);
+	CU_ASSERT_EQUAL(halfToFloat(0x0200), ldexpf(1.0f, -15));
+	CU_ASSERT(isnan(halfToFloat(halfFromFloat(NAN))));
+
+	CU_ASSERT_EQUAL(bf16FromFloat(1.0f), 0x3f80);
+	CU_ASSERT_EQUAL(bf16FromFloat(3.14159265f), 0x4049);
+	CU_ASSERT_EQUAL(bf16FromFloat(-20.0f), 0xc1a0);
+	CU_ASSERT_EQUAL(bf16ToFloat(0x4049), 3.140625f);
+	// subnormals go to zero, with their sign
+	CU_ASSERT_EQUAL(bf16FromFloat(-ldexpf(1.0f, -130)), 0x8000);
+	CU_ASSERT(isnan(bf16ToFloat(bf16FromFloat(NAN))));
+}
+
+/**
+ * Halfway values go to the even neighbour
+ */
+static void testTiesToEven(void) {
+	// 1 + 2^-11 is halfway from 1 to 1 + 2^-10
+	CU_ASSERT_EQUAL(halfFromFloat(1.0f + ldexpf(1.0f, -11)), 0x3c00);
+	CU_ASSERT_EQUAL(halfFromFloat(1.0f + 3.0f * ldexpf(1.0f, -11)), 0x3c02);
+	// 1.5 * 2^-24 is halfway from 2^-24 to 2^-23
+	CU_ASSERT_EQUAL(halfFromFloat(1.5f * ldexpf(1.0f, -24)), 0x0002);
+	// 1 + 2^-8 is halfway from 1 to 1 + 2^-7
+	CU_ASSERT_EQUAL(bf16FromFloat(1.0f + ldexpf(1.0f, -8)), 0x3f80);
+	CU_ASSERT_EQUAL(bf16FromFloat(1.0f + 3.0f * ldexpf(1.0f, -8)), 0x3f82);
+}
+
+/**
+ * Every value of each format comes back to the same bits
+ */
+static void testRoundTrip(void) {
+	for (uint32_t h = 0; h < 0x10000; h++) {
+		if ((h & 0x7c00) == 0x7c00 && (h & 0x3ff)) {
+			continue;
+		}
+		CU_ASSERT_EQUAL(halfFromFloat(halfToFloat(h)), h);
+		// bf16 has no subnormals
+		if ((h & 0x7f80) || !(h & 0x7f)) {
+			if ((h & 0x7f80) != 0x7f80 || !(h & 0x7f)) {
+				CU_ASSERT_EQUAL(bf16FromFloat(bf16ToFloat(h)), h);
+			}
+		}
+	}
+}
+
+/**
+ * Both forms should give the same bits, for every length, and values
+ * from subnormal to infinite
+ */
+static void testBitExact(void) {
+	float in[40];
+	uint16_t h1[40];
+	uint16_t h2[40];
+	float f1[40];
+	float f2[40];
+	for (int trial = 0; trial < 2000; trial++) {
+		int n = 1 + trial % 40;
+		for (int k = 0; k < n; k++) {
+			// exponents around those of FP16, and some of everything
+			uint32_t x = rand32();
+			if (trial % 4) {
+				x = (x & 0x807fffff) | ((100 + (x >> 23) % 50) << 23);
+			}
+			in[k] = fromBits(x);
+		}
+		halfPackScalar(h1, in, n);
+		halfPackVector(h2, in, n);
+		CU_ASSERT_EQUAL(memcmp(h1, h2, n * sizeof(uint16_t)), 0);
+		halfUnpackScalar(f1, h1, n);
+		halfUnpackVector(f2, h1, n);
+		CU_ASSERT_EQUAL(memcmp(f1, f2, n * sizeof(float)), 0);
+		bf16PackScalar(h1, in, n);
+		bf16PackVector(h2, in, n);
+		CU_ASSERT_EQUAL(memcmp(h1, h2, n * sizeof(uint16_t)), 0);
+	}
+}
+
+
+int halfSuiteSetup(void)
+{
+	CU_pSuite pSuite = CU_add_suite("Half Precision Spec", NULL, NULL);
+	if (!pSuite) {
+		return CU_FALSE;
+	}
+
+	if (
+		(!CU_add_test(pSuite, "should convert known values", testKnownValues)) ||
+		(!CU_add_test(pSuite, "should round ties to even", testTiesToEven)) ||
+		(!CU_add_test(pSuite, "should keep every value", testRoundTrip)) ||
+		(!CU_add_test(pSuite, "should be bit-exact scalar and vector", testBitExact))
+		) {
+		return CU_FALSE;
+	}
+
+	return CU_TRUE;
+}
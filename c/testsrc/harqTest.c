@@ -0,0 +1,213 @@
+#include <stdlib.h>
+#include <stdint.h>
+#include <CUnit/Basic.h>
+
+#include "ldpcEncoder.h"
+#include "ldpcDecoder.h"
+#include "harq.h"
+
+
+static uint8_t *makeCodeword(LdpcEncoder *enc) {
+	int K = enc->code->messageBits;
+	int N = enc->code->N;
+	uint8_t *msg = (uint8_t *) malloc(K * sizeof(uint8_t));
+	for (int i = 0; i < K; i++) {
+		msg[i] = ((i * 37) >> 2) & 1;
+	}
+	uint8_t *x = ldpcEncode(enc, msg, K);
+	uint8_t *word = (uint8_t *) malloc(N * sizeof(uint8_t));
+	for (int i = 0; i < N; i++) {
+		word[i] = x[i];
+	}
+	free(msg);
+	return word;
+}
+
+/**
+ * Make a received word with every period'th bit, from offset, turned
+ * the wrong way at the given strength
+ */
+static void makeSignal(float *signal, uint8_t *word, int N, int period, int offset, float strength) {
+	for (int i = 0; i < N; i++) {
+		signal[i] = word[i] ? -1.0f : 1.0f;
+		if (i % period == offset) {
+			signal[i] = -signal[i] * strength;
+		}
+	}
+}
+
+/**
+ * Two transmissions that each have too many errors to decode, but
+ * in different places
+ */
+static void testChase(void) {
+	Code *code = &c12_648;
+	LdpcEncoder *enc = ldpcEncoderCreate(code);
+	LdpcDecoder *dec = ldpcDecoderCreate(code);
+	HarqBuffer *h = harqCreate(code);
+	uint8_t *word = makeCodeword(enc);
+	float signal[648];
+
+	makeSignal(signal, word, 648, 4, 0, 0.4f);
+	CU_ASSERT_EQUAL(harqCombine(h, signal, 648, (uint8_t *)0), 1);
+	uint8_t *bits = harqDecode(h, dec, 20, 1);
+	CU_ASSERT_PTR_NULL(bits);
+	CU_ASSERT_EQUAL(h->hasMessages, 1);
+
+	makeSignal(signal, word, 648, 4, 2, 0.4f);
+	CU_ASSERT_EQUAL(harqCombine(h, signal, 648, (uint8_t *)0), 1);
+	CU_ASSERT_EQUAL(h->transmissions, 2);
+	bits = harqDecode(h, dec, 20, 1);
+	CU_ASSERT_PTR_NOT_NULL_FATAL(bits);
+	for (int i = 0; i < 648; i++) {
+		CU_ASSERT_EQUAL(bits[i], word[i]);
+	}
+	CU_ASSERT_EQUAL(h->hasMessages, 0);
+
+	harqReset(h);
+	CU_ASSERT_EQUAL(h->transmissions, 0);
+	CU_ASSERT_EQUAL(h->llr[0], 0.0f);
+	harqDestroy(h);
+	ldpcEncoderDestroy(enc);
+	ldpcDecoderDestroy(dec);
+	free(word);
+}
+
+/**
+ * Send the message and half the parity, then the other half
+ */
+static void testIncrementalRedundancy(void) {
+	Code *code = &c12_648;
+	LdpcEncoder *enc = ldpcEncoderCreate(code);
+	LdpcDecoder *dec = ldpcDecoderCreate(code);
+	HarqBuffer *h = harqCreate(code);
+	uint8_t *word = makeCodeword(enc);
+	float signal[648];
+	float received[648];
+	uint8_t erased[648];
+
+	makeSignal(signal, word, 648, 6, 1, 0.3f);
+	int n = 0;
+	for (int i = 0; i < 648; i++) {
+		erased[i] = i >= 486;
+		if (!erased[i]) {
+			received[n++] = signal[i];
+		}
+	}
+	CU_ASSERT_EQUAL(harqCombine(h, received, n + 1, erased), 0);
+	CU_ASSERT_EQUAL(harqCombine(h, received, n, erased), 1);
+	harqDecode(h, dec, 10, 1);
+
+	n = 0;
+	for (int i = 0; i < 648; i++) {
+		erased[i] = i < 486;
+		if (!erased[i]) {
+			received[n++] = signal[i];
+		}
+	}
+	CU_ASSERT_EQUAL(harqCombine(h, received, n, erased), 1);
+	for (int i = 0; i < 648; i++) {
+		CU_ASSERT_EQUAL(h->llr[i], signal[i]);
+	}
+	uint8_t *bits = harqDecode(h, dec, 50, 1);
+	CU_ASSERT_PTR_NOT_NULL_FATAL(bits);
+	for (int i = 0; i < 648; i++) {
+		CU_ASSERT_EQUAL(bits[i], word[i]);
+	}
+	harqDestroy(h);
+	ldpcEncoderDestroy(enc);
+	ldpcDecoderDestroy(dec);
+	free(word);
+}
+
+/**
+ * A decode that stops after a few iterations, then carries on from its
+ * saved messages, should end just as one that never stopped
+ */
+static void testWarmStart(void) {
+	Code *code = &c12_648;
+	LdpcEncoder *enc = ldpcEncoderCreate(code);
+	LdpcDecoder *dec = ldpcDecoderCreate(code);
+	HarqBuffer *h = harqCreate(code);
+	uint8_t *word = makeCodeword(enc);
+	float signal[648];
+	makeSignal(signal, word, 648, 13, 3, 0.5f);
+	harqCombine(h, signal, 648, (uint8_t *)0);
+
+	uint8_t *bits = ldpcDecodeMS(dec, h->llr, 648, 50);
+	CU_ASSERT_PTR_NOT_NULL_FATAL(bits);
+	int cold = dec->iterations;
+	CU_ASSERT_FATAL(cold > 2);
+
+	bits = harqDecode(h, dec, 2, 1);
+	CU_ASSERT_PTR_NULL(bits);
+	bits = harqDecode(h, dec, 50, 1);
+	CU_ASSERT_PTR_NOT_NULL_FATAL(bits);
+	CU_ASSERT_EQUAL(dec->iterations, cold - 2);
+	for (int i = 0; i < 648; i++) {
+		CU_ASSERT_EQUAL(bits[i], word[i]);
+	}
+	harqDestroy(h);
+	ldpcEncoderDestroy(enc);
+	ldpcDecoderDestroy(dec);
+	free(word);
+}
+
+/**
+ * The same under the row schedule, where a cold decode runs on the
+ * generated kernels and the warm one on the messages they saved
+ */
+static void testWarmStartLayered(void) {
+	Code *code = &c12_648;
+	LdpcEncoder *enc = ldpcEncoderCreate(code);
+	LdpcDecoder *dec = ldpcDecoderCreate(code);
+	HarqBuffer *h = harqCreate(code);
+	uint8_t *word = makeCodeword(enc);
+	float signal[648];
+	dec->schedule = LDPC_SCHEDULE_ROW;
+	makeSignal(signal, word, 648, 10, 3, 0.6f);
+	harqCombine(h, signal, 648, (uint8_t *)0);
+
+	uint8_t *bits = ldpcDecodeMS(dec, h->llr, 648, 50);
+	CU_ASSERT_PTR_NOT_NULL_FATAL(bits);
+	int cold = dec->iterations;
+	CU_ASSERT_FATAL(cold > 2);
+
+	bits = harqDecode(h, dec, 2, 1);
+	CU_ASSERT_PTR_NULL(bits);
+	int nonZero = 0;
+	for (int i = 0; i < h->nrEdges; i++) {
+		nonZero += h->messages[i] != 0.0f;
+	}
+	CU_ASSERT(nonZero > 0);
+	bits = harqDecode(h, dec, 50, 1);
+	CU_ASSERT_PTR_NOT_NULL_FATAL(bits);
+	CU_ASSERT_EQUAL(dec->iterations, cold - 2);
+	for (int i = 0; i < 648; i++) {
+		CU_ASSERT_EQUAL(bits[i], word[i]);
+	}
+	harqDestroy(h);
+	ldpcEncoderDestroy(enc);
+	ldpcDecoderDestroy(dec);
+	free(word);
+}
+
+
+int harqSuiteSetup(void)
+{
+	CU_pSuite pSuite = CU_add_suite("HARQ Spec", NULL, NULL);
+	if (!pSuite) {
+		return CU_FALSE;
+	}
+
+	if (
+		(!CU_add_test(pSuite, "should chase combine", testChase)) ||
+		(!CU_add_test(pSuite, "should combine incremental redundancy", testIncrementalRedundancy)) ||
+		(!CU_add_test(pSuite, "should carry on from a failed decode", testWarmStart)) ||
+		(!CU_add_test(pSuite, "should carry on from a failed layered decode", testWarmStartLayered))
+		) {
+		return CU_FALSE;
+	}
+
+	return CU_TRUE;
+}
@@ -0,0 +1,136 @@
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <CUnit/Basic.h>
+
+#include "isa.h"
+#include "802-codes.h"
+#include "syndrome.h"
+#include "util.h"
+#include "scms.h"
+#include "half.h"
+#include "crc32.h"
+#include "802-kernels.h"
+
+
+static uint32_t seed = 99;
+
+static uint32_t rand32(void) {
+	seed = seed * 1664525 + 1013904223;
+	return seed;
+}
+
+static float randSoft(void) {
+	return ((int)(rand32() >> 8) - (1 << 23)) / (float)(1 << 21);
+}
+
+/**
+ * What each dispatched kernel makes of the same input
+ */
+typedef struct {
+	QcWord words[SYNDROME_MAX_NB];
+	uint8_t hard[1944];
+	uint8_t bytes[243];
+	uint8_t bits[1944];
+	uint8_t sum[1000];
+	uint8_t rotated[81];
+	float q[SCMS_MAX_DEGREE];
+	float total;
+	uint16_t half[100];
+	uint16_t bf16[100];
+	uint32_t crc;
+	float post[1944];
+	float kernelR[6885];
+} Results;
+
+static float soft[1944];
+static uint8_t a[1000];
+static uint8_t b[1000];
+static float r[SCMS_MAX_DEGREE];
+static float kr[6885];
+
+static void runKernels(Results *res) {
+	memset(res, 0, sizeof(Results));
+	syndromePackSoft(res->words, &c34_1944, soft, res->hard);
+	// an odd length leaves a part byte
+	bitsToBytesBE(res->bytes, res->hard, 1939);
+	bytesToBitsBE(res->bits, a, 242);
+	xorBytes(res->sum, a, b, 999);
+	memcpy(res->rotated, b, 81);
+	xorRotate(res->rotated, a, 50, 81);
+	for (int k = 0; k < SCMS_MAX_DEGREE; k++) {
+		res->q[k] = k % 5 ? soft[k + 100] : 0.0f;
+	}
+	res->total = scmsUpdate(0.25f, r, res->q, SCMS_MAX_DEGREE - 1);
+	halfPack(res->half, soft, 99);
+	bf16Pack(res->bf16, soft, 99);
+	res->crc = Crc32ofBytes(a, 999);
+	// z = 81 is not a whole number of vectors at any width
+	LdpcKernel *kernel = ldpcKernelFind(&c34_1944);
+	LayerKernel *layers = ldpcKernelLayers(kernel);
+	memcpy(res->post, soft, sizeof(res->post));
+	memcpy(res->kernelR, kr, sizeof(res->kernelR));
+	for (int layer = 0; layer < c34_1944.mb; layer++) {
+		layers[layer](res->post, res->kernelR + kernel->offsets[layer]);
+	}
+}
+
+static void testNames(void) {
+	CU_ASSERT(isaLevel() <= isaDetect());
+	for (int i = 0; i < ISA_NR_LEVELS; i++) {
+		CU_ASSERT_EQUAL(isaParse(isaName(i)), i);
+	}
+	CU_ASSERT_EQUAL(isaParse("sse2"), -1);
+	CU_ASSERT_STRING_EQUAL(isaName(ISA_AVX2), "avx2");
+}
+
+/**
+ * Every level the host has should give the same results as plain C
+ */
+static void testLevels(void) {
+	for (int i = 0; i < 1944; i++) {
+		soft[i] = randSoft();
+	}
+	soft[7] = -0.0f;
+	for (int i = 0; i < 1000; i++) {
+		a[i] = rand32() >> 24;
+		b[i] = rand32() >> 24;
+	}
+	for (int k = 0; k < SCMS_MAX_DEGREE; k++) {
+		r[k] = randSoft();
+	}
+	for (int k = 0; k < 6885; k++) {
+		kr[k] = randSoft();
+	}
+	IsaLevel saved = isaLevel();
+	static Results generic;
+	static Results results;
+	CU_ASSERT_EQUAL(isaSelect(ISA_GENERIC), ISA_GENERIC);
+	runKernels(&generic);
+	for (int level = ISA_SSE42; level <= isaDetect(); level++) {
+		CU_ASSERT_EQUAL(isaSelect(level), level);
+		runKernels(&results);
+		CU_ASSERT_EQUAL(memcmp(&generic, &results, sizeof(Results)), 0);
+	}
+	// the level can not go past what the host has
+	CU_ASSERT_EQUAL(isaSelect(ISA_AVX512), isaDetect());
+	isaSelect(saved);
+}
+
+
+int isaSuiteSetup(void)
+{
+	CU_pSuite pSuite = CU_add_suite("ISA Dispatch Spec", NULL, NULL);
+	if (!pSuite) {
+		return CU_FALSE;
+	}
+
+	if (
+		(!CU_add_test(pSuite, "should name the levels", testNames)) ||
+		(!CU_add_test(pSuite, "should match plain C at every level", testLevels))
+		) {
+		return CU_FALSE;
+	}
+
+	return CU_TRUE;
+}
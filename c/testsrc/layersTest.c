@@ -0,0 +1,131 @@
+#include <stdlib.h>
+#include <stdint.h>
+#include <CUnit/Basic.h>
+
+#include "802-codes.h"
+#include "layers.h"
+
+
+static int cycleStalls(Code *code, int *order) {
+	int mb = code->mb;
+	int stalls = 0;
+	for (int k = 0; k < mb; k++) {
+		stalls += layerOverlap(code, order[k], order[(k + 1) % mb]);
+	}
+	return stalls;
+}
+
+/**
+ * Try every order of the layers after the first
+ */
+static int bruteForce(Code *code, int *order, int k) {
+	int mb = code->mb;
+	if (k == mb) {
+		return cycleStalls(code, order);
+	}
+	int best = -1;
+	for (int i = k; i < mb; i++) {
+		int t = order[k]; order[k] = order[i]; order[i] = t;
+		int stalls = bruteForce(code, order, k + 1);
+		if (best < 0 || stalls < best) {
+			best = stalls;
+		}
+		t = order[k]; order[k] = order[i]; order[i] = t;
+	}
+	return best;
+}
+
+static void testOverlap(void) {
+	// the dual diagonal of the parity part shares a column with the next row
+	Code *code = &c56_648;
+	int nb = code->nb;
+	int count = 0;
+	for (int j = 0; j < nb; j++) {
+		count += code->Hb[j] >= 0 && code->Hb[nb + j] >= 0;
+	}
+	CU_ASSERT_EQUAL(layerOverlap(code, 0, 1), count);
+	CU_ASSERT(count > 0);
+}
+
+static void testNatural(void) {
+	LayerSchedule s;
+	layerScheduleInit(&s, &c12_648, 0);
+	CU_ASSERT_EQUAL(s.nrLayers, 12);
+	for (int k = 0; k < 12; k++) {
+		CU_ASSERT_EQUAL(s.order[k], k);
+	}
+	CU_ASSERT_EQUAL(s.stalls, cycleStalls(&c12_648, s.order));
+}
+
+static void testOptimal(void) {
+	Code *codes[] = { &c34_648, &c34_1296, &c34_1944, &c56_1944 };
+	for (int c = 0; c < 4; c++) {
+		Code *code = codes[c];
+		LayerSchedule natural;
+		LayerSchedule s;
+		layerScheduleInit(&natural, code, 0);
+		layerScheduleInit(&s, code, 1);
+		int order[LAYERS_MAX_MB];
+		for (int k = 0; k < code->mb; k++) {
+			order[k] = k;
+		}
+		CU_ASSERT_EQUAL(s.stalls, bruteForce(code, order, 1));
+		CU_ASSERT_EQUAL(s.stalls, cycleStalls(code, s.order));
+		CU_ASSERT(s.stalls <= natural.stalls);
+	}
+}
+
+/**
+ * Each layer's columns are all there, once, with those shared with the
+ * next layer before the rest, and those shared with the last layer after
+ */
+static void testColumnOrder(void) {
+	Code *code = &c12_1944;
+	int nb = code->nb;
+	int mb = code->mb;
+	LayerSchedule s;
+	layerScheduleInit(&s, code, 1);
+	int seen = 0;
+	for (int k = 0; k < mb; k++) {
+		seen |= 1 << s.order[k];
+	}
+	CU_ASSERT_EQUAL(seen, (1 << mb) - 1);
+	for (int k = 0; k < mb; k++) {
+		int layer = s.order[k];
+		int prev = s.order[(k + mb - 1) % mb];
+		int next = s.order[(k + 1) % mb];
+		int count = 0;
+		for (int j = 0; j < nb; j++) {
+			count += code->Hb[layer * nb + j] >= 0;
+		}
+		CU_ASSERT_EQUAL(s.nrColumns[layer], count);
+		int lastRank = -1;
+		for (int i = 0; i < s.nrColumns[layer]; i++) {
+			int j = s.columns[layer][i];
+			CU_ASSERT(code->Hb[layer * nb + j] >= 0);
+			int rank = (code->Hb[prev * nb + j] >= 0) - (code->Hb[next * nb + j] >= 0);
+			CU_ASSERT(rank >= lastRank);
+			lastRank = rank;
+		}
+	}
+}
+
+
+int layersSuiteSetup(void)
+{
+	CU_pSuite pSuite = CU_add_suite("Layer Schedule Spec", NULL, NULL);
+	if (!pSuite) {
+		return CU_FALSE;
+	}
+
+	if (
+		(!CU_add_test(pSuite, "should count shared columns", testOverlap)) ||
+		(!CU_add_test(pSuite, "should keep the natural order", testNatural)) ||
+		(!CU_add_test(pSuite, "should find the fewest stalls", testOptimal)) ||
+		(!CU_add_test(pSuite, "should order the columns of each layer", testColumnOrder))
+		) {
+		return CU_FALSE;
+	}
+
+	return CU_TRUE;
+}
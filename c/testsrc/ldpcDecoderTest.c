@@ -1,11 +1,15 @@
 #include <time.h>
 #include <stdlib.h>
+#include <string.h>
 #include <stdint.h>
+#include <math.h>
 #include <CUnit/Basic.h>
 
 #include "ldpcEncoder.h"
 #include "ldpcDecoder.h"
 #include "util.h"
+#include "syndrome.h"
+#include "half.h"
 
 #include "testdata.h"
 
@@ -165,6 +169,833 @@ static void testHandleErrorsAndNoise() {
 	free(message);
 }
 
+/**
+ * A clean word should pass on its hard decisions, with no iterations,
+ * and a word with errors should not
+ */
+static void testFastPath() {
+	LdpcEncoder *enc = ldpcEncoderCreate(&c12_648);
+	LdpcDecoder *dec = ldpcDecoderCreate(&c12_648);
+	uint8_t *message = makeMessageBits(324);
+	uint8_t *x = ldpcEncode(enc, message, 324);
+	float *signalBits = makeSignal(x, 648);
+	uint8_t *result = ldpcDecodeSP(dec, signalBits, 648, 100);
+	CU_ASSERT_PTR_NOT_NULL_FATAL(result);
+	CU_ASSERT_EQUAL(dec->fastPath, 1);
+	CU_ASSERT_EQUAL(dec->iterations, 0);
+	for (int i = 0; i < 648; i++) {
+		CU_ASSERT_EQUAL(result[i], x[i]);
+	}
+	signalBits[5] = -signalBits[5];
+	result = ldpcDecodeMS(dec, signalBits, 648, 100);
+	CU_ASSERT_PTR_NOT_NULL_FATAL(result);
+	CU_ASSERT_EQUAL(dec->fastPath, 0);
+	CU_ASSERT(dec->iterations >= 1);
+	CU_ASSERT_EQUAL(result[5], x[5]);
+	ldpcEncoderDestroy(enc);
+	ldpcDecoderDestroy(dec);
+	free(signalBits);
+	free(message);
+}
+
+/**
+ * The count of unsatisfied checks, kept as the hard decisions flip,
+ * should match a full check of the word
+ */
+static void testTrackSyndrome() {
+	LdpcEncoder *enc = ldpcEncoderCreate(&c12_648);
+	LdpcDecoder *dec = ldpcDecoderCreate(&c12_648);
+	uint8_t *message = makeMessageBits(324);
+	uint8_t *x = ldpcEncode(enc, message, 324);
+	float *signalBits = makeSignal(x, 648);
+	for (int i = 0; i < 648; i += 9) {
+		signalBits[i] = -signalBits[i] * 0.5f;
+	}
+	for (int iter = 1; iter <= 3; iter++) {
+		uint8_t *result = ldpcDecodeMS(dec, signalBits, 648, iter);
+		CU_ASSERT_PTR_NULL(result);
+		CU_ASSERT_EQUAL(dec->iterations, iter);
+		CU_ASSERT(dec->unsatisfied > 0);
+		CU_ASSERT_EQUAL(dec->unsatisfied, syndromeCountBits(dec->code, dec->syndrome));
+	}
+	ldpcEncoderDestroy(enc);
+	ldpcDecoderDestroy(dec);
+	free(signalBits);
+	free(message);
+}
+
+/**
+ * Pure noise will never decode.  With a stall limit it should
+ * give up early, and say so
+ */
+static void testStall() {
+	LdpcDecoder *dec = ldpcDecoderCreate(&c12_648);
+	float *signalBits = (float *) malloc(648 * sizeof(float));
+	for (int i = 0; i < 648; i++) {
+		signalBits[i] = (float)((i * 7919) % 13) / 6.0f - 1.0f;
+	}
+	uint8_t *result = ldpcDecodeMS(dec, signalBits, 648, 100);
+	CU_ASSERT_PTR_NULL(result);
+	CU_ASSERT_EQUAL(dec->status, LDPC_MAX_ITER);
+	CU_ASSERT_EQUAL(dec->iterations, 100);
+	dec->stallLimit = 5;
+	result = ldpcDecodeMS(dec, signalBits, 648, 100);
+	CU_ASSERT_PTR_NULL(result);
+	CU_ASSERT_EQUAL(dec->status, LDPC_STALLED);
+	CU_ASSERT(dec->iterations < 100);
+	result = ldpcDecodeSP(dec, signalBits, 648, 100);
+	CU_ASSERT_PTR_NULL(result);
+	CU_ASSERT_EQUAL(dec->status, LDPC_STALLED);
+	CU_ASSERT(dec->iterations < 100);
+	ldpcDecoderDestroy(dec);
+	free(signalBits);
+}
+
+/**
+ * With CRC-aided termination, a word whose message passes its CRC is
+ * taken at once, and a codeword with a bad CRC is flagged
+ */
+static void testCrcTermination() {
+	LdpcEncoder *enc = ldpcEncoderCreate(&c12_648);
+	LdpcDecoder *dec = ldpcDecoderCreate(&c12_648);
+	uint8_t bytes[40];
+	for (int i = 0; i < 36; i++) {
+		bytes[i] = (uint8_t)(i * 11 + 5);
+	}
+	uint8_t *x = ldpcEncodeBytesCrc(enc, bytes, 36, bytes + 36);
+	uint8_t *word = (uint8_t *) malloc(648 * sizeof(uint8_t));
+	for (int i = 0; i < 648; i++) {
+		word[i] = x[i];
+	}
+	CU_ASSERT_EQUAL_FATAL(ldpcDecoderSetCrc(dec, 288, 36), 1);
+
+	// errors in the parity only
+	float *signalBits = makeSignal(word, 648);
+	signalBits[400] = -signalBits[400];
+	signalBits[500] = -signalBits[500];
+	uint8_t *result = ldpcDecodeMS(dec, signalBits, 648, 100);
+	CU_ASSERT_PTR_NOT_NULL_FATAL(result);
+	CU_ASSERT_EQUAL(dec->status, LDPC_OK);
+	CU_ASSERT_EQUAL(dec->iterations, 0);
+	CU_ASSERT(dec->unsatisfied > 0);
+	free(signalBits);
+
+	// errors in the message and CRC, which must be decoded
+	signalBits = makeSignal(word, 648);
+	signalBits[10] = -signalBits[10] * 0.5f;
+	signalBits[100] = -signalBits[100] * 0.5f;
+	signalBits[300] = -signalBits[300] * 0.5f;
+	result = ldpcDecodeMS(dec, signalBits, 648, 100);
+	CU_ASSERT_PTR_NOT_NULL_FATAL(result);
+	CU_ASSERT_EQUAL(dec->status, LDPC_OK);
+	CU_ASSERT(dec->iterations > 0);
+	for (int i = 0; i < 320; i++) {
+		CU_ASSERT_EQUAL(result[i], word[i]);
+	}
+	free(signalBits);
+
+	// a codeword with a bad CRC
+	bytes[37] ^= 0x10;
+	x = ldpcEncodeBytes(enc, bytes, 40);
+	signalBits = makeSignal(x, 648);
+	result = ldpcDecodeSP(dec, signalBits, 648, 100);
+	CU_ASSERT_PTR_NULL(result);
+	CU_ASSERT_EQUAL(dec->status, LDPC_BAD_CRC);
+	CU_ASSERT_EQUAL(dec->unsatisfied, 0);
+	ldpcDecoderSetCrc(dec, 0, 0);
+	result = ldpcDecodeSP(dec, signalBits, 648, 100);
+	CU_ASSERT_PTR_NOT_NULL(result);
+	free(signalBits);
+
+	ldpcEncoderDestroy(enc);
+	ldpcDecoderDestroy(dec);
+	free(word);
+}
+
+/**
+ * The soft output should agree with the hard bits, and be given
+ * even when the decode fails
+ */
+static void testSoftOutput() {
+	LdpcEncoder *enc = ldpcEncoderCreate(&c12_648);
+	LdpcDecoder *dec = ldpcDecoderCreate(&c12_648);
+	uint8_t *message = makeMessageBits(324);
+	uint8_t *x = ldpcEncode(enc, message, 324);
+	float *signalBits = makeSignal(x, 648);
+	float *app = (float *) malloc(648 * sizeof(float));
+	float *ext = (float *) malloc(648 * sizeof(float));
+
+	// clean, so nothing but the channel
+	uint8_t *result = ldpcDecodeSoftMS(dec, signalBits, 648, 100, app, ext);
+	CU_ASSERT_PTR_NOT_NULL_FATAL(result);
+	for (int i = 0; i < 648; i++) {
+		CU_ASSERT_EQUAL(app[i], signalBits[i]);
+		CU_ASSERT_EQUAL(ext[i], 0.0f);
+	}
+
+	signalBits[7] = -signalBits[7] * 0.3f;
+	signalBits[70] = -signalBits[70] * 0.3f;
+	result = ldpcDecodeSoftSP(dec, signalBits, 648, 100, app, ext);
+	CU_ASSERT_PTR_NOT_NULL_FATAL(result);
+	for (int i = 0; i < 648; i++) {
+		CU_ASSERT_EQUAL(result[i], app[i] < 0.0f ? 1 : 0);
+		CU_ASSERT(fabsf(app[i] - ext[i] - 2.0f * signalBits[i]) < 1e-3f);
+	}
+	CU_ASSERT_PTR_NULL(dec->appOut);
+
+	// a failed decode still gives its LLRs
+	for (int i = 0; i < 648; i++) {
+		app[i] = 99.0f;
+	}
+	result = ldpcDecodeSoftMS(dec, signalBits, 648, 0, app, ext);
+	CU_ASSERT_PTR_NULL(result);
+	for (int i = 0; i < 648; i++) {
+		CU_ASSERT_EQUAL(app[i], signalBits[i]);
+	}
+	result = ldpcDecodeSoftMS(dec, signalBits, 648, 1, app, ext);
+	for (int i = 0; i < 648; i++) {
+		CU_ASSERT(app[i] != 99.0f);
+		CU_ASSERT(fabsf(app[i] - ext[i] - signalBits[i]) < 1e-3f);
+	}
+	ldpcEncoderDestroy(enc);
+	ldpcDecoderDestroy(dec);
+	free(signalBits);
+	free(message);
+	free(app);
+	free(ext);
+}
+
+/**
+ * Leave out some of the parity, as 802.11 puncturing does, and some
+ * erased bits, and decode what is left
+ */
+static void testPunctured() {
+	LdpcEncoder *enc = ldpcEncoderCreate(&c12_648);
+	LdpcDecoder *dec = ldpcDecoderCreate(&c12_648);
+	uint8_t *message = makeMessageBits(324);
+	uint8_t *x = ldpcEncode(enc, message, 324);
+	uint8_t *erased = (uint8_t *) calloc(648, sizeof(uint8_t));
+	for (int i = 648 - 40; i < 648; i++) {
+		erased[i] = 1;
+	}
+	for (int i = 5; i < 324; i += 37) {
+		erased[i] = 1;
+	}
+	float *received = (float *) malloc(648 * sizeof(float));
+	int nrReceived = 0;
+	for (int i = 0; i < 648; i++) {
+		if (!erased[i]) {
+			received[nrReceived++] = x[i] ? -1.0f : 1.0f;
+		}
+	}
+	received[3] = -received[3] * 0.5f;
+	uint8_t *result = ldpcDecodePuncturedMS(dec, received, nrReceived, erased, 100);
+	CU_ASSERT_PTR_NOT_NULL_FATAL(result);
+	for (int i = 0; i < 648; i++) {
+		CU_ASSERT_EQUAL(result[i], x[i]);
+	}
+	result = ldpcDecodePuncturedSP(dec, received, nrReceived, erased, 100);
+	CU_ASSERT_PTR_NOT_NULL_FATAL(result);
+	for (int i = 0; i < 648; i++) {
+		CU_ASSERT_EQUAL(result[i], x[i]);
+	}
+	CU_ASSERT_PTR_NULL(ldpcDecodePuncturedMS(dec, received, nrReceived - 1, erased, 100));
+	CU_ASSERT_PTR_NULL(ldpcDecodePuncturedMS(dec, received, nrReceived + 1, erased, 100));
+	ldpcEncoderDestroy(enc);
+	ldpcDecoderDestroy(dec);
+	free(received);
+	free(erased);
+	free(message);
+}
+
+/**
+ * Send a short payload in a long codeword, leaving out the shortened
+ * bits, and decode it.  Then decode a whole word with the same decoder.
+ */
+static void testShortened() {
+	LdpcEncoder *enc = ldpcEncoderCreate(&c12_1944);
+	LdpcDecoder *dec = ldpcDecoderCreate(&c12_1944);
+	int sent = 200;
+	int nrShortened = 972 - sent;
+	uint8_t *message = makeMessageBits(sent);
+	uint8_t *x = ldpcEncode(enc, message, sent);
+	float *signalBits = makeSignal(x, 1944);
+	float *received = (float *) malloc(1944 * sizeof(float));
+	for (int i = 0; i < sent; i++) {
+		received[i] = signalBits[i];
+	}
+	for (int i = 972; i < 1944; i++) {
+		received[i - nrShortened] = signalBits[i];
+	}
+	received[17] = -received[17] * 0.5f;
+	received[500] = -received[500] * 0.5f;
+	for (int pass = 0; pass < 2; pass++) {
+		uint8_t *result = pass ?
+			ldpcDecodeShortenedSP(dec, received, nrShortened, 100) :
+			ldpcDecodeShortenedMS(dec, received, nrShortened, 100);
+		CU_ASSERT_PTR_NOT_NULL_FATAL(result);
+		CU_ASSERT(dec->iterations > 0);
+		for (int i = 0; i < 1944; i++) {
+			CU_ASSERT_EQUAL(result[i], x[i]);
+		}
+	}
+	signalBits[17] = -signalBits[17] * 0.5f;
+	uint8_t *result = ldpcDecodeMS(dec, signalBits, 1944, 100);
+	CU_ASSERT_PTR_NOT_NULL_FATAL(result);
+	for (int i = 0; i < 1944; i++) {
+		CU_ASSERT_EQUAL(result[i], x[i]);
+	}
+	CU_ASSERT_PTR_NULL(ldpcDecodeShortenedMS(dec, received, 973, 100));
+	ldpcEncoderDestroy(enc);
+	ldpcDecoderDestroy(dec);
+	free(received);
+	free(signalBits);
+	free(message);
+}
+
+/**
+ * A few weak errors should be fixed by bit flipping alone, and more
+ * should go on to min-sum, unless that is turned off
+ */
+static void testBitFlip() {
+	LdpcEncoder *enc = ldpcEncoderCreate(&c12_648);
+	LdpcDecoder *dec = ldpcDecoderCreate(&c12_648);
+	uint8_t *message = makeMessageBits(324);
+	uint8_t *x = ldpcEncode(enc, message, 324);
+	float *signalBits = makeSignal(x, 648);
+
+	uint8_t *result = ldpcDecode(dec, signalBits, 648, 50);
+	CU_ASSERT_PTR_NOT_NULL_FATAL(result);
+	CU_ASSERT_EQUAL(dec->stage, LDPC_STAGE_HARD);
+	CU_ASSERT_EQUAL(dec->flips, 0);
+
+	signalBits[5] = -0.3f * signalBits[5];
+	signalBits[400] = -0.3f * signalBits[400];
+	result = ldpcDecodeBF(dec, signalBits, 648, 16);
+	CU_ASSERT_PTR_NOT_NULL_FATAL(result);
+	CU_ASSERT_EQUAL(dec->flips, 2);
+	for (int i = 0; i < 648; i++) {
+		CU_ASSERT_EQUAL(result[i], x[i]);
+	}
+	result = ldpcDecode(dec, signalBits, 648, 50);
+	CU_ASSERT_PTR_NOT_NULL_FATAL(result);
+	CU_ASSERT_EQUAL(dec->stage, LDPC_STAGE_BF);
+
+	for (int i = 0; i < 648; i += 32) {
+		signalBits[i] = -0.2f * signalBits[i];
+	}
+	dec->bfMaxFlips = 4;
+	result = ldpcDecode(dec, signalBits, 648, 50);
+	CU_ASSERT_PTR_NOT_NULL_FATAL(result);
+	CU_ASSERT_EQUAL(dec->stage, LDPC_STAGE_MS);
+	for (int i = 0; i < 648; i++) {
+		CU_ASSERT_EQUAL(result[i], x[i]);
+	}
+	dec->bfFallback = 0;
+	result = ldpcDecode(dec, signalBits, 648, 50);
+	CU_ASSERT_PTR_NULL(result);
+	CU_ASSERT_EQUAL(dec->stage, LDPC_STAGE_FAILED);
+
+	CU_ASSERT_EQUAL(dec->stageCounts[LDPC_STAGE_HARD], 1);
+	CU_ASSERT_EQUAL(dec->stageCounts[LDPC_STAGE_BF], 1);
+	CU_ASSERT_EQUAL(dec->stageCounts[LDPC_STAGE_MS], 1);
+	CU_ASSERT_EQUAL(dec->stageCounts[LDPC_STAGE_FAILED], 1);
+	ldpcEncoderDestroy(enc);
+	ldpcDecoderDestroy(dec);
+	free(signalBits);
+	free(message);
+}
+
+/**
+ * With a CRC set, a word that bit flipping takes to the wrong codeword
+ * should go on to min-sum, which starts again from the channel.  The wrong
+ * codeword is the right one plus a codeword of weight 11, whose one message
+ * bit is under the CRC.  That bit and all but one of its parity bits lean
+ * weakly to the wrong codeword, so a single flip gets there, but the last
+ * parity bit leans to the right one strongly enough for min-sum.
+ */
+static void testBitFlipWrongWord() {
+	LdpcEncoder *enc = ldpcEncoderCreate(&c34_648);
+	LdpcDecoder *dec = ldpcDecoderCreate(&c34_648);
+	uint8_t bytes[60];
+	for (int i = 0; i < 56; i++) {
+		bytes[i] = (uint8_t)(i * 11 + 5);
+	}
+	uint8_t x[648];
+	memcpy(x, ldpcEncodeBytesCrc(enc, bytes, 56, bytes + 56), sizeof(x));
+	uint8_t unit[486];
+	memset(unit, 0, sizeof(unit));
+	unit[432] = 1;
+	uint8_t *low = ldpcEncode(enc, unit, 486);
+	int weight = 0;
+	int strong = -1;
+	for (int i = 0; i < 648; i++) {
+		weight += low[i];
+		if (low[i] && i >= 486 && strong < 0) {
+			strong = i;
+		}
+	}
+	CU_ASSERT_EQUAL_FATAL(weight, 11);
+	float signalBits[648];
+	for (int i = 0; i < 648; i++) {
+		float mag = !low[i] ? 1.0f : i == strong ? 0.9f : 0.05f;
+		uint8_t bit = i == strong ? x[i] : x[i] ^ low[i];
+		signalBits[i] = bit ? -mag : mag;
+	}
+	CU_ASSERT_EQUAL_FATAL(ldpcDecoderSetCrc(dec, 448, 56), 1);
+
+	CU_ASSERT_PTR_NULL(ldpcDecodeBF(dec, signalBits, 648, 16));
+	CU_ASSERT_EQUAL(dec->status, LDPC_BAD_CRC);
+	CU_ASSERT_EQUAL(dec->flips, 1);
+	uint8_t *result = ldpcDecode(dec, signalBits, 648, 50);
+	CU_ASSERT_PTR_NOT_NULL_FATAL(result);
+	CU_ASSERT_EQUAL(dec->status, LDPC_OK);
+	CU_ASSERT_EQUAL(dec->stage, LDPC_STAGE_MS);
+	for (int i = 0; i < 480; i++) {
+		CU_ASSERT_EQUAL(result[i], x[i]);
+	}
+	ldpcEncoderDestroy(enc);
+	ldpcDecoderDestroy(dec);
+}
+
+/**
+ * The inversion function kept up to date flip by flip should be what it
+ * comes to worked out afresh from the hard decisions
+ */
+static void testFlipMetric() {
+	LdpcEncoder *enc = ldpcEncoderCreate(&c12_648);
+	LdpcDecoder *dec = ldpcDecoderCreate(&c12_648);
+	Table *table = dec->table;
+	uint8_t *message = makeMessageBits(324);
+	uint8_t *x = ldpcEncode(enc, message, 324);
+	float *signalBits = makeSignal(x, 648);
+	for (int i = 0; i < 648; i += 9) {
+		signalBits[i] = -0.3f * signalBits[i];
+	}
+	for (int maxFlips = 1; maxFlips <= 12; maxFlips++) {
+		ldpcDecodeBF(dec, signalBits, 648, maxFlips);
+		CU_ASSERT_EQUAL(dec->flips, maxFlips);
+		for (int i = 0; i < 648; i++) {
+			float xy = dec->syndrome[i] ? -signalBits[i] : signalBits[i];
+			int *checks = table->S[i];
+			int sum = 0;
+			for (int j = 1; j <= checks[0]; j++) {
+				int *row = table->H[checks[j]];
+				int parity = 0;
+				for (int k = 1; k <= row[0]; k++) {
+					parity ^= dec->syndrome[row[k]];
+				}
+				sum += parity ? -1 : 1;
+			}
+			CU_ASSERT_DOUBLE_EQUAL(dec->flipMetric[i], xy + sum, 0.0001);
+		}
+	}
+	ldpcEncoderDestroy(enc);
+	ldpcDecoderDestroy(dec);
+	free(signalBits);
+	free(message);
+}
+
+/**
+ * The column schedule should decode what flooding does, and, using each
+ * fresh message at once, in fewer iterations overall
+ */
+static void testColumnSchedule() {
+	LdpcEncoder *enc = ldpcEncoderCreate(&c12_1296);
+	LdpcDecoder *dec = ldpcDecoderCreate(&c12_1296);
+	int flooding = 0;
+	int column = 0;
+	for (int n = 0; n < 10; n++) {
+		uint8_t *message = makeMessageBits(648);
+		uint8_t *x = ldpcEncode(enc, message, 648);
+		float *signalBits = makeSignal(x, 1296);
+		addNoise(signalBits, 1296, 2.6);
+		for (int sp = 0; sp < 2; sp++) {
+			for (int schedule = 0; schedule < 2; schedule++) {
+				dec->schedule = schedule ? LDPC_SCHEDULE_COLUMN : LDPC_SCHEDULE_FLOODING;
+				uint8_t *result = sp ? ldpcDecodeSP(dec, signalBits, 1296, 100) :
+					ldpcDecodeMS(dec, signalBits, 1296, 100);
+				CU_ASSERT_PTR_NOT_NULL_FATAL(result);
+				for (int i = 0; i < 1296; i++) {
+					CU_ASSERT_EQUAL(result[i], x[i]);
+				}
+				if (schedule) {
+					column += dec->iterations;
+				} else {
+					flooding += dec->iterations;
+				}
+			}
+		}
+		free(signalBits);
+		free(message);
+	}
+	CU_ASSERT(column < flooding);
+	ldpcEncoderDestroy(enc);
+	ldpcDecoderDestroy(dec);
+}
+
+/**
+ * The residual schedule should decode what flooding does by sum-product,
+ * in fewer check node updates, and should refuse min-sum
+ */
+static void testResidualSchedule() {
+	LdpcEncoder *enc = ldpcEncoderCreate(&c12_1296);
+	LdpcDecoder *dec = ldpcDecoderCreate(&c12_1296);
+	int flooding = 0;
+	int residual = 0;
+	for (int n = 0; n < 5; n++) {
+		uint8_t *message = makeMessageBits(648);
+		uint8_t *x = ldpcEncode(enc, message, 648);
+		float *signalBits = makeSignal(x, 1296);
+		addNoise(signalBits, 1296, 2.6);
+		dec->schedule = LDPC_SCHEDULE_FLOODING;
+		uint8_t *result = ldpcDecodeSP(dec, signalBits, 1296, 100);
+		CU_ASSERT_PTR_NOT_NULL_FATAL(result);
+		flooding += dec->iterations * 648;
+		dec->schedule = LDPC_SCHEDULE_RESIDUAL;
+		result = ldpcDecodeSP(dec, signalBits, 1296, 100);
+		CU_ASSERT_PTR_NOT_NULL_FATAL(result);
+		for (int i = 0; i < 1296; i++) {
+			CU_ASSERT_EQUAL(result[i], x[i]);
+		}
+		CU_ASSERT(dec->updates <= dec->iterations * 648);
+		residual += dec->updates;
+		CU_ASSERT_PTR_NULL(ldpcDecodeMS(dec, signalBits, 1296, 100));
+		CU_ASSERT_EQUAL(dec->status, LDPC_BAD_OPTIONS);
+		free(signalBits);
+		free(message);
+	}
+	CU_ASSERT(residual < flooding);
+	ldpcEncoderDestroy(enc);
+	ldpcDecoderDestroy(dec);
+}
+
+/**
+ * Self-corrected min-sum should decode what min-sum does
+ */
+static void testSelfCorrected() {
+	LdpcEncoder *enc = ldpcEncoderCreate(&c12_1296);
+	LdpcDecoder *dec = ldpcDecoderCreate(&c12_1296);
+	uint8_t *message = makeMessageBits(648);
+	uint8_t *x = ldpcEncode(enc, message, 648);
+	float *signalBits = makeSignal(x, 1296);
+	addNoise(signalBits, 1296, 2.6);
+	dec->selfCorrect = 1;
+	for (int schedule = 0; schedule < 2; schedule++) {
+		dec->schedule = (LdpcSchedule) schedule;
+		uint8_t *result = ldpcDecodeMS(dec, signalBits, 1296, 100);
+		CU_ASSERT_PTR_NOT_NULL_FATAL(result);
+		for (int i = 0; i < 1296; i++) {
+			CU_ASSERT_EQUAL(result[i], x[i]);
+		}
+		// there is no self-corrected sum-product
+		CU_ASSERT_PTR_NULL(ldpcDecodeSP(dec, signalBits, 1296, 100));
+		CU_ASSERT_EQUAL(dec->status, LDPC_BAD_OPTIONS);
+	}
+	// nor is there under the row schedule, which keeps no q
+	dec->schedule = LDPC_SCHEDULE_ROW;
+	CU_ASSERT_PTR_NULL(ldpcDecodeMS(dec, signalBits, 1296, 100));
+	CU_ASSERT_EQUAL(dec->status, LDPC_BAD_OPTIONS);
+	CU_ASSERT_PTR_NULL(ldpcDecode(dec, signalBits, 1296, 100));
+	CU_ASSERT_EQUAL(dec->status, LDPC_BAD_OPTIONS);
+	ldpcEncoderDestroy(enc);
+	ldpcDecoderDestroy(dec);
+	free(signalBits);
+	free(message);
+}
+
+/**
+ * The row schedule should decode what flooding does, in fewer iterations
+ * overall, in the natural layer order as well as the optimized one
+ */
+static void testRowSchedule() {
+	LdpcEncoder *enc = ldpcEncoderCreate(&c12_1296);
+	LdpcDecoder *dec = ldpcDecoderCreate(&c12_1296);
+	int flooding = 0;
+	int row = 0;
+	for (int n = 0; n < 10; n++) {
+		uint8_t *message = makeMessageBits(648);
+		uint8_t *x = ldpcEncode(enc, message, 648);
+		float *signalBits = makeSignal(x, 1296);
+		addNoise(signalBits, 1296, 2.6);
+		for (int sp = 0; sp < 2; sp++) {
+			ldpcDecoderSetLayers(dec, n & 1);
+			dec->schedule = LDPC_SCHEDULE_FLOODING;
+			uint8_t *result = sp ? ldpcDecodeSP(dec, signalBits, 1296, 100) :
+				ldpcDecodeMS(dec, signalBits, 1296, 100);
+			CU_ASSERT_PTR_NOT_NULL_FATAL(result);
+			flooding += dec->iterations;
+			dec->schedule = LDPC_SCHEDULE_ROW;
+			result = sp ? ldpcDecodeSP(dec, signalBits, 1296, 100) :
+				ldpcDecodeMS(dec, signalBits, 1296, 100);
+			CU_ASSERT_PTR_NOT_NULL_FATAL(result);
+			for (int i = 0; i < 1296; i++) {
+				CU_ASSERT_EQUAL(result[i], x[i]);
+			}
+			row += dec->iterations;
+		}
+		free(signalBits);
+		free(message);
+	}
+	CU_ASSERT(row < flooding);
+	ldpcEncoderDestroy(enc);
+	ldpcDecoderDestroy(dec);
+}
+
+/**
+ * Saved messages should go back to the same edges after the layer order,
+ * and with it the order of each check node's links, has changed
+ */
+static void testSaveAcrossLayers() {
+	LdpcEncoder *enc = ldpcEncoderCreate(&c12_648);
+	LdpcDecoder *dec = ldpcDecoderCreate(&c12_648);
+	LdpcDecoder *fixed = ldpcDecoderCreate(&c12_648);
+	uint8_t *message = makeMessageBits(324);
+	uint8_t *x = ldpcEncode(enc, message, 324);
+	float *signalBits = makeSignal(x, 648);
+	addNoise(signalBits, 648, 3.0);
+	int nrEdges = dec->kernel->nrEdges;
+	float *saved1 = (float *) malloc(nrEdges * sizeof(float));
+	float *saved2 = (float *) malloc(nrEdges * sizeof(float));
+	float app1[648];
+	float app2[648];
+	ldpcDecoderSetLayers(dec, 0);
+	ldpcDecoderSetLayers(fixed, 0);
+	ldpcDecodeMS(dec, signalBits, 648, 2);
+	CU_ASSERT_EQUAL(dec->fastPath, 0);
+	ldpcDecoderSaveMessages(dec, saved1);
+	ldpcDecoderSetLayers(dec, 1);
+	// back out as they went in
+	ldpcDecoderWarmStart(dec, saved1);
+	ldpcDecodeMS(dec, signalBits, 648, 0);
+	ldpcDecoderSaveMessages(dec, saved2);
+	CU_ASSERT_EQUAL(memcmp(saved1, saved2, nrEdges * sizeof(float)), 0);
+	// and carrying on from them is the same as where the links never moved
+	ldpcDecoderWarmStart(dec, saved1);
+	ldpcDecoderWarmStart(fixed, saved1);
+	uint8_t *r1 = ldpcDecodeSoftMS(dec, signalBits, 648, 3, app1, (float *)0);
+	uint8_t *r2 = ldpcDecodeSoftMS(fixed, signalBits, 648, 3, app2, (float *)0);
+	CU_ASSERT_EQUAL(r1 == 0, r2 == 0);
+	CU_ASSERT_EQUAL(dec->iterations, fixed->iterations);
+	int same = 1;
+	for (int i = 0; i < 648; i++) {
+		same &= app1[i] == app2[i];
+	}
+	CU_ASSERT(same);
+	free(saved1);
+	free(saved2);
+	ldpcEncoderDestroy(enc);
+	ldpcDecoderDestroy(dec);
+	ldpcDecoderDestroy(fixed);
+	free(signalBits);
+	free(message);
+}
+
+/**
+ * Min-sum with compressed check node messages should match the row
+ * schedule with full messages, bit for bit, and so should the messages
+ * that it saves
+ */
+static void testCompressed() {
+	LdpcEncoder *enc = ldpcEncoderCreate(&c56_1944);
+	LdpcDecoder *full = ldpcDecoderCreate(&c56_1944);
+	LdpcDecoder *dec = ldpcDecoderCreate(&c56_1944);
+	full->schedule = LDPC_SCHEDULE_ROW;
+	dec->schedule = LDPC_SCHEDULE_ROW;
+	dec->compressed = 1;
+	uint8_t *message = makeMessageBits(1620);
+	uint8_t *x = ldpcEncode(enc, message, 1620);
+	float *signalBits = makeSignal(x, 1944);
+	addNoise(signalBits, 1944, 2.1);
+	float app1[1944];
+	float app2[1944];
+	int nrEdges = dec->kernel->nrEdges;
+	float *saved1 = (float *) malloc(nrEdges * sizeof(float));
+	float *saved2 = (float *) malloc(nrEdges * sizeof(float));
+	for (int maxIter = 1; maxIter <= 3; maxIter++) {
+		uint8_t *r1 = ldpcDecodeSoftMS(full, signalBits, 1944, maxIter, app1, (float *)0);
+		uint8_t *r2 = ldpcDecodeSoftMS(dec, signalBits, 1944, maxIter, app2, (float *)0);
+		CU_ASSERT_EQUAL(r1 == 0, r2 == 0);
+		CU_ASSERT_EQUAL(full->fastPath, 0);
+		CU_ASSERT_EQUAL(full->iterations, dec->iterations);
+		CU_ASSERT_EQUAL(memcmp(app1, app2, sizeof(app1)), 0);
+		ldpcDecoderSaveMessages(full, saved1);
+		ldpcDecoderSaveMessages(dec, saved2);
+		int same = 1;
+		for (int e = 0; e < nrEdges; e++) {
+			same &= saved1[e] == saved2[e];
+		}
+		CU_ASSERT(same);
+	}
+	// shortened, with the pinned columns left out
+	int nrShortened = 600;
+	float *received = (float *) malloc(1944 * sizeof(float));
+	for (int i = 0; i < 1944 - nrShortened; i++) {
+		received[i] = signalBits[i < 1620 - nrShortened ? i : i + nrShortened];
+	}
+	for (int maxIter = 1; maxIter <= 3; maxIter++) {
+		uint8_t *r1 = ldpcDecodeShortenedMS(full, received, nrShortened, maxIter);
+		uint8_t *r2 = ldpcDecodeShortenedMS(dec, received, nrShortened, maxIter);
+		CU_ASSERT_EQUAL(r1 == 0, r2 == 0);
+		CU_ASSERT_EQUAL(full->iterations, dec->iterations);
+		ldpcDecoderSaveMessages(full, saved1);
+		ldpcDecoderSaveMessages(dec, saved2);
+		int same = 1;
+		for (int e = 0; e < nrEdges; e++) {
+			same &= saved1[e] == saved2[e];
+		}
+		CU_ASSERT(same);
+	}
+	free(received);
+	free(saved1);
+	free(saved2);
+	uint8_t *result = ldpcDecodeMS(dec, signalBits, 1944, 100);
+	CU_ASSERT_PTR_NOT_NULL_FATAL(result);
+	for (int i = 0; i < 1944; i++) {
+		CU_ASSERT_EQUAL(result[i], x[i]);
+	}
+	// it is refused for sum-product, and under the other schedules
+	CU_ASSERT_PTR_NULL(ldpcDecodeSP(dec, signalBits, 1944, 100));
+	CU_ASSERT_EQUAL(dec->status, LDPC_BAD_OPTIONS);
+	for (int schedule = 0; schedule < 3; schedule++) {
+		dec->schedule = schedule;
+		CU_ASSERT_PTR_NULL(ldpcDecodeMS(dec, signalBits, 1944, 100));
+		CU_ASSERT_EQUAL(dec->status, LDPC_BAD_OPTIONS);
+		CU_ASSERT_PTR_NULL(ldpcDecode(dec, signalBits, 1944, 100));
+		CU_ASSERT_EQUAL(dec->status, LDPC_BAD_OPTIONS);
+	}
+	ldpcEncoderDestroy(enc);
+	ldpcDecoderDestroy(full);
+	ldpcDecoderDestroy(dec);
+	free(signalBits);
+	free(message);
+}
+
+/**
+ * 16-bit message storage should decode the same noisy words, by both
+ * sum-product and min-sum
+ */
+static void testHalfMessages() {
+	LdpcEncoder *enc = ldpcEncoderCreate(&c12_1296);
+	LdpcDecoder *dec = ldpcDecoderCreate(&c12_1296);
+	dec->schedule = LDPC_SCHEDULE_ROW;
+	LdpcMessageFormat formats[] = { LDPC_MESSAGES_FP16, LDPC_MESSAGES_BF16 };
+	int nrEdges = 0;
+	for (int i = 0; i < dec->code->M; i++) {
+		nrEdges += dec->table->H[i][0];
+	}
+	for (int n = 0; n < 4; n++) {
+		uint8_t *message = makeMessageBits(648);
+		uint8_t *x = ldpcEncode(enc, message, 648);
+		float *signalBits = makeSignal(x, 1296);
+		addNoise(signalBits, 1296, 2.6);
+		for (int f = 0; f < 2; f++) {
+			dec->messageFormat = formats[f];
+			for (int sp = 0; sp < 2; sp++) {
+				uint8_t *result = sp ? ldpcDecodeSP(dec, signalBits, 1296, 100) :
+					ldpcDecodeMS(dec, signalBits, 1296, 100);
+				CU_ASSERT_EQUAL(dec->fastPath, 0);
+				CU_ASSERT_PTR_NOT_NULL_FATAL(result);
+				for (int i = 0; i < 1296; i++) {
+					CU_ASSERT_EQUAL(result[i], x[i]);
+				}
+			}
+			// every stored message is a value of the format, and is what
+			// is saved for a warm start
+			uint16_t *stored = dec->halfMessages;
+			float saved[4752];
+			ldpcDecoderSaveMessages(dec, saved);
+			for (int k = 0; k < nrEdges; k++) {
+				float r = f ? bf16ToFloat(stored[k]) : halfToFloat(stored[k]);
+				CU_ASSERT_FALSE(isnan(r));
+				CU_ASSERT_EQUAL(f ? bf16FromFloat(r) : halfFromFloat(r), stored[k]);
+				CU_ASSERT_EQUAL(saved[k], r);
+			}
+		}
+		free(signalBits);
+		free(message);
+	}
+	// they are kept only under the row schedule, and refused under the others
+	float signalBits[1296];
+	for (int i = 0; i < 1296; i++) {
+		signalBits[i] = 1.0;
+	}
+	dec->bfMaxFlips = 10;
+	for (int schedule = 0; schedule < 3; schedule++) {
+		dec->schedule = schedule;
+		CU_ASSERT_PTR_NULL(ldpcDecodeSP(dec, signalBits, 1296, 10));
+		CU_ASSERT_EQUAL(dec->status, LDPC_BAD_OPTIONS);
+		CU_ASSERT_PTR_NULL(ldpcDecodeMS(dec, signalBits, 1296, 10));
+		CU_ASSERT_EQUAL(dec->status, LDPC_BAD_OPTIONS);
+		CU_ASSERT_PTR_NULL(ldpcDecode(dec, signalBits, 1296, 10));
+		CU_ASSERT_EQUAL(dec->status, LDPC_BAD_OPTIONS);
+		CU_ASSERT_EQUAL(dec->stage, LDPC_STAGE_FAILED);
+	}
+	dec->messageFormat = LDPC_MESSAGES_FP32;
+	dec->schedule = LDPC_SCHEDULE_FLOODING;
+	CU_ASSERT_PTR_NOT_NULL(ldpcDecodeMS(dec, signalBits, 1296, 10));
+	ldpcEncoderDestroy(enc);
+	ldpcDecoderDestroy(dec);
+}
+
+/**
+ * The generated kernels of each code should match the row schedule
+ * through the graph, bit for bit, in the messages that they save as well
+ */
+static void testSpecialized() {
+	Code *codes[] = {
+		&c12_648, &c12_1296, &c12_1944, &c23_648, &c23_1296, &c23_1944,
+		&c34_648, &c34_1296, &c34_1944, &c56_648, &c56_1296, &c56_1944
+	};
+	for (int c = 0; c < 12; c++) {
+		Code *code = codes[c];
+		int N = code->N;
+		int K = code->messageBits;
+		LdpcEncoder *enc = ldpcEncoderCreate(code);
+		LdpcDecoder *graph = ldpcDecoderCreate(code);
+		LdpcDecoder *dec = ldpcDecoderCreate(code);
+		CU_ASSERT_PTR_NOT_NULL_FATAL(dec->kernel);
+		CU_ASSERT_PTR_EQUAL(dec->kernel->code, code);
+		graph->schedule = LDPC_SCHEDULE_ROW;
+		graph->specialized = 0;
+		dec->schedule = LDPC_SCHEDULE_ROW;
+		ldpcDecoderSetLayers(dec, c & 1);
+		ldpcDecoderSetLayers(graph, c & 1);
+		uint8_t *message = makeMessageBits(K);
+		uint8_t *x = ldpcEncode(enc, message, K);
+		float *signalBits = makeSignal(x, N);
+		addNoise(signalBits, N, 2.1);
+		float app1[1944];
+		float app2[1944];
+		int nrEdges = dec->kernel->nrEdges;
+		float *saved1 = (float *) malloc(nrEdges * sizeof(float));
+		float *saved2 = (float *) malloc(nrEdges * sizeof(float));
+		for (int maxIter = 1; maxIter <= 3; maxIter++) {
+			uint8_t *r1 = ldpcDecodeSoftMS(graph, signalBits, N, maxIter, app1, (float *)0);
+			uint8_t *r2 = ldpcDecodeSoftMS(dec, signalBits, N, maxIter, app2, (float *)0);
+			CU_ASSERT_EQUAL(r1 == 0, r2 == 0);
+			CU_ASSERT_EQUAL(dec->fastPath, 0);
+			CU_ASSERT_EQUAL(graph->iterations, dec->iterations);
+			CU_ASSERT_EQUAL(memcmp(app1, app2, N * sizeof(float)), 0);
+			ldpcDecoderSaveMessages(graph, saved1);
+			ldpcDecoderSaveMessages(dec, saved2);
+			// as numbers: a zero message may be +0 from one and -0 from the other
+			int same = 1;
+			for (int e = 0; e < nrEdges; e++) {
+				same &= saved1[e] == saved2[e];
+			}
+			CU_ASSERT(same);
+		}
+		free(saved1);
+		free(saved2);
+		ldpcEncoderDestroy(enc);
+		ldpcDecoderDestroy(graph);
+		ldpcDecoderDestroy(dec);
+		free(signalBits);
+		free(message);
+	}
+}
+
 int ldpcDecoderSuiteSetup(void)
 {
 	CU_pSuite pSuite = CU_add_suite("LDPC Decoder Spec", NULL, NULL);
@@ -177,7 +1008,25 @@ int ldpcDecoderSuiteSetup(void)
 		(!CU_add_test(pSuite, "should decode test data", testWithTables)) ||
 		(!CU_add_test(pSuite, "should decode what the encoder encodes", testDecodeEncoder)) ||
 		(!CU_add_test(pSuite, "should handle errors", testHandleErrors))  ||
-		(!CU_add_test(pSuite, "should handle errors and noise", testHandleErrorsAndNoise))
+		(!CU_add_test(pSuite, "should handle errors and noise", testHandleErrorsAndNoise)) ||
+		(!CU_add_test(pSuite, "should skip decoding a clean word", testFastPath)) ||
+		(!CU_add_test(pSuite, "should track the syndrome as bits flip", testTrackSyndrome)) ||
+		(!CU_add_test(pSuite, "should give up on a stalled decode", testStall)) ||
+		(!CU_add_test(pSuite, "should stop when the CRC passes", testCrcTermination)) ||
+		(!CU_add_test(pSuite, "should give soft output", testSoftOutput)) ||
+		(!CU_add_test(pSuite, "should decode punctured words", testPunctured)) ||
+		(!CU_add_test(pSuite, "should decode shortened words", testShortened)) ||
+		(!CU_add_test(pSuite, "should fix a few errors by bit flipping", testBitFlip)) ||
+		(!CU_add_test(pSuite, "should go on to min-sum from a wrong codeword", testBitFlipWrongWord)) ||
+		(!CU_add_test(pSuite, "should keep the flip metric up to date", testFlipMetric)) ||
+		(!CU_add_test(pSuite, "should decode by column layers", testColumnSchedule)) ||
+		(!CU_add_test(pSuite, "should decode by largest residual first", testResidualSchedule)) ||
+		(!CU_add_test(pSuite, "should decode by self-corrected min-sum", testSelfCorrected)) ||
+		(!CU_add_test(pSuite, "should decode by row layers", testRowSchedule)) ||
+		(!CU_add_test(pSuite, "should keep saved messages across layer orders", testSaveAcrossLayers)) ||
+		(!CU_add_test(pSuite, "should match with compressed messages", testCompressed)) ||
+		(!CU_add_test(pSuite, "should decode with 16-bit messages", testHalfMessages)) ||
+		(!CU_add_test(pSuite, "should match with generated kernels", testSpecialized))
 		) {
 		return CU_FALSE;
 	}
@@ -4,6 +4,7 @@
 
 #include "ldpcEncoder.h"
 #include "util.h"
+#include "crc32.h"
 
 #include "testdata.h"
 
@@ -28,6 +29,76 @@ static void testCorrectValue(void) {
 }
 
 
+/**
+ * Test that a threaded batch gives the same codewords as encoding
+ * the messages one at a time
+ */
+static void testBatch(void) {
+	LdpcEncoder *enc = ldpcEncoderCreate(&c12_648);
+	int nrBytes = 40;  // 324 message bits, shortened to 320
+	int nrWords = 37;
+	int outBytes = 648 / 8;
+	uint8_t *bytes = (uint8_t *) malloc(nrBytes * nrWords * sizeof(uint8_t));
+	for (int i = 0; i < nrBytes * nrWords; i++) {
+		bytes[i] = (uint8_t)(i * 7 + 3);
+	}
+	uint8_t *out = (uint8_t *) malloc(outBytes * nrWords * sizeof(uint8_t));
+	int res = ldpcEncodeBatch(enc, bytes, nrBytes, nrWords, out, 4);
+	CU_ASSERT_EQUAL_FATAL(res, 1);
+	uint8_t expBytes[81];
+	for (int w = 0; w < nrWords; w++) {
+		uint8_t *x = ldpcEncodeBytes(enc, bytes + w * nrBytes, nrBytes);
+		bitsToBytesBE(expBytes, x, 648);
+		for (int i = 0; i < outBytes; i++) {
+			CU_ASSERT_EQUAL(out[w * outBytes + i], expBytes[i]);
+		}
+	}
+	ldpcEncoderDestroy(enc);
+	free(bytes);
+	free(out);
+}
+
+
+/**
+ * Test that the single pass CRC encode matches appending the CRC
+ * and encoding the bytes
+ */
+static void testEncodeCrc(void) {
+	Code *codes[] = { &c12_648, &c23_1296, &c56_1944 };
+	for (int c = 0; c < 3; c++) {
+		Code *code = codes[c];
+		LdpcEncoder *enc = ldpcEncoderCreate(code);
+		int nrBytes = code->messageBits / 8 - 4 - c * 3;
+		uint8_t *bytes = (uint8_t *) malloc((nrBytes + 4) * sizeof(uint8_t));
+		for (int i = 0; i < nrBytes; i++) {
+			bytes[i] = (uint8_t)(i * 13 + c);
+		}
+		uint8_t crcBytes[4];
+		uint8_t *x = ldpcEncodeBytesCrc(enc, bytes, nrBytes, crcBytes);
+		CU_ASSERT_PTR_NOT_NULL_FATAL(x);
+		uint8_t *res = (uint8_t *) malloc(code->N * sizeof(uint8_t));
+		for (int i = 0; i < code->N; i++) {
+			res[i] = x[i];
+		}
+		uint32_t crc = Crc32ofBytes(bytes, nrBytes);
+		bytes[nrBytes] = (uint8_t)(crc >> 24);
+		bytes[nrBytes + 1] = (uint8_t)(crc >> 16);
+		bytes[nrBytes + 2] = (uint8_t)(crc >> 8);
+		bytes[nrBytes + 3] = (uint8_t)(crc);
+		for (int i = 0; i < 4; i++) {
+			CU_ASSERT_EQUAL(crcBytes[i], bytes[nrBytes + i]);
+		}
+		x = ldpcEncodeBytes(enc, bytes, nrBytes + 4);
+		for (int i = 0; i < code->N; i++) {
+			CU_ASSERT_EQUAL(res[i], x[i]);
+		}
+		ldpcEncoderDestroy(enc);
+		free(bytes);
+		free(res);
+	}
+}
+
+
 int ldpcEncoderSuiteSetup(void)
 {
 	CU_pSuite pSuite = CU_add_suite("LDPC Encoder Spec", NULL, NULL);
@@ -35,7 +106,9 @@ int ldpcEncoderSuiteSetup(void)
 		return CU_FALSE;
 	}
 
-	if ((!CU_add_test(pSuite, "should have the correct value", testCorrectValue))) {
+	if ((!CU_add_test(pSuite, "should have the correct value", testCorrectValue)) ||
+		(!CU_add_test(pSuite, "should encode a batch on many threads", testBatch)) ||
+		(!CU_add_test(pSuite, "should append and encode a CRC in one pass", testEncodeCrc))) {
 		return CU_FALSE;
 	}
 
@@ -6,6 +6,16 @@ extern int crcSuiteSetup(void);
 extern int utilSuiteSetup(void);
 extern int ldpcDecoderSuiteSetup(void);
 extern int ldpcEncoderSuiteSetup(void);
+extern int ppduSuiteSetup(void);
+extern int scramblerSuiteSetup(void);
+extern int codecSuiteSetup(void);
+extern int syndromeSuiteSetup(void);
+extern int harqSuiteSetup(void);
+extern int osdSuiteSetup(void);
+extern int scmsSuiteSetup(void);
+extern int layersSuiteSetup(void);
+extern int halfSuiteSetup(void);
+extern int isaSuiteSetup(void);
 
 
 int main(int argc, char **argv) {
@@ -19,7 +29,17 @@ int main(int argc, char **argv) {
 		crcSuiteSetup() != CU_TRUE ||
 		utilSuiteSetup() != CU_TRUE ||
 		ldpcEncoderSuiteSetup() != CU_TRUE ||
-		ldpcDecoderSuiteSetup() != CU_TRUE
+		ldpcDecoderSuiteSetup() != CU_TRUE ||
+		ppduSuiteSetup() != CU_TRUE ||
+		scramblerSuiteSetup() != CU_TRUE ||
+		codecSuiteSetup() != CU_TRUE ||
+		syndromeSuiteSetup() != CU_TRUE ||
+		harqSuiteSetup() != CU_TRUE ||
+		osdSuiteSetup() != CU_TRUE ||
+		scmsSuiteSetup() != CU_TRUE ||
+		layersSuiteSetup() != CU_TRUE ||
+		halfSuiteSetup() != CU_TRUE ||
+		isaSuiteSetup() != CU_TRUE
 	) {
 		CU_cleanup_registry();
 		return CU_get_error();
@@ -31,4 +51,4 @@ int main(int argc, char **argv) {
    CU_cleanup_registry();
    return CU_get_error();
 
-}
\ No newline at end of file
+}
\ No newline at end of file
@@ -0,0 +1,206 @@
+#include <stdlib.h>
+#include <stdint.h>
+#include <CUnit/Basic.h>
+
+#include "ldpcEncoder.h"
+#include "ldpcDecoder.h"
+#include "osd.h"
+#include "workers.h"
+
+
+/**
+ * Make a codeword, and soft bits for it with nrErrors weak wrong values
+ */
+static float *makeWord(LdpcEncoder *enc, Code *code, int seed, int nrErrors, uint8_t *x) {
+	int K = code->messageBits;
+	int N = code->N;
+	uint8_t *message = (uint8_t *) malloc(K * sizeof(uint8_t));
+	for (int i = 0; i < K; i++) {
+		message[i] = ((i * 7 + seed) * 13 >> 3) & 1;
+	}
+	uint8_t *cw = ldpcEncode(enc, message, K);
+	float *signal = (float *) malloc(N * sizeof(float));
+	for (int i = 0; i < N; i++) {
+		x[i] = cw[i];
+		signal[i] = cw[i] ? -1.0f : 1.0f;
+	}
+	for (int i = 0; i < nrErrors; i++) {
+		int idx = (i * 97 + seed * 31) % N;
+		signal[idx] = -0.1f * signal[idx];
+	}
+	free(message);
+	return signal;
+}
+
+static void testConstruct(void) {
+	LdpcOsd *osd = ldpcOsdCreate(&c12_648);
+	CU_ASSERT_PTR_NOT_NULL_FATAL(osd);
+	CU_ASSERT_EQUAL(osd->order, 2);
+	CU_ASSERT_EQUAL(osd->rowWords, 11);
+	CU_ASSERT_EQUAL(osd->colWords, 6);
+	ldpcOsdDestroy(osd);
+}
+
+static void testWeakErrors(void) {
+	LdpcEncoder *enc = ldpcEncoderCreate(&c12_648);
+	LdpcOsd *osd = ldpcOsdCreate(&c12_648);
+	uint8_t x[648];
+	float *signal = makeWord(enc, &c12_648, 3, 40, x);
+	uint8_t *out = ldpcOsdDecode(osd, signal, 648);
+	CU_ASSERT_PTR_NOT_NULL_FATAL(out);
+	CU_ASSERT_EQUAL(osd->rank, 324);
+	CU_ASSERT_EQUAL(osd->nrBasis, 324);
+	CU_ASSERT_FALSE(osd->timedOut);
+	CU_ASSERT(osd->candidates > 1);
+	for (int i = 0; i < 648; i++) {
+		CU_ASSERT_EQUAL(out[i], x[i]);
+	}
+	CU_ASSERT_DOUBLE_EQUAL(osd->discrepancy, 40 * 0.1f, 0.001);
+
+	// order 0 alone also gets it, the errors all being pivots
+	osd->maxCandidates = 1;
+	out = ldpcOsdDecode(osd, signal, 648);
+	CU_ASSERT_PTR_NOT_NULL_FATAL(out);
+	CU_ASSERT_EQUAL(osd->candidates, 1);
+	for (int i = 0; i < 648; i++) {
+		CU_ASSERT_EQUAL(out[i], x[i]);
+	}
+	ldpcEncoderDestroy(enc);
+	ldpcOsdDestroy(osd);
+	free(signal);
+}
+
+/**
+ * A weak wrong bit in the basis needs order 1
+ */
+static void testOrderOne(void) {
+	LdpcEncoder *enc = ldpcEncoderCreate(&c12_648);
+	LdpcOsd *osd = ldpcOsdCreate(&c12_648);
+	uint8_t x[648];
+	float *signal = makeWord(enc, &c12_648, 5, 0, x);
+	// weaken two thirds of the bits, so that the pivots fall on them,
+	// and the one wrong bit, left strong, lands in the basis
+	for (int i = 0; i < 648; i++) {
+		if (i % 3) {
+			signal[i] *= 0.5f;
+		}
+	}
+	signal[102] = x[102] ? 0.9f : -0.9f;
+	osd->order = 0;
+	uint8_t *out = ldpcOsdDecode(osd, signal, 648);
+	CU_ASSERT_PTR_NOT_NULL_FATAL(out);
+	int wrong = 0;
+	for (int i = 0; i < 648; i++) {
+		wrong += out[i] != x[i];
+	}
+	CU_ASSERT(wrong > 0);
+	osd->order = 1;
+	out = ldpcOsdDecode(osd, signal, 648);
+	CU_ASSERT_PTR_NOT_NULL_FATAL(out);
+	for (int i = 0; i < 648; i++) {
+		CU_ASSERT_EQUAL(out[i], x[i]);
+	}
+	ldpcEncoderDestroy(enc);
+	ldpcOsdDestroy(osd);
+	free(signal);
+}
+
+static void testBudget(void) {
+	LdpcEncoder *enc = ldpcEncoderCreate(&c34_1944);
+	LdpcOsd *osd = ldpcOsdCreate(&c34_1944);
+	uint8_t x[1944];
+	float *signal = makeWord(enc, &c34_1944, 7, 10, x);
+	osd->budgetUs = 1;
+	uint8_t *out = ldpcOsdDecode(osd, signal, 1944);
+	CU_ASSERT_PTR_NULL(out);
+	CU_ASSERT_EQUAL(osd->timedOut, 1);
+	ldpcEncoderDestroy(enc);
+	ldpcOsdDestroy(osd);
+	free(signal);
+}
+
+/**
+ * Min-sum with no iterations fails, and leaves the input as its soft output
+ */
+static void testDecoderStage(void) {
+	LdpcEncoder *enc = ldpcEncoderCreate(&c12_648);
+	LdpcDecoder *dec = ldpcDecoderCreate(&c12_648);
+	LdpcOsd *osd = ldpcOsdCreate(&c12_648);
+	uint8_t x[648];
+	float *signal = makeWord(enc, &c12_648, 9, 30, x);
+	dec->bfMaxFlips = 0;
+	uint8_t *bits = ldpcDecode(dec, signal, 648, 0);
+	CU_ASSERT_PTR_NULL(bits);
+	CU_ASSERT_EQUAL(dec->stage, LDPC_STAGE_FAILED);
+	dec->osd = osd;
+	bits = ldpcDecode(dec, signal, 648, 0);
+	CU_ASSERT_PTR_NOT_NULL_FATAL(bits);
+	CU_ASSERT_EQUAL(dec->stage, LDPC_STAGE_OSD);
+	CU_ASSERT_EQUAL(dec->status, LDPC_OK);
+	for (int i = 0; i < 648; i++) {
+		CU_ASSERT_EQUAL(bits[i], x[i]);
+	}
+	CU_ASSERT_EQUAL(dec->stageCounts[LDPC_STAGE_OSD], 1);
+	ldpcEncoderDestroy(enc);
+	ldpcDecoderDestroy(dec);
+	ldpcOsdDestroy(osd);
+	free(signal);
+}
+
+typedef struct {
+	LdpcOsd *osd[2];
+	float *signal[2];
+	uint8_t *out[2];
+} ThreadJob;
+
+static void osdWorker(void *ctx, int worker, int start, int end) {
+	ThreadJob *job = (ThreadJob *) ctx;
+	for (int i = start; i < end; i++) {
+		job->out[i] = ldpcOsdDecode(job->osd[i], job->signal[i], 648);
+	}
+}
+
+/**
+ * Contexts share nothing but the code, so each thread can run its own
+ */
+static void testThreads(void) {
+	LdpcEncoder *enc = ldpcEncoderCreate(&c12_648);
+	ThreadJob job;
+	uint8_t x[2][648];
+	for (int i = 0; i < 2; i++) {
+		job.osd[i] = ldpcOsdCreate(&c12_648);
+		job.signal[i] = makeWord(enc, &c12_648, 11 + i, 25, x[i]);
+	}
+	workersRun(osdWorker, &job, 2, 2);
+	for (int i = 0; i < 2; i++) {
+		CU_ASSERT_PTR_NOT_NULL_FATAL(job.out[i]);
+		for (int j = 0; j < 648; j++) {
+			CU_ASSERT_EQUAL(job.out[i][j], x[i][j]);
+		}
+		ldpcOsdDestroy(job.osd[i]);
+		free(job.signal[i]);
+	}
+	ldpcEncoderDestroy(enc);
+}
+
+
+int osdSuiteSetup(void)
+{
+	CU_pSuite pSuite = CU_add_suite("LDPC OSD Spec", NULL, NULL);
+	if (!pSuite) {
+		return CU_FALSE;
+	}
+
+	if (
+		(!CU_add_test(pSuite, "should construct properly", testConstruct)) ||
+		(!CU_add_test(pSuite, "should fix weak errors", testWeakErrors)) ||
+		(!CU_add_test(pSuite, "should flip basis bits", testOrderOne)) ||
+		(!CU_add_test(pSuite, "should keep to its budget", testBudget)) ||
+		(!CU_add_test(pSuite, "should run after a failed decode", testDecoderStage)) ||
+		(!CU_add_test(pSuite, "should run on its own thread", testThreads))
+		) {
+		return CU_FALSE;
+	}
+
+	return CU_TRUE;
+}
@@ -0,0 +1,169 @@
+#include <stdlib.h>
+#include <stdint.h>
+#include <CUnit/Basic.h>
+
+#include "802-ppdu.h"
+#include "util.h"
+
+#include "testdata.h"
+
+
+/**
+ * The parameters given with the example in Annex G
+ */
+static void testParams(void) {
+	PpduParams p;
+	int res = ppduParamsInit(&p, 100, 208, 3, 4, 1);
+	CU_ASSERT_EQUAL_FATAL(res, 1);
+	CU_ASSERT_EQUAL(p.nPld, 816);
+	CU_ASSERT_EQUAL(p.nCw, 1);
+	CU_ASSERT_EQUAL(p.lLdpc, 1944);
+	CU_ASSERT_EQUAL(p.nAvbits, 1248);
+	CU_ASSERT_EQUAL(p.nShrt, 642);
+	CU_ASSERT_EQUAL(p.nPunc, 54);
+	CU_ASSERT_EQUAL(p.nSym, 6);
+	CU_ASSERT_EQUAL(p.nRep, 0);
+	CU_ASSERT_PTR_EQUAL(p.code, &c34_1944);
+}
+
+/**
+ * A short frame with more symbol space than it needs gets repetition
+ */
+static void testRepetition(void) {
+	PpduParams p;
+	int res = ppduParamsInit(&p, 60, 312, 5, 6, 1);
+	CU_ASSERT_EQUAL_FATAL(res, 1);
+	CU_ASSERT_EQUAL(p.nCw, 1);
+	CU_ASSERT_EQUAL(p.lLdpc, 648);
+	CU_ASSERT_EQUAL(p.nShrt, 44);
+	CU_ASSERT_EQUAL(p.nPunc, 0);
+	CU_ASSERT_EQUAL(p.nRep, 20);
+	CU_ASSERT_EQUAL(p.nSym, 2);
+
+	int nrBytes = p.nPld / 8;
+	uint8_t *bytes = (uint8_t *) malloc(nrBytes * sizeof(uint8_t));
+	for (int i = 0; i < nrBytes; i++) {
+		bytes[i] = (uint8_t)(i * 13 + 5);
+	}
+	uint8_t *out = (uint8_t *) malloc(p.nAvbits * sizeof(uint8_t));
+	PpduEncoder *penc = ppduEncoderCreate(1);
+	res = ppduEncode(penc, &p, bytes, out);
+	CU_ASSERT_EQUAL_FATAL(res, 1);
+	int sent = p.nAvbits - p.nRep;
+	for (int i = 0; i < p.nRep; i++) {
+		CU_ASSERT_EQUAL(out[sent + i], out[i]);
+	}
+	ppduEncoderDestroy(penc);
+	free(bytes);
+	free(out);
+}
+
+/**
+ * Encoding "scrambled1" (the front of "shortened1") should give the
+ * codeword "encoded1" with the shortened and punctured bits removed
+ */
+static void testCorrectValue(void) {
+	PpduParams p;
+	ppduParamsInit(&p, 100, 208, 3, 4, 1);
+	uint8_t *out = (uint8_t *) malloc(p.nAvbits * sizeof(uint8_t));
+	PpduEncoder *penc = ppduEncoderCreate(1);
+	int res = ppduEncode(penc, &p, shortened1, out);
+	CU_ASSERT_EQUAL_FATAL(res, 1);
+	uint8_t *encoded = (uint8_t *) malloc(1944 * sizeof(uint8_t));
+	bytesToBitsBE(encoded, encoded1, 243);
+	for (int i = 0; i < 816; i++) {
+		CU_ASSERT_EQUAL(out[i], encoded[i]);
+	}
+	for (int i = 816; i < 1248; i++) {
+		CU_ASSERT_EQUAL(out[i], encoded[i + 642]);
+	}
+	ppduEncoderDestroy(penc);
+	free(encoded);
+	free(out);
+}
+
+/**
+ * Scrambling and encoding the PSDU of Table G.33 should give the same.
+ * Get the PSDU back by descrambling "scrambled1"
+ */
+static void testPsdu(void) {
+	PpduParams p;
+	ppduParamsInit(&p, 100, 208, 3, 4, 1);
+	uint8_t servicePrepended[102];
+	Scrambler *s = scramblerCreate(0x5d);
+	scramblerDescramble(s, servicePrepended, shortened1, 102);
+	scramblerDestroy(s);
+	uint8_t *out = (uint8_t *) malloc(p.nAvbits * sizeof(uint8_t));
+	PpduEncoder *penc = ppduEncoderCreate(1);
+	int res = ppduEncodePsdu(penc, &p, servicePrepended + 2, 0x5d, out);
+	CU_ASSERT_EQUAL_FATAL(res, 1);
+	uint8_t *encoded = (uint8_t *) malloc(1944 * sizeof(uint8_t));
+	bytesToBitsBE(encoded, encoded1, 243);
+	for (int i = 0; i < 816; i++) {
+		CU_ASSERT_EQUAL(out[i], encoded[i]);
+	}
+	for (int i = 816; i < 1248; i++) {
+		CU_ASSERT_EQUAL(out[i], encoded[i + 642]);
+	}
+	ppduEncoderDestroy(penc);
+	free(encoded);
+	free(out);
+}
+
+/**
+ * A long PSDU should come out the same with or without threads
+ */
+static void testThreaded(void) {
+	PpduParams p;
+	int res = ppduParamsInit(&p, 4000, 312, 5, 6, 1);
+	CU_ASSERT_EQUAL_FATAL(res, 1);
+	CU_ASSERT(p.nCw >= 16);
+	int nrBytes = p.nPld / 8;
+	uint8_t *bytes = (uint8_t *) malloc(nrBytes * sizeof(uint8_t));
+	for (int i = 0; i < nrBytes; i++) {
+		bytes[i] = (uint8_t)(i * 31 + 7);
+	}
+	uint8_t *out1 = (uint8_t *) malloc(p.nAvbits * sizeof(uint8_t));
+	uint8_t *out4 = (uint8_t *) malloc(p.nAvbits * sizeof(uint8_t));
+	PpduEncoder *penc1 = ppduEncoderCreate(1);
+	PpduEncoder *penc4 = ppduEncoderCreate(4);
+	CU_ASSERT_EQUAL(ppduEncode(penc1, &p, bytes, out1), 1);
+	CU_ASSERT_EQUAL(ppduEncode(penc4, &p, bytes, out4), 1);
+	int diffs = 0;
+	for (int i = 0; i < p.nAvbits; i++) {
+		diffs += out1[i] != out4[i];
+	}
+	CU_ASSERT_EQUAL(diffs, 0);
+	// the first codeword starts with the data, unchanged
+	uint8_t bits[64];
+	bytesToBitsBE(bits, bytes, 8);
+	for (int i = 0; i < 64; i++) {
+		CU_ASSERT_EQUAL(out1[i], bits[i]);
+	}
+	ppduEncoderDestroy(penc1);
+	ppduEncoderDestroy(penc4);
+	free(bytes);
+	free(out1);
+	free(out4);
+}
+
+
+int ppduSuiteSetup(void)
+{
+	CU_pSuite pSuite = CU_add_suite("802.11 PPDU Spec", NULL, NULL);
+	if (!pSuite) {
+		return CU_FALSE;
+	}
+
+	if (
+		(!CU_add_test(pSuite, "should compute the Annex G parameters", testParams)) ||
+		(!CU_add_test(pSuite, "should repeat bits of short frames", testRepetition)) ||
+		(!CU_add_test(pSuite, "should shorten and puncture correctly", testCorrectValue)) ||
+		(!CU_add_test(pSuite, "should scramble and encode a PSDU", testPsdu)) ||
+		(!CU_add_test(pSuite, "should encode the same on many threads", testThreaded))
+		) {
+		return CU_FALSE;
+	}
+
+	return CU_TRUE;
+}
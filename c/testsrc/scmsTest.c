@@ -0,0 +1,73 @@
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <CUnit/Basic.h>
+
+#include "scms.h"
+
+
+static uint32_t seed = 777;
+
+static float srand11(void) {
+	seed = seed * 1664525 + 1013904223;
+	return ((int)(seed >> 8) - (1 << 23)) / (float)(1 << 21);
+}
+
+static void testRule(void) {
+	float r[3] = { 1.0f, -2.0f, 0.5f };
+	// posterior is 0.5 + 1 - 2 + 0.5 = 0
+	float q[3] = { 3.0f, 0.0f, -1.0f };
+	float total = scmsUpdateScalar(0.5f, r, q, 3);
+	CU_ASSERT_DOUBLE_EQUAL(total, 0.0, 0.0001);
+	// -1 flips from +3, so is erased
+	CU_ASSERT_EQUAL(q[0], 0.0f);
+	// no sign last time, so it is kept
+	CU_ASSERT_DOUBLE_EQUAL(q[1], 2.0, 0.0001);
+	// -0.5 keeps the sign of -1
+	CU_ASSERT_DOUBLE_EQUAL(q[2], -0.5, 0.0001);
+}
+
+/**
+ * Both forms should give the same bits, for every degree
+ */
+static void testBitExact(void) {
+	for (int trial = 0; trial < 2000; trial++) {
+		int n = 1 + trial % SCMS_MAX_DEGREE;
+		float r[SCMS_MAX_DEGREE];
+		float q1[SCMS_MAX_DEGREE];
+		float q2[SCMS_MAX_DEGREE];
+		float q3[SCMS_MAX_DEGREE];
+		for (int k = 0; k < n; k++) {
+			r[k] = srand11();
+			q1[k] = trial % 7 == k ? 0.0f : srand11();
+			q2[k] = q1[k];
+			q3[k] = q1[k];
+		}
+		float ci = srand11();
+		float t1 = scmsUpdateScalar(ci, r, q1, n);
+		float t2 = scmsUpdateVector(ci, r, q2, n);
+		float t3 = scmsUpdateAvx2(ci, r, q3, n);
+		CU_ASSERT_EQUAL(memcmp(&t1, &t2, sizeof(float)), 0);
+		CU_ASSERT_EQUAL(memcmp(q1, q2, n * sizeof(float)), 0);
+		CU_ASSERT_EQUAL(memcmp(&t1, &t3, sizeof(float)), 0);
+		CU_ASSERT_EQUAL(memcmp(q1, q3, n * sizeof(float)), 0);
+	}
+}
+
+
+int scmsSuiteSetup(void)
+{
+	CU_pSuite pSuite = CU_add_suite("Self-corrected Min-Sum Spec", NULL, NULL);
+	if (!pSuite) {
+		return CU_FALSE;
+	}
+
+	if (
+		(!CU_add_test(pSuite, "should erase messages that flip", testRule)) ||
+		(!CU_add_test(pSuite, "should be bit-exact scalar and vector", testBitExact))
+		) {
+		return CU_FALSE;
+	}
+
+	return CU_TRUE;
+}
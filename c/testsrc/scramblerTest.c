@@ -0,0 +1,134 @@
+#include <stdlib.h>
+#include <stdint.h>
+#include <CUnit/Basic.h>
+
+#include "scrambler.h"
+#include "util.h"
+
+#include "testdata.h"
+
+
+/**
+ * The scrambling sequence for an initial state of all ones
+ */
+static uint8_t scrambleBits[] = {
+   0,0,0,0,1,1,1,0, 1,1,1,1,0,0,1,0, 1,1,0,0,1,0,0,1, 0,0,0,0,0,0,1,0,
+   0,0,1,0,0,1,1,0, 0,0,1,0,1,1,1,0, 1,0,1,1,0,1,1,0, 0,0,0,0,1,1,0,0,
+   1,1,0,1,0,1,0,0, 1,1,1,0,0,1,1,1, 1,0,1,1,0,1,0,0, 0,0,1,0,1,0,1,0,
+   1,1,1,1,1,0,1,0, 0,1,0,1,0,0,0,1, 1,0,1,1,1,0,0,0, 1,1,1,1,1,1,1
+};
+
+/**
+ * The transmitted message shown in Table G.33 contains 100 octets,
+ * or equivalently, 800 bits. The bits are prepended by the 16
+ * SERVICE field bits (bits 0–15 in Table G.34), as defined in 20.3.11.1,
+ * but tail bits and padding bits are not appended as in the BCC example.
+ * The resulting 816 bits are shown in Table G.34.
+ */
+static uint8_t servicePrepended1[] = {
+  // bit#    7-0      15-8     23-16      hex    hex   hex
+  /* 000–023 00000000 00000000 00000100 */ 0x00, 0x00, 0x04,
+  /* 024–047 00000010 00000000 00101110 */ 0x02, 0x00, 0x2E,
+  /* 048–071 00000000 01100000 00001000 */ 0x00, 0x60, 0x08,
+  /* 072–095 11001101 00110111 10100110 */ 0xCD, 0x37, 0xA6,
+  /* 096–119 00000000 00100000 11010110 */ 0x00, 0x20, 0xD6,
+  /* 120–143 00000001 00111100 11110001 */ 0x01, 0x3C, 0xF1,
+  /* 144–167 00000000 01100000 00001000 */ 0x00, 0x60, 0x08,
+  /* 168–191 10101101 00111011 10101111 */ 0xAD, 0x3B, 0xAF,
+  /* 192–215 00000000 00000000 01001010 */ 0x00, 0x00, 0x4A,
+  /* 216–239 01101111 01111001 00101100 */ 0x6F, 0x79, 0x2C,
+  /* 240–263 00100000 01100010 01110010 */ 0x20, 0x62, 0x72,
+  /* 264–287 01101001 01100111 01101000 */ 0x69, 0x67, 0x68,
+  /* 288–311 01110100 00100000 01110011 */ 0x74, 0x20, 0x73,
+  /* 312–335 01110000 01100001 01110010 */ 0x70, 0x61, 0x72,
+  /* 336–359 01101011 00100000 01101111 */ 0x6B, 0x20, 0x6F,
+  /* 360–383 01100110 00100000 01100100 */ 0x66, 0x20, 0x64,
+  /* 384–407 01101001 01110110 01101001 */ 0x69, 0x76, 0x69,
+  /* 408–431 01101110 01101001 01110100 */ 0x6E, 0x69, 0x74,
+  /* 432–455 01111001 00101100 00001010 */ 0x79, 0x2C, 0x0A,
+  /* 456–479 01000100 01100001 01110101 */ 0x44, 0x61, 0x75,
+  /* 480–503 01100111 01101000 01110100 */ 0x67, 0x68, 0x74,
+  /* 504–527 01100101 01110010 00100000 */ 0x65, 0x72, 0x20,
+  /* 528–551 01101111 01100110 00100000 */ 0x6F, 0x66, 0x20,
+  /* 552–575 01000101 01101100 01111001 */ 0x45, 0x6C, 0x79,
+  /* 576–599 01110011 01101001 01110101 */ 0x73, 0x69, 0x75,
+  /* 600–623 01101101 00101100 00001010 */ 0x6D, 0x2C, 0x0A,
+  /* 624–647 01000110 01101001 01110010 */ 0x46, 0x69, 0x72,
+  /* 648–671 01100101 00101101 01101001 */ 0x65, 0x2D, 0x69,
+  /* 672–695 01101110 01110011 01101001 */ 0x6E, 0x73, 0x69,
+  /* 696–719 01110010 01100101 01100100 */ 0x72, 0x65, 0x64,
+  /* 720–743 00100000 01110111 01100101 */ 0x20, 0x77, 0x65,
+  /* 744–767 00100000 01110100 01110010 */ 0x20, 0x74, 0x72,
+  /* 768–791 01100101 01100001 01100111 */ 0x65, 0x61, 0x67,
+  /* 792–815 00110011 00100001 10110110 */ 0x33, 0x21, 0xB6
+};
+
+
+/**
+ * An all-ones seed should give the sequence from 17.3.5.4
+ */
+static void testSequence(void) {
+	Scrambler *s = scramblerCreate(0x7f);
+	CU_ASSERT_PTR_NOT_NULL_FATAL(s);
+	uint8_t bits[127 * 8];
+	bytesToBitsBE(bits, s->txMask, 127);
+	for (int i = 0; i < 127 * 8; i++) {
+		CU_ASSERT_EQUAL(bits[i], scrambleBits[i % 127]);
+	}
+	scramblerDestroy(s);
+}
+
+/**
+ * Scrambling "servicePrepended1" should give "scrambled1",
+ * the front of "shortened1"
+ */
+static void testCorrectValue(void) {
+	Scrambler *s = scramblerCreate(0x5d);
+	uint8_t out[102];
+	scramblerScramble(s, out, servicePrepended1, 102);
+	for (int i = 0; i < 102; i++) {
+		CU_ASSERT_EQUAL(out[i], shortened1[i]);
+	}
+	scramblerDestroy(s);
+}
+
+/**
+ * Descrambling, in pieces that do not line up with the words,
+ * should give back the original.  The codeword is systematic,
+ * so "encoded1" also starts with the scrambled data
+ */
+static void testRoundTrip(void) {
+	Scrambler *s = scramblerCreate(0x5d);
+	uint8_t scrambled[102];
+	uint8_t out[102];
+	scramblerScramble(s, scrambled, servicePrepended1, 61);
+	scramblerScramble(s, scrambled + 61, servicePrepended1 + 61, 41);
+	scramblerReset(s);
+	scramblerDescramble(s, out, scrambled, 5);
+	scramblerDescramble(s, out + 5, scrambled + 5, 37);
+	scramblerDescramble(s, out + 42, scrambled + 42, 60);
+	for (int i = 0; i < 102; i++) {
+		CU_ASSERT_EQUAL(scrambled[i], encoded1[i]);
+		CU_ASSERT_EQUAL(out[i], servicePrepended1[i]);
+	}
+	scramblerDestroy(s);
+}
+
+
+int scramblerSuiteSetup(void)
+{
+	CU_pSuite pSuite = CU_add_suite("Scrambler Spec", NULL, NULL);
+	if (!pSuite) {
+		return CU_FALSE;
+	}
+
+	if (
+		(!CU_add_test(pSuite, "should generate the scrambling sequence", testSequence)) ||
+		(!CU_add_test(pSuite, "should scramble correctly", testCorrectValue)) ||
+		(!CU_add_test(pSuite, "should descramble what it scrambles", testRoundTrip))
+		) {
+		return CU_FALSE;
+	}
+
+	return CU_TRUE;
+}
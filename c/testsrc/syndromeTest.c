@@ -0,0 +1,128 @@
+#include <stdlib.h>
+#include <stdint.h>
+#include <CUnit/Basic.h>
+
+#include "ldpcEncoder.h"
+#include "syndrome.h"
+#include "802-tables.h"
+
+
+/**
+ * Count the failing rows the slow way, one bit at a time along H
+ */
+static int countSlow(Table *table, uint8_t *bits) {
+	int count = 0;
+	for (int i = 0; i < table->Hlen; i++) {
+		int *row = table->H[i];
+		int sum = 0;
+		for (int j = 1; j <= row[0]; j++) {
+			sum ^= bits[row[j]];
+		}
+		count += sum;
+	}
+	return count;
+}
+
+static void testCodewords(void) {
+	Code *codes[] = { &c12_648, &c23_1296, &c34_1944, &c56_648 };
+	for (int c = 0; c < 4; c++) {
+		Code *code = codes[c];
+		LdpcEncoder *enc = ldpcEncoderCreate(code);
+		uint8_t *msg = (uint8_t *) malloc(code->messageBits * sizeof(uint8_t));
+		for (int i = 0; i < code->messageBits; i++) {
+			msg[i] = (i * 7 + c) % 3 == 0;
+		}
+		uint8_t *x = ldpcEncode(enc, msg, code->messageBits);
+		CU_ASSERT_EQUAL(syndromeCheckBits(code, x), 1);
+		CU_ASSERT_EQUAL(syndromeCountBits(code, x), 0);
+		ldpcEncoderDestroy(enc);
+		free(msg);
+	}
+}
+
+static void testCountErrors(void) {
+	Code *codes[] = { &c12_648, &c23_1296, &c34_1944, &c56_648 };
+	for (int c = 0; c < 4; c++) {
+		Code *code = codes[c];
+		Table *table = tableCreate(code);
+		uint8_t *bits = (uint8_t *) calloc(code->N, sizeof(uint8_t));
+		for (int i = 0; i < 20; i++) {
+			int idx = (i * 131 + c * 17) % code->N;
+			bits[idx] ^= 1;
+			int exp = countSlow(table, bits);
+			CU_ASSERT_EQUAL(syndromeCountBits(code, bits), exp);
+			CU_ASSERT_EQUAL(syndromeCheckBits(code, bits), exp == 0);
+		}
+		tableDestroy(table);
+		free(bits);
+	}
+}
+
+static void testRows(void) {
+	Code *code = &c23_1296;
+	Table *table = tableCreate(code);
+	uint8_t *bits = (uint8_t *) malloc(code->N * sizeof(uint8_t));
+	uint8_t *parity = (uint8_t *) malloc(code->M * sizeof(uint8_t));
+	for (int i = 0; i < code->N; i++) {
+		bits[i] = (i % 7) == 3;
+	}
+	QcWord words[SYNDROME_MAX_NB];
+	syndromePack(words, code, bits);
+	int count = syndromeRows(code, words, parity);
+	CU_ASSERT_EQUAL(count, countSlow(table, bits));
+	for (int i = 0; i < code->M; i++) {
+		int *row = table->H[i];
+		int sum = 0;
+		for (int j = 1; j <= row[0]; j++) {
+			sum ^= bits[row[j]];
+		}
+		CU_ASSERT_EQUAL(parity[i], sum);
+	}
+	tableDestroy(table);
+	free(bits);
+	free(parity);
+}
+
+static void testPackSoft(void) {
+	Code *code = &c12_648;
+	float *soft = (float *) malloc(code->N * sizeof(float));
+	uint8_t *bits = (uint8_t *) malloc(code->N * sizeof(uint8_t));
+	uint8_t *sliced = (uint8_t *) malloc(code->N * sizeof(uint8_t));
+	for (int i = 0; i < code->N; i++) {
+		bits[i] = (i % 5) == 1;
+		soft[i] = bits[i] ? -0.3f : 0.7f;
+	}
+	QcWord a[SYNDROME_MAX_NB];
+	QcWord b[SYNDROME_MAX_NB];
+	syndromePack(a, code, bits);
+	syndromePackSoft(b, code, soft, sliced);
+	for (int i = 0; i < code->nb; i++) {
+		CU_ASSERT(a[i] == b[i]);
+	}
+	for (int i = 0; i < code->N; i++) {
+		CU_ASSERT_EQUAL(sliced[i], bits[i]);
+	}
+	free(soft);
+	free(bits);
+	free(sliced);
+}
+
+
+int syndromeSuiteSetup(void)
+{
+	CU_pSuite pSuite = CU_add_suite("Syndrome Spec", NULL, NULL);
+	if (!pSuite) {
+		return CU_FALSE;
+	}
+
+	if (
+		(!CU_add_test(pSuite, "should pass codewords", testCodewords)) ||
+		(!CU_add_test(pSuite, "should count unsatisfied checks", testCountErrors)) ||
+		(!CU_add_test(pSuite, "should give the parity of each check", testRows)) ||
+		(!CU_add_test(pSuite, "should pack soft values", testPackSoft))
+		) {
+		return CU_FALSE;
+	}
+
+	return CU_TRUE;
+}
@@ -2,8 +2,17 @@
 #include <CUnit/Basic.h>
 #include <stdlib.h>
 #include <math.h>
+#include <string.h>
+#include <stdint.h>
 
 #include "util.h"
+#include "802-codes.h"
+#include "802-tables.h"
+
+static Code *codes[] = {
+	&c12_648, &c12_1296, &c12_1944, &c23_648, &c23_1296, &c23_1944,
+	&c34_648, &c34_1296, &c34_1944, &c56_648, &c56_1296, &c56_1944
+};
 
 static float calcPhiSlow(float x) {
 	float v = tanh(x);
@@ -16,6 +25,35 @@ static void testPhi(void) {
 
 }
 
+/**
+ * Rotating whole cells should give what the sparse rows of A and C give
+ */
+static void testMultiplyQc(void) {
+	uint32_t seed = 7;
+	uint8_t x[1944];
+	uint8_t sparse[1944];
+	uint8_t qc[1944];
+	for (int i = 0; i < 12; i++) {
+		Code *code = codes[i];
+		Table *table = tableCreate(code);
+		for (int k = 0; k < code->N; k++) {
+			seed = seed * 1664525 + 1013904223;
+			x[k] = seed >> 31;
+		}
+		int nb = code->nb;
+		int mb = code->mb;
+		int kb = code->kb;
+		int z = code->z;
+		multiplySparse(sparse, table->A, table->Alen, x);
+		multiplyQc(qc, code->Hb, nb, 0, 0, kb, mb - 1, z, x);
+		CU_ASSERT_EQUAL(memcmp(sparse, qc, table->Alen), 0);
+		multiplySparse(sparse, table->C, table->Clen, x);
+		multiplyQc(qc, code->Hb, nb, 0, mb - 1, kb, 1, z, x);
+		CU_ASSERT_EQUAL(memcmp(sparse, qc, table->Clen), 0);
+		tableDestroy(table);
+	}
+}
+
 
 int utilSuiteSetup(void)
 {
@@ -24,9 +62,10 @@ int utilSuiteSetup(void)
 		return CU_FALSE;
 	}
 
-	if ((NULL == CU_add_test(pSuite, "test Phi function", testPhi))) {
+	if ((NULL == CU_add_test(pSuite, "test Phi function", testPhi)) ||
+		(NULL == CU_add_test(pSuite, "should multiply by whole qc cells", testMultiplyQc))) {
 		return CU_FALSE;
 	}
 
 	return CU_TRUE;
-}
\ No newline at end of file
+}
\ No newline at end of file